@@ -188,8 +188,12 @@ namespace DGtal
 #ifdef TRACE_BITS
       std::cerr << "unsigned int nbSetBits( DGtal::uint64_t val )" << std::endl;
 #endif
+#if defined(__GNUC__) || defined(__clang__)
+      return static_cast<unsigned int>( __builtin_popcountll( val ) );
+#else
       return nbSetBits( static_cast<DGtal::uint32_t>( val & 0xffffffffLL ) ) 
 	+ nbSetBits( static_cast<DGtal::uint32_t>( val >> 32 ) );
+#endif
     }
 
     /**
@@ -330,9 +334,13 @@ namespace DGtal
     static inline 
     unsigned int leastSignificantBit( DGtal::uint64_t n )
     {
+#if defined(__GNUC__) || defined(__clang__)
+      return n ? static_cast<unsigned int>( __builtin_ctzll( n ) ) : 64;
+#else
       return ( n & 0xffffffffLL ) 
         ? leastSignificantBit( (DGtal::uint32_t) n )
         : 32 + leastSignificantBit( (DGtal::uint32_t) (n>>32) );
+#endif
     }
  
     /**
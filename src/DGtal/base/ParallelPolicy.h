@@ -0,0 +1,275 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ParallelPolicy.h
+ * @brief Runtime parallel execution policy and work-stealing task scheduler
+ * @date 2026/10/17
+ *
+ * Header file for module ParallelPolicy.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testParallelPolicy.cpp
+ */
+
+#if defined(ParallelPolicy_RECURSES)
+#error Recursive header files inclusion detected in ParallelPolicy.h
+#else // defined(ParallelPolicy_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ParallelPolicy_RECURSES
+
+#if !defined ParallelPolicy_h
+/** Prevents repeated inclusion of headers. */
+#define ParallelPolicy_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class ParallelPolicy
+  /**
+   * Description of class 'ParallelPolicy' <p>
+   * \brief Aim: Runtime description of how an algorithm may spread
+   * its work over several threads.
+   *
+   * A policy is either sequential (the work is done by the calling
+   * thread) or uses a given number of threads. It does not depend on
+   * any build option: threads are standard C++ threads. When DGtal is
+   * built with OpenMP (WITH_OPENMP), the default policy uses the
+   * OpenMP default number of threads, otherwise it is sequential.
+   *
+   * @code
+   * auto seq = ParallelPolicy::sequential();
+   * auto par = ParallelPolicy::threads( 8 );
+   * auto all = ParallelPolicy::threads(); // one thread per hardware core
+   * @endcode
+   *
+   * @see WorkStealingScheduler
+   */
+  class ParallelPolicy
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor: sequential policy, or the OpenMP default
+     * number of threads if DGtal has been built with OpenMP.
+     */
+    ParallelPolicy();
+
+    /**
+     * @return a sequential policy.
+     */
+    static ParallelPolicy sequential();
+
+    /**
+     * @param n the number of threads, 0 means one thread per hardware
+     * core.
+     * @return a policy using @a n threads.
+     */
+    static ParallelPolicy threads( unsigned int n = 0 );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return the number of threads (at least 1).
+    unsigned int nbThreads() const
+    {
+      return myNbThreads;
+    }
+
+    /// @return true if the work is done by the calling thread only.
+    bool isSequential() const
+    {
+      return myNbThreads <= 1;
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * Constructor.
+     * @param n the number of threads.
+     */
+    explicit ParallelPolicy( unsigned int n );
+
+    /// Number of threads.
+    unsigned int myNbThreads;
+
+  }; // end of class ParallelPolicy
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class WorkStealingScheduler
+  /**
+   * Description of class 'WorkStealingScheduler' <p>
+   * \brief Aim: Runs a range of independent tasks on the threads of a
+   * ParallelPolicy, balancing the load by work stealing.
+   *
+   * The task indices [0,n) are first split into one contiguous range
+   * per thread. Each thread runs the tasks of its own range from the
+   * front. When its range is empty, it steals the second half of the
+   * remaining range of another thread. Neighbor tasks are thus mostly
+   * processed by the same thread, which preserves locality when tasks
+   * are tiles of a domain, while irregular task costs are balanced.
+   *
+   * A task is a functor called as @c task( i, t ) where @a i is the
+   * task index and @a t the index of the running thread (in
+   * [0,nbThreads()) ), which can be used to address per-thread
+   * scratch data. If a task throws, the remaining tasks are skipped
+   * and the first exception is rethrown by run().
+   *
+   * @code
+   * WorkStealingScheduler scheduler( ParallelPolicy::threads( 4 ) );
+   * std::vector<double> values( n );
+   * scheduler.run( n, [&] ( std::size_t i, unsigned int ) { values[ i ] = f( i ); } );
+   * @endcode
+   */
+  class WorkStealingScheduler
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aPolicy the parallel policy.
+     */
+    explicit WorkStealingScheduler( const ParallelPolicy & aPolicy = ParallelPolicy() );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return the number of threads used by run().
+    unsigned int nbThreads() const
+    {
+      return myPolicy.nbThreads();
+    }
+
+    /**
+     * Runs the tasks [0,nbTasks) and returns when all of them are done.
+     *
+     * @tparam TTask the type of functor, called as task( std::size_t, unsigned int ).
+     * @param nbTasks the number of tasks.
+     * @param task the task functor (shared by all threads).
+     */
+    template <typename TTask>
+    void run( std::size_t nbTasks, const TTask & task );
+
+    /// @return the number of successful steals during the last run().
+    std::size_t nbSteals() const
+    {
+      return myNbSteals;
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Range of task indices owned by a thread.
+    struct TaskRange
+    {
+      std::mutex mutex;
+      std::size_t begin = 0;
+      std::size_t end = 0;
+    };
+
+    /**
+     * @param ranges the per-thread ranges.
+     * @param t the index of the calling thread.
+     * @param[out] i the task to run.
+     * @return true if a task was found (own or stolen), false if all
+     * ranges are empty.
+     */
+    bool nextTask( std::vector< TaskRange > & ranges, unsigned int t, std::size_t & i );
+
+    /// The parallel policy.
+    ParallelPolicy myPolicy;
+
+    /// Number of steals of the last run.
+    std::atomic< std::size_t > myNbSteals;
+
+  }; // end of class WorkStealingScheduler
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ParallelPolicy'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ParallelPolicy' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const ParallelPolicy & object );
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'WorkStealingScheduler'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'WorkStealingScheduler' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const WorkStealingScheduler & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/ParallelPolicy.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ParallelPolicy_h
+
+#undef ParallelPolicy_RECURSES
+#endif // else defined(ParallelPolicy_RECURSES)
@@ -45,6 +45,7 @@
 #include <tuple>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/CountedPtr.h"
 #include "DGtal/math/linalg/EigenSupport.h"
 #include "DGtal/dec/DiscreteExteriorCalculus.h"
 #include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
@@ -169,6 +170,11 @@ namespace DGtal
     PrimalForm0           former_v0;
     /// The primal 0-form lambda/(4epsilon) (stored for performance)
     PrimalForm0           l_1_over_4e;
+    /// The solver for u (shared by copies), kept between steps to reuse the symbolic
+    /// analysis of its operator (whose pattern does not change).
+    CountedPtr< SolverU2 > solver_u2;
+    /// The solver for v, kept between steps for the same reason.
+    CountedPtr< SolverV0 > solver_v0;
 
   public:
     // The map Surfel -> Index that gives the index of the surfel in 2-forms.
@@ -205,7 +211,8 @@ namespace DGtal
         M01( *ptrCalculus ), M12( *ptrCalculus ), primal_AD2( *ptrCalculus ),
         alpha_Id2( *ptrCalculus ), l_1_over_4e_Id0( *ptrCalculus ),
         g2(), alpha_g2(), u2(), v0( *ptrCalculus ), former_v0( *ptrCalculus ),
-        l_1_over_4e( *ptrCalculus ), verbose( aVerbose )
+        l_1_over_4e( *ptrCalculus ),
+        solver_u2( new SolverU2 ), solver_v0( new SolverV0 ), verbose( aVerbose )
     {
       if ( verbose >= 2 )
 	trace.info() << "[ATSolver::ATSolver] " << *ptrCalculus << std::endl;
@@ -553,15 +560,14 @@ namespace DGtal
         + primal_AD2.transpose() * dec_helper::diagonal( v1_squared ) * primal_AD2;
 
       if ( verbose >= 2 ) trace.info() << "Prefactoring matrix U associated to u" << std::endl;
-      SolverU2 solver_u2;
-      solver_u2.compute( ope_u2 );
+      solver_u2->compute( ope_u2 );
       for ( Dimension d = 0; d < u2.size(); ++d )
         {
           if ( verbose >= 2 ) trace.info() << "Solving U u[" << d << "] = a g[" << d << "]" << std::endl;
-          u2[ d ] = solver_u2.solve( alpha_g2[ d ] );
-          if ( verbose >= 2 ) trace.info() << "  => " << ( solver_u2.isValid() ? "OK" : "ERROR" )
-                                           << " " << solver_u2.myLinearAlgebraSolver.info() << std::endl;
-          solve_ok = solve_ok && solver_u2.isValid();
+          u2[ d ] = solver_u2->solve( alpha_g2[ d ] );
+          if ( verbose >= 2 ) trace.info() << "  => " << ( solver_u2->isValid() ? "OK" : "ERROR" )
+                                           << " " << solver_u2->myLinearAlgebraSolver.info() << std::endl;
+          solve_ok = solve_ok && solver_u2->isValid();
         }
       if ( normalize_u2 ) normalizeU2();
       if ( verbose >= 1 ) trace.endBlock();
@@ -576,13 +582,12 @@ namespace DGtal
 	+ M01.transpose() * dec_helper::diagonal( squared_norm_d_u2 ) * M01;
 
       if ( verbose >= 2 ) trace.info() << "Prefactoring matrix V associated to v" << std::endl;
-      SolverV0 solver_v0;
-      solver_v0.compute( ope_v0 );
+      solver_v0->compute( ope_v0 );
       if ( verbose >= 2 ) trace.info() << "Solving V v = l/4e * 1" << std::endl;
-      v0 = solver_v0.solve( l_1_over_4e );
-      if ( verbose >= 2 ) trace.info() << "  => " << ( solver_v0.isValid() ? "OK" : "ERROR" )
-                                       << " " << solver_v0.myLinearAlgebraSolver.info() << std::endl;
-      solve_ok = solve_ok && solver_v0.isValid();
+      v0 = solver_v0->solve( l_1_over_4e );
+      if ( verbose >= 2 ) trace.info() << "  => " << ( solver_v0->isValid() ? "OK" : "ERROR" )
+                                       << " " << solver_v0->myLinearAlgebraSolver.info() << std::endl;
+      solve_ok = solve_ok && solver_v0->isValid();
       if ( verbose >= 1 ) trace.endBlock();
       return solve_ok;
     }
@@ -755,6 +760,20 @@ namespace DGtal
     {
       return u2[ k ];
     }
+
+    /// @return the solver for u, e.g. to get the timings of each
+    /// alternate step (see DiscreteExteriorCalculusSolver::timings).
+    const SolverU2& getSolverU2() const
+    {
+      return *solver_u2;
+    }
+
+    /// @return the solver for v, e.g. to get the timings of each
+    /// alternate step (see DiscreteExteriorCalculusSolver::timings).
+    const SolverV0& getSolverV0() const
+    {
+      return *solver_v0;
+    }
     
     /// Given a range of surfels [itB,itE), returns in \a output the
     /// regularized vector field u.
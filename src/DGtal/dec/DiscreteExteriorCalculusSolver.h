@@ -41,15 +41,54 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/base/Clone.h"
+#include "DGtal/base/Clock.h"
 #include "DGtal/dec/KForm.h"
 #include "DGtal/dec/LinearOperator.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
 {
+  namespace detail
+  {
+    /// Tells if a linear algebra solver separates the symbolic
+    /// analysis (analyzePattern) from the numerical factorization
+    /// (factorize) of a matrix.
+    template <typename TSolver, typename TMatrix, typename = void>
+    struct HasSymbolicFactorization : std::false_type {};
+    template <typename TSolver, typename TMatrix>
+    struct HasSymbolicFactorization<TSolver, TMatrix, std::void_t<
+      decltype( std::declval<TSolver&>().analyzePattern( std::declval<const TMatrix&>() ) ),
+      decltype( std::declval<TSolver&>().factorize( std::declval<const TMatrix&>() ) ) > >
+      : std::true_type {};
+
+    /// Tells if a linear algebra solver is iterative, i.e. can solve
+    /// from an initial guess (solveWithGuess).
+    template <typename TSolver, typename TVector, typename = void>
+    struct HasSolveWithGuess : std::false_type {};
+    template <typename TSolver, typename TVector>
+    struct HasSolveWithGuess<TSolver, TVector, std::void_t<
+      decltype( std::declval<const TSolver&>().solveWithGuess( std::declval<const TVector&>(),
+                                                               std::declval<const TVector&>() ) ) > >
+      : std::true_type {};
+
+    /// Tells if a matrix is a sparse matrix with compressed storage
+    /// (outerIndexPtr, innerIndexPtr).
+    template <typename TMatrix, typename = void>
+    struct HasCompressedStorage : std::false_type {};
+    template <typename TMatrix>
+    struct HasCompressedStorage<TMatrix, std::void_t<
+      decltype( std::declval<const TMatrix&>().isCompressed() ),
+      decltype( std::declval<const TMatrix&>().outerIndexPtr() ),
+      decltype( std::declval<const TMatrix&>().innerIndexPtr() ) > >
+      : std::true_type {};
+  } // namespace detail
+
 
   /////////////////////////////////////////////////////////////////////////////
   // template class DiscreteExteriorCalculusSolver
@@ -58,6 +97,16 @@ namespace DGtal
    * \brief Aim:
    * This wraps a linear algebra solver around a discrete exterior calculus.
    *
+   * When compute() is called several times with operators sharing the
+   * same sparsity pattern (e.g. in alternate minimization loops), and
+   * when the linear algebra solver separates the symbolic analysis
+   * (analyzePattern) from the numerical factorization (factorize),
+   * only the numerical factorization is done again. Iterative solvers
+   * (e.g. EigenLinearAlgebraBackend::SolverConjugateGradient) may
+   * start from the previous solution (setWarmStart) or from a given
+   * initial guess. The time spent in each call to compute() and in the
+   * following solves is recorded (timings()).
+   *
    * @tparam TCalculus should be DiscreteExteriorCalculus.
    * @tparam TLinearAlgebraSolver should be a model of CLinearAlgebraSolver.
    * @tparam order_in is the input order of the linear problem.
@@ -82,6 +131,23 @@ namespace DGtal
     typedef KForm<Calculus, order_in, duality_in> SolutionKForm;
     typedef KForm<Calculus, order_out, duality_out> InputKForm;
 
+    /// Times (in ms) spent in one call to compute() and in the
+    /// following calls to solve().
+    struct Timing
+    {
+      /// Time of the symbolic analysis (0 if the pattern was reused).
+      double analyze = 0.0;
+      /// Time of the numerical factorization (or of compute() when the
+      /// solver does not separate the analysis from the factorization).
+      double factorize = 0.0;
+      /// Cumulated time of the solves.
+      double solve = 0.0;
+      /// Number of solves.
+      unsigned int nbSolves = 0;
+      /// 'true' if the symbolic analysis of the previous call was reused.
+      bool patternReused = false;
+    };
+
     /**
      * Constructor.
      */
@@ -113,12 +179,54 @@ namespace DGtal
     DiscreteExteriorCalculusSolver& compute(const Operator& linear_operator);
 
     /**
-     * Solve prefactorized / set problem input.
+     * Prefactorize problem / set problem operator, with a hint on its
+     * sparsity pattern. When @a identical_pattern is 'true', the
+     * pattern is assumed to be the one of the previous operator
+     * (without checking it) and only the numerical factorization is
+     * done. Otherwise, the symbolic analysis is done again.
+     * @param linear_operator linear operator.
+     * @param identical_pattern 'true' if the sparsity pattern did not change.
+     * @return *this.
+     */
+    DiscreteExteriorCalculusSolver& compute(const Operator& linear_operator,
+                                            bool identical_pattern);
+
+    /**
+     * Solve prefactorized / set problem input. With an iterative
+     * solver and warm start enabled, the previous solution (if any)
+     * is the initial guess.
      * @param input_kform input k-form.
      * @return problem solution.
      */
     SolutionKForm solve(const InputKForm& input_kform) const;
 
+    /**
+     * Solve prefactorized / set problem input from an initial guess,
+     * which is ignored by direct solvers.
+     * @param input_kform input k-form.
+     * @param initial_guess initial guess of the solution.
+     * @return problem solution.
+     */
+    SolutionKForm solve(const InputKForm& input_kform,
+                        const SolutionKForm& initial_guess) const;
+
+    /**
+     * Enables or disables warm start of iterative solvers from the
+     * previous solution (disabled by default).
+     * @param warm_start when 'true', warm start is enabled.
+     */
+    void setWarmStart(bool warm_start);
+
+    /// @return 'true' if warm start of iterative solvers is enabled.
+    bool warmStart() const;
+
+    /// @return the timings of each call to compute() since the
+    /// construction or the last clearTimings().
+    const std::vector<Timing>& timings() const;
+
+    /// Clears the timings.
+    void clearTimings();
+
     /**
      * Checks the validity/consistency of the object.
      * @return 'true' if the object is valid, 'false' otherwise.
@@ -128,9 +236,36 @@ namespace DGtal
     // ------------------------- Private Datas --------------------------------
   private:
 
+    /// The outer indices of the sparsity pattern of the last operator
+    /// (empty if unknown).
+    std::vector<std::ptrdiff_t> myPatternOuter;
+
+    /// The inner indices of the sparsity pattern of the last operator.
+    std::vector<std::ptrdiff_t> myPatternInner;
+
+    /// 'true' if the symbolic analysis of the last operator is available.
+    bool myHasPattern;
+
+    /// When 'true', iterative solvers start from the previous solution.
+    bool myWarmStart;
+
+    /// The previous solution (used for warm start).
+    mutable typename SolutionKForm::Container myLastSolution;
+
+    /// The timings of each call to compute().
+    mutable std::vector<Timing> myTimings;
+
     // ------------------------- Hidden services ------------------------------
   protected:
 
+    /**
+     * Stores the sparsity pattern of a compressed sparse matrix.
+     * @param matrix the matrix.
+     * @return 'true' if the pattern is identical to the stored one.
+     */
+    template <typename TMatrix>
+    bool updatePattern(const TMatrix& matrix);
+
     // ------------------------- Internals ------------------------------------
   private:
 
@@ -41,9 +41,14 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ParallelPolicy.h"
 #include "DGtal/math/linalg/DirichletConditions.h"
+#include "DGtal/math/linalg/SparseLDLTFactorization.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -56,6 +61,13 @@ namespace DGtal
    *
    * see @ref moduleGeodesicsInHeat for details and examples.
    *
+   * The heat, Poisson and Dirichlet operators are prefactored once by
+   * init(). Distances from many sets of sources can then be computed
+   * at once with computeBatch(), which solves multi-column systems
+   * and dispatches the columns on several threads. The
+   * factorizations can be saved with saveFactorizations() and
+   * reloaded in place of init() with loadFactorizations().
+   *
    * @tparam a model of PolygonalCalculus.
    */
   template <typename TPolygonalCalculus>
@@ -73,6 +85,8 @@ namespace DGtal
     typedef typename PolygonalCalculus::LinAlg LinAlgBackend;
     typedef DirichletConditions< LinAlgBackend > Conditions;
     typedef typename Conditions::IntegerVector IntegerVector;
+    typedef SparseLDLTFactorization< LinAlgBackend > Factorization;
+    typedef typename DenseMatrix::Index Index;
     
     /**
      * Default constructor.
@@ -263,6 +277,153 @@ namespace DGtal
       //shifting the distances to get 0 at sources
       return distVec - sourceval*Vector::Ones(myCalculus->nbVertices());
     }
+
+    /// Computes the geodesic distances from several sets of sources
+    /// at once. The heat diffusion and Poisson problems of all the
+    /// sets are solved as multi-column systems with the
+    /// factorizations of init(), by blocks of columns dispatched
+    /// according to @a policy. The i-th column is the result of
+    /// compute() with the i-th set of sources, whose last vertex
+    /// gets distance 0.
+    ///
+    /// @param sources the sets of source vertices (non-empty).
+    /// @param policy the parallel policy (sequential by default).
+    /// @returns a matrix with one column of distances per set of sources.
+    DenseMatrix computeBatch( const std::vector< std::vector< Vertex > >& sources,
+                              const ParallelPolicy& policy = ParallelPolicy::sequential() ) const
+    {
+      FATAL_ERROR_MSG(myIsInit, "init() method must be called first");
+      const Index n = myCalculus->nbVertices();
+      const Index k = sources.size();
+      DenseMatrix result( n, k );
+      if ( k == 0 ) return result;
+      auto surfmesh = myCalculus->getSurfaceMeshPtr();
+
+      // Per face operators, computed beforehand since the operator
+      // cache of the calculus is not thread-safe.
+      const auto nbF = myCalculus->nbFaces();
+      std::vector< DenseMatrix > gradients( nbF ), flats( nbF ), divergences( nbF );
+      for ( typename PolygonalCalculus::MySurfaceMesh::Index f = 0; f < nbF; ++f )
+        {
+          gradients[ f ]   = myCalculus->gradient( f );
+          flats[ f ]       = myCalculus->flat( f );
+          divergences[ f ] = myCalculus->divergence( f );
+        }
+
+      // Blocks of columns, a few per thread for load balancing.
+      const std::size_t nbThreads = policy.isSequential() ? 1 : policy.nbThreads();
+      const std::size_t blockSize = policy.isSequential() ? k
+        : std::max< std::size_t >( 1, ( k + 4 * nbThreads - 1 ) / ( 4 * nbThreads ) );
+      const std::size_t nbBlocks  = ( k + blockSize - 1 ) / blockSize;
+      WorkStealingScheduler scheduler( policy );
+      scheduler.run( nbBlocks, [&] ( std::size_t b, unsigned int )
+      {
+        const Index first = b * blockSize;
+        const Index nb    = std::min< Index >( blockSize, k - first );
+        DenseMatrix sourceBlock = DenseMatrix::Zero( n, nb );
+        for ( Index j = 0; j < nb; ++j )
+          {
+            ASSERT_MSG( ! sources[ first + j ].empty(), "Empty set of sources" );
+            for ( auto v : sources[ first + j ] )
+              {
+                ASSERT_MSG( v < myCalculus->nbVertices(), "Vertex is not in the surface mesh vertex range" );
+                sourceBlock( v, j ) = 1.0;
+              }
+          }
+        // Heat diffusion
+        DenseMatrix heatDiffusion = myHeatSolver.solve( sourceBlock );
+        if ( myManageBoundary )
+          {
+            Vector bValues = Vector::Zero( n );
+            DenseMatrix bSources( n - myBoundary.sum(), nb );
+            for ( Index j = 0; j < nb; ++j )
+              bSources.col( j ) = Conditions::dirichletVector( myHeatOpe, sourceBlock.col( j ),
+                                                               myBoundary, bValues );
+            DenseMatrix bSol = myHeatDirichletSolver.solve( bSources );
+            for ( Index j = 0; j < nb; ++j )
+              heatDiffusion.col( j ) = 0.5 * ( heatDiffusion.col( j )
+                                               + Conditions::dirichletSolution
+                                               ( bSol.col( j ), myBoundary, bValues ) );
+          }
+        // Heat, normalization and divergence per face
+        DenseMatrix divergence = DenseMatrix::Zero( n, nb );
+        for ( typename PolygonalCalculus::MySurfaceMesh::Index f = 0; f < nbF; ++f )
+          {
+            const auto & vertices = surfmesh->incidentVertices( f );
+            Vector faceHeat( vertices.size() );
+            for ( Index j = 0; j < nb; ++j )
+              {
+                Index cpt = 0;
+                for ( auto v : vertices ) faceHeat( cpt++ ) = heatDiffusion( v, j );
+                Vector grad = -gradients[ f ] * faceHeat;
+                grad.normalize();
+                DenseMatrix   oneForm = flats[ f ] * grad;
+                Vector divergenceFace = divergences[ f ] * oneForm;
+                cpt = 0;
+                for ( auto v : vertices ) divergence( v, j ) += divergenceFace( cpt++ );
+              }
+          }
+        // Last Poisson solve, shifted to get 0 at the last source.
+        DenseMatrix distances = myPoissonSolver.solve( divergence );
+        for ( Index j = 0; j < nb; ++j )
+          {
+            const auto sourceval = distances( sources[ first + j ].back(), j );
+            result.col( first + j ) = distances.col( j ) - sourceval * Vector::Ones( n );
+          }
+      } );
+      return result;
+    }
+
+    /// Writes the factorizations computed by init() (and the data
+    /// needed by compute()) in binary form on an output stream, so
+    /// that another instance on the same mesh may skip init().
+    ///
+    /// @param out the output stream (opened in binary mode).
+    /// @return 'true' if the writing was successful.
+    bool saveFactorizations( std::ostream& out ) const
+    {
+      FATAL_ERROR_MSG(myIsInit, "init() method must be called first");
+      const std::int64_t nbV = myCalculus->nbVertices();
+      const std::int64_t boundary = myManageBoundary ? 1 : 0;
+      Factorization::writeValue( out, nbV );
+      Factorization::writeValue( out, boundary );
+      Factorization::writeValue( out, myLambda );
+      myHeatSolver.save( out );
+      myPoissonSolver.save( out );
+      if ( myManageBoundary )
+        {
+          myHeatDirichletSolver.save( out );
+          Factorization::writeSparseMatrix( out, myHeatOpe );
+          Factorization::writeVector( out, myBoundary );
+        }
+      return out.good();
+    }
+
+    /// Reads factorizations written by saveFactorizations(), in place
+    /// of init(). The calculus must be built on the same mesh.
+    ///
+    /// @param in the input stream (opened in binary mode).
+    /// @return 'true' if the reading was successful, in which case
+    /// the object is initialized with an empty source.
+    bool loadFactorizations( std::istream& in )
+    {
+      std::int64_t nbV = -1, boundary = 0;
+      bool ok = Factorization::readValue( in, nbV )
+        && nbV == static_cast< std::int64_t >( myCalculus->nbVertices() )
+        && Factorization::readValue( in, boundary )
+        && Factorization::readValue( in, myLambda )
+        && myHeatSolver.load( in ) && myHeatSolver.rows() == nbV
+        && myPoissonSolver.load( in ) && myPoissonSolver.rows() == nbV;
+      myManageBoundary = ( boundary != 0 );
+      if ( ok && myManageBoundary )
+        ok = myHeatDirichletSolver.load( in )
+          && Factorization::readSparseMatrix( in, myHeatOpe )
+          && Factorization::readVector( in, myBoundary )
+          && myBoundary.rows() == nbV;
+      myIsInit = ok;
+      if ( ok ) mySource = Vector::Zero( nbV );
+      return ok;
+    }
     
     
     /// @return true if the calculus is valid.
@@ -282,10 +443,10 @@ namespace DGtal
     SparseMatrix myHeatOpe;
     
     ///Poisson solver
-    Solver myPoissonSolver;
+    Factorization myPoissonSolver;
 
     ///Heat solver
-    Solver myHeatSolver;
+    Factorization myHeatSolver;
 
     ///Source vector
     Vector mySource;
@@ -307,7 +468,7 @@ namespace DGtal
     IntegerVector myBoundary;
     
     ///Heat solver with Dirichlet boundary conditions.
-    Solver myHeatDirichletSolver;
+    Factorization myHeatDirichletSolver;
   
   
   }; // end of class GeodesicsInHeat
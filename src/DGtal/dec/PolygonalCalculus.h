@@ -30,6 +30,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <algorithm>
 #include <functional>
 #include <vector>
 #include <string>
@@ -37,6 +38,7 @@
 #include <unordered_map>
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelPolicy.h"
 #include "DGtal/shapes/SurfaceMesh.h"
 #include "DGtal/math/linalg/EigenSupport.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -164,6 +166,29 @@ public:
   ///Type of a sparse matrix solver
   typedef LinAlg::SolverSimplicialLDLT Solver;
 
+  /// Precomputed sparsity pattern of a global operator assembled from
+  /// per face operators (see makeAssemblyPattern). It only depends on
+  /// the combinatorics of the mesh: it can be reused to assemble
+  /// operators again when vertex positions change.
+  struct AssemblyPattern
+  {
+    /// Number of rows (and columns) per vertex (1 for operators on
+    /// scalars, 2 for the connection Laplacian).
+    Dimension blockSize = 1;
+    /// The global matrix, compressed, with zero values.
+    SparseMatrix matrix;
+    /// Offsets of the per face operators in the buffer of local
+    /// operators (nbFaces()+1 values). The local operator of a face
+    /// of degree n is stored row by row in (blockSize*n)^2 values.
+    std::vector<std::size_t> faceOffsets;
+    /// For each nonzero of matrix, the range of its contributions in
+    /// contributions (nonZeros()+1 values).
+    std::vector<std::size_t> nonZeroOffsets;
+    /// Indices in the buffer of local operators of the contributions
+    /// to each nonzero, in face order.
+    std::vector<std::size_t> contributions;
+  };
+
   /// @name Standard services
   /// @{
   
@@ -974,6 +999,203 @@ public:
     M.setFromTriplets(triplets.begin(), triplets.end());
     return M;
   }
+
+  /// Computes the sparsity pattern of global operators assembled from
+  /// per face operators, i.e. the nonzeros and, for each of them, the
+  /// coefficients of local operators that are summed into it.
+  ///
+  /// @param blockSize 1 for operators on scalars (e.g.
+  /// globalLaplaceBeltrami), 2 for globalConnectionLaplace.
+  /// @return the pattern, which may be reused as long as the faces of
+  /// the mesh do not change.
+  AssemblyPattern makeAssemblyPattern(const Dimension blockSize = 1) const
+  {
+    typedef typename SparseMatrix::StorageIndex StorageIndex;
+    AssemblyPattern pattern;
+    pattern.blockSize = blockSize;
+    const auto nbF = mySurfaceMesh->nbFaces();
+    const auto n   = blockSize * mySurfaceMesh->nbVertices();
+    pattern.faceOffsets.resize(nbF + 1);
+    pattern.faceOffsets[0] = 0;
+    for (typename MySurfaceMesh::Index f = 0; f < nbF; ++f)
+    {
+      const auto m = blockSize * myFaceDegree[f];
+      pattern.faceOffsets[f + 1] = pattern.faceOffsets[f] + m * m;
+    }
+    // (column, row, index in local buffer) of every local coefficient,
+    // bucketed by column (counting sort), then sorted by row. The
+    // local buffer order, i.e. face order, is kept for a same row.
+    struct Entry { StorageIndex col; StorageIndex row; std::size_t idx; };
+    std::vector<std::size_t> colStart(n + 1, 0);
+    for (typename MySurfaceMesh::Index f = 0; f < nbF; ++f)
+      for (auto v : mySurfaceMesh->incidentVertices(f))
+        for (auto k = 0u; k < blockSize; ++k)
+          colStart[blockSize * v + k + 1] += blockSize * myFaceDegree[f];
+    for (std::size_t c = 0; c < n; ++c)
+      colStart[c + 1] += colStart[c];
+    std::vector<Entry> entries(pattern.faceOffsets.back());
+    std::vector<std::size_t> pos(colStart.begin(), colStart.end() - 1);
+    for (typename MySurfaceMesh::Index f = 0; f < nbF; ++f)
+    {
+      const auto & vertices = mySurfaceMesh->incidentVertices(f);
+      const auto m          = blockSize * myFaceDegree[f];
+      const auto off        = pattern.faceOffsets[f];
+      for (auto i = 0u; i < m; ++i)
+        for (auto j = 0u; j < m; ++j)
+        {
+          const auto col = blockSize * vertices[j / blockSize] + j % blockSize;
+          entries[pos[col]++] =
+            { (StorageIndex)col,
+              (StorageIndex)(blockSize * vertices[i / blockSize] + i % blockSize),
+              off + i * m + j };
+        }
+    }
+    for (std::size_t c = 0; c < n; ++c)
+      std::stable_sort(entries.begin() + colStart[c], entries.begin() + colStart[c + 1],
+                       [] (const Entry & a, const Entry & b) { return a.row < b.row; });
+    // Compressed column storage.
+    std::vector<StorageIndex> outer(n + 1, 0);
+    std::vector<StorageIndex> inner;
+    pattern.contributions.resize(entries.size());
+    for (std::size_t k = 0; k < entries.size(); ++k)
+    {
+      if (k == 0 || entries[k].col != entries[k - 1].col
+          || entries[k].row != entries[k - 1].row)
+      {
+        inner.push_back(entries[k].row);
+        pattern.nonZeroOffsets.push_back(k);
+        ++outer[entries[k].col + 1];
+      }
+      pattern.contributions[k] = entries[k].idx;
+    }
+    pattern.nonZeroOffsets.push_back(entries.size());
+    for (std::size_t c = 0; c < n; ++c)
+      outer[c + 1] += outer[c];
+    SparseMatrix & A = pattern.matrix;
+    A.resize(n, n);
+    A.resizeNonZeros(inner.size());
+    std::copy(outer.begin(), outer.end(), A.outerIndexPtr());
+    std::copy(inner.begin(), inner.end(), A.innerIndexPtr());
+    std::fill(A.valuePtr(), A.valuePtr() + inner.size(), 0.0);
+    return pattern;
+  }
+
+  /// Computes the global Laplace-Beltrami operator, with per face
+  /// operators computed in parallel and summed directly into the
+  /// nonzeros of a precomputed sparsity pattern (see
+  /// makeAssemblyPattern). Triangle and quad faces use fixed-size
+  /// local operators. The result is the one of
+  /// globalLaplaceBeltrami(lambda), up to rounding errors, except
+  /// that nonzeros whose contributions cancel are kept as explicit
+  /// zeros.
+  ///
+  /// @note The embedders must be thread-safe. When the internal cache
+  /// is enabled, per face operators are computed sequentially, read
+  /// from the cache when present, and the fixed-size operators are
+  /// copied into it (see enableInternalGlobalCache).
+  ///
+  /// @param pattern a pattern computed by makeAssemblyPattern(1) on this mesh.
+  /// @param lambda the regularization parameter for the local Laplace-Beltrami operators
+  /// @param policy the parallel policy (sequential by default).
+  /// @return a sparse nbVertices x nbVertices matrix
+  SparseMatrix globalLaplaceBeltrami(const AssemblyPattern & pattern,
+                                     const double lambda = 1.0,
+                                     const ParallelPolicy & policy = ParallelPolicy::sequential()) const
+  {
+    ASSERT(pattern.blockSize == 1);
+    return assemble(pattern, [&] (const Face f, double * out)
+    {
+      const auto nf = myFaceDegree[f];
+      typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> RowMatrix;
+      Eigen::Map<RowMatrix> local(out, nf, nf);
+      if (checkCache(L_, f))
+        local = myGlobalCache[L_][f];
+      else if (nf == 3)
+      {
+        local = fixedLaplaceBeltrami<3>(f, lambda);
+        setInCache(L_, f, local);
+      }
+      else if (nf == 4)
+      {
+        local = fixedLaplaceBeltrami<4>(f, lambda);
+        setInCache(L_, f, local);
+      }
+      else
+        local = laplaceBeltrami(f, lambda);
+    }, policy);
+  }
+
+  /// Computes the global Laplace-Beltrami operator in parallel (see
+  /// globalLaplaceBeltrami(const AssemblyPattern&,double,const ParallelPolicy&)).
+  ///
+  /// @param lambda the regularization parameter for the local Laplace-Beltrami operators
+  /// @param policy the parallel policy.
+  /// @return a sparse nbVertices x nbVertices matrix
+  SparseMatrix globalLaplaceBeltrami(const double lambda,
+                                     const ParallelPolicy & policy) const
+  {
+    return globalLaplaceBeltrami(makeAssemblyPattern(1), lambda, policy);
+  }
+
+  /// Computes the global Connection-Laplace-Beltrami operator, with
+  /// per face operators computed in parallel and summed directly into
+  /// the nonzeros of a precomputed sparsity pattern (see
+  /// globalLaplaceBeltrami(const AssemblyPattern&,double,const ParallelPolicy&)).
+  ///
+  /// @param pattern a pattern computed by makeAssemblyPattern(2) on this mesh.
+  /// @param lambda the regularization parameter for the local
+  /// Connection-Laplace-Beltrami operators
+  /// @param policy the parallel policy (sequential by default).
+  /// @return a sparse 2*nbVertices x 2*nbVertices matrix
+  SparseMatrix globalConnectionLaplace(const AssemblyPattern & pattern,
+                                       const double lambda = 1.0,
+                                       const ParallelPolicy & policy = ParallelPolicy::sequential()) const
+  {
+    ASSERT(pattern.blockSize == 2);
+    return assemble(pattern, [&] (const Face f, double * out)
+    {
+      const auto m = 2 * myFaceDegree[f];
+      typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> RowMatrix;
+      Eigen::Map<RowMatrix> local(out, m, m);
+      local = connectionLaplacian(f, lambda);
+    }, policy);
+  }
+
+  /// Computes the global Connection-Laplace-Beltrami operator in
+  /// parallel (see
+  /// globalConnectionLaplace(const AssemblyPattern&,double,const ParallelPolicy&)).
+  ///
+  /// @param lambda the regularization parameter for the local
+  /// Connection-Laplace-Beltrami operators
+  /// @param policy the parallel policy.
+  /// @return a sparse 2*nbVertices x 2*nbVertices matrix
+  SparseMatrix globalConnectionLaplace(const double lambda,
+                                       const ParallelPolicy & policy) const
+  {
+    return globalConnectionLaplace(makeAssemblyPattern(2), lambda, policy);
+  }
+
+  /// Computes the global lumped mass matrix, with face areas and
+  /// vertex weights computed in parallel. Same result as
+  /// globalLumpedMassMatrix().
+  ///
+  /// @param policy the parallel policy.
+  /// @return the global lumped mass matrix.
+  SparseMatrix globalLumpedMassMatrix(const ParallelPolicy & policy) const
+  {
+    return diagonalMatrix(vertexWeights(policy), 1);
+  }
+
+  /// Computes the global lumped mass matrix tensorized with Id_2, with
+  /// face areas and vertex weights computed in parallel. Same result
+  /// as doubledGlobalLumpedMassMatrix().
+  ///
+  /// @param policy the parallel policy.
+  /// @return the global lumped mass matrix.
+  SparseMatrix doubledGlobalLumpedMassMatrix(const ParallelPolicy & policy) const
+  {
+    return diagonalMatrix(vertexWeights(policy), 2);
+  }
   /// @}
   
   // ----------------------- Cache mechanism --------------------------------------
@@ -1030,6 +1252,15 @@ public:
 
   /// Enable the internal global cache for operators.
   ///
+  /// Cached operators are stored as DenseMatrix, i.e. heap-allocated,
+  /// whatever the face degree: the cache holds operators of
+  /// different shapes (degree x 3, 3 x degree, degree x degree...)
+  /// which the per face services return as DenseMatrix. Storing
+  /// fixed-size blocks for triangles and quads would only move the
+  /// allocation to every cache hit. The parallel assembly
+  /// (globalLaplaceBeltrami(const AssemblyPattern&,double,const ParallelPolicy&))
+  /// therefore computes the operators of these faces with fixed-size
+  /// matrices and only copies them into the cache when it is enabled.
   void enableInternalGlobalCache()
   {
     myGlobalCacheEnabled = true;
@@ -1251,6 +1482,161 @@ protected:
     return RU_fO;
   }
   
+  /// Laplace-Beltrami operator of a face of degree N with fixed-size
+  /// matrices (no heap allocation), computed as laplaceBeltrami(f)
+  /// without the internal cache.
+  /// @tparam N the degree of the face.
+  /// @param f the face
+  /// @param lambda the regularization parameter
+  /// @return a N x N matrix
+  template <int N>
+  Eigen::Matrix<double, N, N> fixedLaplaceBeltrami(const Face f, const double lambda) const
+  {
+    typedef Eigen::Matrix<double, N, 3> MatrixN3;
+    typedef Eigen::Matrix<double, 3, N> Matrix3N;
+    typedef Eigen::Matrix<double, N, N> MatrixNN;
+    const auto & vertices = mySurfaceMesh->incidentVertices(f);
+    MatrixN3 Xf;
+    for (int i = 0; i < N; ++i)
+    {
+      const Real3dPoint x = myEmbedder(f, vertices[i]);
+      Xf(i, 0) = x[0];
+      Xf(i, 1) = x[1];
+      Xf(i, 2) = x[2];
+    }
+    // Edge vectors, edge midpoints, vector area and centroid.
+    MatrixN3 Ef, Bf;
+    Eigen::Vector3d af = Eigen::Vector3d::Zero();
+    for (int i = 0; i < N; ++i)
+    {
+      const int j = (i + 1) % N;
+      Ef.row(i) = Xf.row(j) - Xf.row(i);
+      Bf.row(i) = 0.5 * Xf.row(i) + 0.5 * Xf.row(j);
+      af += Xf.row(i).transpose().cross(Xf.row(j).transpose());
+    }
+    const Eigen::Vector3d va       = 0.5 * af;
+    const double area              = va.norm();
+    const Eigen::Vector3d n        = va.normalized();
+    const Eigen::RowVector3d c     = Xf.colwise().sum() / (double)N;
+    Eigen::Matrix3d brack;
+    brack << 0.0 , -n(2), n(1),
+             n(2), 0.0 , -n(0),
+            -n(1), n(0), 0.0 ;
+    // sharp, flat, P and M operators.
+    const Matrix3N Uf   = 1.0 / area * brack * (Bf.rowwise() - c).transpose();
+    const MatrixN3 flat = Ef * (Eigen::Matrix3d::Identity() - n * n.transpose());
+    const MatrixNN Pf   = MatrixNN::Identity() - flat * Uf;
+    const MatrixNN Mf   = area * Uf.transpose() * Uf + lambda * Pf.transpose() * Pf;
+    MatrixNN Df = MatrixNN::Zero();
+    for (int i = 0; i < N; ++i)
+    {
+      Df(i, i) = -1.;
+      Df(i, (i + 1) % N) = 1.;
+    }
+    return -1.0 * Df.transpose() * Mf * Df;
+  }
+
+  /// Assembles a global operator by summing per face operators into
+  /// the nonzeros of a sparsity pattern. Per face operators are
+  /// computed by chunks of faces, then nonzeros by chunks, both
+  /// dispatched according to @a policy (sequential when the internal
+  /// cache is enabled).
+  ///
+  /// @param pattern the sparsity pattern (see makeAssemblyPattern).
+  /// @param localOperator a functor (Face, double*) writing the operator of a face row by row.
+  /// @param policy the parallel policy.
+  /// @return the global operator.
+  template <typename LocalOperator>
+  SparseMatrix assemble(const AssemblyPattern & pattern,
+                        const LocalOperator & localOperator,
+                        const ParallelPolicy & policy) const
+  {
+    ASSERT(pattern.faceOffsets.size() == mySurfaceMesh->nbFaces() + 1);
+    const ParallelPolicy actualPolicy =
+      myGlobalCacheEnabled ? ParallelPolicy::sequential() : policy;
+    const std::size_t nbChunksPerThread = actualPolicy.isSequential() ? 1 : 8;
+    WorkStealingScheduler scheduler(actualPolicy);
+    // Local operators
+    std::vector<double> local(pattern.faceOffsets.back());
+    const std::size_t nbF = mySurfaceMesh->nbFaces();
+    const std::size_t nbFChunks =
+      std::min<std::size_t>(nbF, nbChunksPerThread * actualPolicy.nbThreads());
+    scheduler.run(nbFChunks, [&] (std::size_t c, unsigned int)
+    {
+      for (std::size_t f = c * nbF / nbFChunks; f < (c + 1) * nbF / nbFChunks; ++f)
+        localOperator((Face)f, local.data() + pattern.faceOffsets[f]);
+    });
+    // Sums per nonzero, in face order.
+    SparseMatrix A         = pattern.matrix;
+    double * values        = A.valuePtr();
+    const std::size_t nnz  = A.nonZeros();
+    const std::size_t nbNZChunks =
+      std::min<std::size_t>(nnz, nbChunksPerThread * actualPolicy.nbThreads());
+    scheduler.run(nbNZChunks, [&] (std::size_t c, unsigned int)
+    {
+      for (std::size_t s = c * nnz / nbNZChunks; s < (c + 1) * nnz / nbNZChunks; ++s)
+      {
+        double sum = 0.0;
+        for (std::size_t k = pattern.nonZeroOffsets[s]; k < pattern.nonZeroOffsets[s + 1]; ++k)
+          sum += local[pattern.contributions[k]];
+        values[s] = sum;
+      }
+    });
+    return A;
+  }
+
+  /// Computes the weights of the lumped mass matrix, i.e. for each
+  /// vertex the sum of faceArea(f)/degree(f) over its incident faces.
+  /// @param policy the parallel policy.
+  /// @return the vector of weights, indexed by vertices.
+  std::vector<double> vertexWeights(const ParallelPolicy & policy) const
+  {
+    const std::size_t nbF = mySurfaceMesh->nbFaces();
+    const std::size_t nbV = mySurfaceMesh->nbVertices();
+    const std::size_t nbChunksPerThread = policy.isSequential() ? 1 : 8;
+    WorkStealingScheduler scheduler(policy);
+    std::vector<double> areas(nbF);
+    const std::size_t nbFChunks = std::min<std::size_t>(nbF, nbChunksPerThread * policy.nbThreads());
+    scheduler.run(nbFChunks, [&] (std::size_t c, unsigned int)
+    {
+      for (std::size_t f = c * nbF / nbFChunks; f < (c + 1) * nbF / nbFChunks; ++f)
+        areas[f] = faceArea((Face)f);
+    });
+    std::vector<double> weights(nbV);
+    const std::size_t nbVChunks = std::min<std::size_t>(nbV, nbChunksPerThread * policy.nbThreads());
+    scheduler.run(nbVChunks, [&] (std::size_t c, unsigned int)
+    {
+      for (std::size_t v = c * nbV / nbVChunks; v < (c + 1) * nbV / nbVChunks; ++v)
+      {
+        auto varea = 0.0;
+        for (auto f : mySurfaceMesh->incidentFaces((Vertex)v))
+          varea += areas[f] / (double)myFaceDegree[f];
+        weights[v] = varea;
+      }
+    });
+    return weights;
+  }
+
+  /// @return the diagonal matrix whose coefficients are the given
+  /// weights, each one repeated @a repeat times.
+  /// @param weights the diagonal weights.
+  /// @param repeat the number of times each weight is repeated.
+  static SparseMatrix diagonalMatrix(const std::vector<double> & weights,
+                                     const std::size_t repeat)
+  {
+    const std::size_t n = repeat * weights.size();
+    SparseMatrix M(n, n);
+    M.resizeNonZeros(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      M.outerIndexPtr()[i] = (typename SparseMatrix::StorageIndex)i;
+      M.innerIndexPtr()[i] = (typename SparseMatrix::StorageIndex)i;
+      M.valuePtr()[i]      = weights[i / repeat];
+    }
+    M.outerIndexPtr()[n] = (typename SparseMatrix::StorageIndex)n;
+    return M;
+  }
+
   /// @return the tensor-kronecker product of M with 2x2 identity matrix
   DenseMatrix kroneckerWithI2(const DenseMatrix & M) const
   {
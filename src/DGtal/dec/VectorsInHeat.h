@@ -41,9 +41,15 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ParallelPolicy.h"
 #include "DGtal/math/linalg/DirichletConditions.h"
+#include "DGtal/math/linalg/SparseLDLTFactorization.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -56,6 +62,11 @@ namespace DGtal
  *
  * see @ref moduleVectorsInHeat for details and examples.
  *
+ * As for GeodesicsInHeat, several sets of sources may be processed at
+ * once with computeBatch(), and the factorizations of init() may be
+ * saved with saveFactorizations() and reloaded with
+ * loadFactorizations().
+ *
  * @tparam a model of PolygonalCalculus.
  */
 template <typename TPolygonalCalculus>
@@ -73,6 +84,10 @@ public:
     typedef typename PolygonalCalculus::LinAlg LinAlgBackend;
     typedef DirichletConditions< LinAlgBackend > Conditions;
     typedef typename Conditions::IntegerVector IntegerVector;
+    typedef SparseLDLTFactorization< LinAlgBackend > Factorization;
+    typedef typename DenseMatrix::Index Index;
+    /// A source: a vertex and a 3D extrinsic vector.
+    typedef std::pair< Vertex, Vector > Source;
 
     /**
      * Default constructor.
@@ -269,6 +284,137 @@ public:
         return result;
     }
 
+    /// Computes the diffused vectors of several sets of sources at
+    /// once. The heat diffusion problems of all the sets are solved
+    /// as multi-column systems with the factorizations of init(), by
+    /// blocks of columns dispatched according to @a policy. The i-th
+    /// result is the one of compute() after adding the i-th set of
+    /// sources with addSource().
+    ///
+    /// @param sources the sets of sources (vertex, 3D extrinsic vector).
+    /// @param policy the parallel policy (sequential by default).
+    /// @returns for each set of sources, the diffused 3D vectors at each vertex.
+    std::vector< std::vector<Vector> >
+    computeBatch( const std::vector< std::vector< Source > >& sources,
+                  const ParallelPolicy& policy = ParallelPolicy::sequential() ) const
+    {
+        FATAL_ERROR_MSG(myIsInit, "init() method must be called first");
+        const Index n = myCalculus->nbVertices();
+        const Index k = sources.size();
+        std::vector< std::vector<Vector> > results( k );
+        if ( k == 0 ) return results;
+
+        // Tangent frames, computed beforehand since the vertex normal
+        // embedder of the calculus may not be thread-safe.
+        std::vector< DenseMatrix > frames( n );
+        for ( Index v = 0; v < n; ++v ) frames[ v ] = myCalculus->Tv( v );
+
+        const std::size_t nbThreads = policy.isSequential() ? 1 : policy.nbThreads();
+        const std::size_t blockSize = policy.isSequential() ? k
+          : std::max< std::size_t >( 1, ( k + 4 * nbThreads - 1 ) / ( 4 * nbThreads ) );
+        const std::size_t nbBlocks  = ( k + blockSize - 1 ) / blockSize;
+        WorkStealingScheduler scheduler( policy );
+        scheduler.run( nbBlocks, [&] ( std::size_t b, unsigned int )
+        {
+          const Index first = b * blockSize;
+          const Index nb    = std::min< Index >( blockSize, k - first );
+          // Vector sources, then scalar sources followed by Dirac sources.
+          DenseMatrix vectorSource = DenseMatrix::Zero( 2 * n, nb );
+          DenseMatrix scalarSource = DenseMatrix::Zero( n, 2 * nb );
+          for ( Index j = 0; j < nb; ++j )
+            for ( const auto & s : sources[ first + j ] )
+              {
+                const auto aV = s.first;
+                ASSERT_MSG(aV < myCalculus->nbVertices(), "Vertex is not in the surface mesh vertex range");
+                Vector v = frames[ aV ].transpose() * s.second;
+                v = v.normalized() * s.second.norm();
+                vectorSource( 2*aV,   j ) = v( 0 );
+                vectorSource( 2*aV+1, j ) = v( 1 );
+                scalarSource( aV, j )      = v.norm();
+                scalarSource( aV, nb + j ) = 1;
+              }
+          //Heat diffusion
+          DenseMatrix vectorHeatDiffusion = myVectorHeatSolver.solve( vectorSource );
+          DenseMatrix scalarHeatDiffusion = myScalarHeatSolver.solve( scalarSource );
+          if ( myManageBoundary )
+            {
+              Vector bValues = Vector::Zero( n );
+              DenseMatrix bNormSources( n - myBoundary.sum(), nb );
+              for ( Index j = 0; j < nb; ++j )
+                bNormSources.col( j ) = Conditions::dirichletVector( myScalarHeatOpe, scalarSource.col( j ),
+                                                                     myBoundary, bValues );
+              DenseMatrix bSol = myHeatDirichletSolver.solve( bNormSources );
+              for ( Index j = 0; j < nb; ++j )
+                scalarHeatDiffusion.col( j ) = 0.5 * ( scalarHeatDiffusion.col( j )
+                                                       + Conditions::dirichletSolution
+                                                       ( bSol.col( j ), myBoundary, bValues ) );
+            }
+          for ( Index j = 0; j < nb; ++j )
+            {
+              std::vector<Vector> & result = results[ first + j ];
+              result.resize( n );
+              for ( Index v = 0; v < n; ++v )
+                {
+                  Vector Y(2);
+                  Y(0) = vectorHeatDiffusion( 2*v,   j );
+                  Y(1) = vectorHeatDiffusion( 2*v+1, j );
+                  Y = Y.normalized() * ( scalarHeatDiffusion( v, j ) / scalarHeatDiffusion( v, nb + j ) );
+                  result[ v ] = frames[ v ].col( 0 ) * Y( 0 ) + frames[ v ].col( 1 ) * Y( 1 );
+                }
+            }
+        } );
+        return results;
+    }
+
+    /// Writes the factorizations computed by init() (and the data
+    /// needed by compute()) in binary form on an output stream, so
+    /// that another instance on the same mesh may skip init().
+    ///
+    /// @param out the output stream (opened in binary mode).
+    /// @return 'true' if the writing was successful.
+    bool saveFactorizations( std::ostream& out ) const
+    {
+        FATAL_ERROR_MSG(myIsInit, "init() method must be called first");
+        const std::int64_t nbV = myCalculus->nbVertices();
+        const std::int64_t boundary = myManageBoundary ? 1 : 0;
+        Factorization::writeValue( out, nbV );
+        Factorization::writeValue( out, boundary );
+        myScalarHeatSolver.save( out );
+        myVectorHeatSolver.save( out );
+        if ( myManageBoundary )
+          {
+            myHeatDirichletSolver.save( out );
+            Factorization::writeSparseMatrix( out, myScalarHeatOpe );
+            Factorization::writeVector( out, myBoundary );
+          }
+        return out.good();
+    }
+
+    /// Reads factorizations written by saveFactorizations(), in place
+    /// of init(). The calculus must be built on the same mesh.
+    ///
+    /// @param in the input stream (opened in binary mode).
+    /// @return 'true' if the reading was successful, in which case
+    /// the object is initialized with empty sources.
+    bool loadFactorizations( std::istream& in )
+    {
+        std::int64_t nbV = -1, boundary = 0;
+        bool ok = Factorization::readValue( in, nbV )
+          && nbV == static_cast< std::int64_t >( myCalculus->nbVertices() )
+          && Factorization::readValue( in, boundary )
+          && myScalarHeatSolver.load( in ) && myScalarHeatSolver.rows() == nbV
+          && myVectorHeatSolver.load( in ) && myVectorHeatSolver.rows() == 2 * nbV;
+        myManageBoundary = ( boundary != 0 );
+        if ( ok && myManageBoundary )
+          ok = myHeatDirichletSolver.load( in )
+            && Factorization::readSparseMatrix( in, myScalarHeatOpe )
+            && Factorization::readVector( in, myBoundary )
+            && myBoundary.rows() == nbV;
+        myIsInit = ok;
+        if ( ok ) clearSource();
+        return ok;
+    }
+
 
     /// @return true if the calculus is valid.
     bool isValid() const
@@ -288,8 +434,8 @@ private:
     SparseMatrix myVectorHeatOpe;
 
     ///Heat solvers
-    Solver myScalarHeatSolver;
-    Solver myVectorHeatSolver;
+    Factorization myScalarHeatSolver;
+    Factorization myVectorHeatSolver;
 
     ///Source vectors
     Vector myScalarSource;
@@ -307,7 +453,7 @@ private:
     bool myIsInit;
 
     ///Heat solver with Dirichlet boundary conditions.
-    Solver myHeatDirichletSolver;
+    Factorization myHeatDirichletSolver;
 
 }; // end of class VectorsInHeat
 } // namespace DGtal
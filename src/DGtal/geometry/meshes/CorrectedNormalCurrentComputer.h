@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelPolicy.h"
 #include "DGtal/math/linalg/EigenDecomposition.h"
 #include "DGtal/geometry/meshes/SurfaceMeshMeasure.h"
 #include "DGtal/geometry/meshes/CorrectedNormalCurrentFormula.h"
@@ -62,6 +63,11 @@ namespace DGtal
      curvature measures, if the mesh has a normal at each vertex,
      otherwise it computes constant corrected curvature measures.
 
+     @note Measures can be computed in parallel by giving a
+     ParallelPolicy. Interpolated measures of triangles are computed
+     by batches (see CorrectedNormalCurrentFormula::TriangleBatch),
+     with the same values as the per face formulas.
+
      @tparam TRealPoint an arbitrary model of RealPoint.
      @tparam TRealVector an arbitrary model of RealVector.
    */
@@ -77,6 +83,7 @@ namespace DGtal
     typedef typename RealVector::Component               Scalar;
     typedef SimpleMatrix< Scalar, dimension, dimension > RealTensor;
     typedef CorrectedNormalCurrentFormula< RealPoint, RealVector > Formula;
+    typedef typename Formula::TriangleBatch              TriangleBatch;
     typedef SurfaceMeshMeasure< RealPoint, RealVector, Scalar >     ScalarMeasure;
     typedef SurfaceMeshMeasure< RealPoint, RealVector, RealTensor > TensorMeasure;
     typedef std::vector< Scalar >                        Scalars;
@@ -101,18 +108,26 @@ namespace DGtal
     CorrectedNormalCurrentComputer( ConstAlias< SurfaceMesh > aMesh,
                                     bool unit_u = false );
 
+    /// @param policy the parallel policy.
     /// @return the \f$ \mu_0 \f$ corrected curvature measure,
     /// i.e. the area measure.
-    ScalarMeasure computeMu0() const;
+    ScalarMeasure computeMu0
+    ( const ParallelPolicy& policy = ParallelPolicy::sequential() ) const;
+    /// @param policy the parallel policy.
     /// @return the \f$ \mu_1 \f$ corrected curvature measure,
     /// i.e. twice the mean curvature measure.
-    ScalarMeasure computeMu1() const;
+    ScalarMeasure computeMu1
+    ( const ParallelPolicy& policy = ParallelPolicy::sequential() ) const;
+    /// @param policy the parallel policy.
     /// @return the \f$ \mu_2 \f$ corrected curvature measure,
     /// i.e. the Gaussian curvature measure.
-    ScalarMeasure computeMu2() const;
+    ScalarMeasure computeMu2
+    ( const ParallelPolicy& policy = ParallelPolicy::sequential() ) const;
+    /// @param policy the parallel policy.
     /// @return the \f$ \mu^{X,Y} \f$ corrected curvature measure,
     /// i.e. the anisotropic tensor curvature measure.
-    TensorMeasure computeMuXY() const;
+    TensorMeasure computeMuXY
+    ( const ParallelPolicy& policy = ParallelPolicy::sequential() ) const;
 
     //-------------------------------------------------------------------------
   public:
@@ -184,47 +199,80 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   protected:
 
+    /// @param policy the parallel policy.
     /// @return the \f$ \mu_0 \f$ corrected curvature measure,
     /// i.e. the area measure, when corrected normals are constant per
     /// face.
     /// @pre `! myMesh.faceNormals().empty()`
-    ScalarMeasure computeMu0ConstantU() const;
+    ScalarMeasure computeMu0ConstantU( const ParallelPolicy& policy ) const;
+    /// @param policy the parallel policy.
     /// @return the \f$ \mu_1 \f$ corrected curvature measure,
     /// i.e. twice the mean curvature measure, when corrected normals
     /// are constant per face.
     /// @pre `! myMesh.faceNormals().empty()`
-    ScalarMeasure computeMu1ConstantU() const;
+    ScalarMeasure computeMu1ConstantU( const ParallelPolicy& policy ) const;
+    /// @param policy the parallel policy.
     /// @return the \f$ \mu_2 \f$ corrected curvature measure,
     /// i.e. the Gaussian curvature measure, when corrected normals
     /// are constant per face.
     /// @pre `! myMesh.faceNormals().empty()`
-    ScalarMeasure computeMu2ConstantU() const;
+    ScalarMeasure computeMu2ConstantU( const ParallelPolicy& policy ) const;
+    /// @param policy the parallel policy.
     /// @return the \f$ \mu^{X,Y} \f$ corrected curvature measure,
     /// i.e. the anisotropic tensor curvature measure, when corrected
     /// normals are constant per face.
     /// @pre `! myMesh.faceNormals().empty()`
-    TensorMeasure computeMuXYConstantU() const;
+    TensorMeasure computeMuXYConstantU( const ParallelPolicy& policy ) const;
 
+    /// @param policy the parallel policy.
     /// @return the \f$ \mu_0 \f$ corrected curvature measure,
     /// i.e. the area measure, when corrected normals are interpolated per
     /// face.
     /// @pre `! myMesh.vertexNormals().empty()`
-    ScalarMeasure computeMu0InterpolatedU() const;
+    ScalarMeasure computeMu0InterpolatedU( const ParallelPolicy& policy ) const;
+    /// @param policy the parallel policy.
     /// @return the \f$ \mu_1 \f$ corrected curvature measure,
     /// i.e. twice the mean curvature measure, when corrected normals
     /// are interpolated per face.
     /// @pre `! myMesh.vertexNormals().empty()`
-    ScalarMeasure computeMu1InterpolatedU() const;
+    ScalarMeasure computeMu1InterpolatedU( const ParallelPolicy& policy ) const;
+    /// @param policy the parallel policy.
     /// @return the \f$ \mu_2 \f$ corrected curvature measure,
     /// i.e. the Gaussian curvature measure, when corrected normals
     /// are interpolated per face.
     /// @pre `! myMesh.vertexNormals().empty()`
-    ScalarMeasure computeMu2InterpolatedU() const;
+    ScalarMeasure computeMu2InterpolatedU( const ParallelPolicy& policy ) const;
+    /// @param policy the parallel policy.
     /// @return the \f$ \mu^{X,Y} \f$ corrected curvature measure,
     /// i.e. the anisotropic tensor curvature measure, when corrected
     /// normals are interpolated per face.
     /// @pre `! myMesh.vertexNormals().empty()`
-    TensorMeasure computeMuXYInterpolatedU() const;
+    TensorMeasure computeMuXYInterpolatedU( const ParallelPolicy& policy ) const;
+
+    /// Computes the measures of all faces when corrected normals are
+    /// interpolated: triangles are gathered in batches, other faces
+    /// are computed one by one.
+    ///
+    /// @param[out] face_mu the measure of each face.
+    /// @param policy the parallel policy.
+    /// @param batch_formula the formula for a batch of triangles,
+    /// called as `batch_formula( T, mu )`.
+    /// @param face_formula the formula for a polygonal face, called
+    /// as `face_formula( pts, u )`.
+    template < typename Value, typename BatchFormula, typename FaceFormula >
+    void computeInterpolatedUFaceMeasures( std::vector< Value >& face_mu,
+                                           const ParallelPolicy& policy,
+                                           BatchFormula batch_formula,
+                                           FaceFormula face_formula ) const;
+
+    /// Calls \a f( b, e ) on the ranges [b,e) of a partition of [0,n),
+    /// in parallel according to \a policy.
+    ///
+    /// @param n the number of elements.
+    /// @param policy the parallel policy.
+    /// @param f the functor called on each range.
+    template < typename RangeFunctor >
+    static void parallelFor( Size n, const ParallelPolicy& policy, RangeFunctor f );
     
     
   }; // end of class CorrectedNormalCurrentComputer
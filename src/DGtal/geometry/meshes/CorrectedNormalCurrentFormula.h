@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <cmath>
 #include <map>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/linalg/SimpleMatrix.h"
@@ -608,6 +609,200 @@ namespace DGtal
     
     /// @}
 
+    //-------------------------------------------------------------------------
+  public:
+    /// @name Formulas for batches of triangles
+    /// @{
+
+    /// Positions and corrected normals of a group of triangles abc,
+    /// stored as a structure of arrays, so that the formulas below
+    /// evaluate many triangles at once with vectorizable loops. Each
+    /// lane gives exactly the same result as the corresponding
+    /// formula on one triangle.
+    struct TriangleBatch
+    {
+      /// The maximal number of triangles in a batch.
+      static const Index capacity = 64;
+      /// x[ 3*i+k ][ l ] is the k-th coordinate of the i-th vertex
+      /// (a, b or c) of the l-th triangle.
+      alignas( 64 ) Scalar x[ 9 ][ capacity ];
+      /// u[ 3*i+k ][ l ] is the k-th coordinate of the corrected
+      /// normal vector at the i-th vertex of the l-th triangle.
+      alignas( 64 ) Scalar u[ 9 ][ capacity ];
+      /// The number of triangles in the batch.
+      Index size = 0;
+
+      /// @return 'true' if no more triangle can be added.
+      bool full() const
+      {
+        return size == capacity;
+      }
+
+      /// Removes all triangles.
+      void clear()
+      {
+        size = 0;
+      }
+
+      /// Adds triangle abc with corrected normal vectors \a ua, \a ub, \a uc.
+      /// @pre `! full()`
+      void push_back( const RealPoint& a, const RealPoint& b, const RealPoint& c,
+                      const RealVector& ua, const RealVector& ub, const RealVector& uc )
+      {
+        ASSERT( size < capacity );
+        for ( Dimension k = 0; k < 3; ++k )
+          {
+            x[ k ][ size ] = a[ k ]; x[ 3+k ][ size ] = b[ k ]; x[ 6+k ][ size ] = c[ k ];
+            u[ k ][ size ] = ua[ k ]; u[ 3+k ][ size ] = ub[ k ]; u[ 6+k ][ size ] = uc[ k ];
+          }
+        ++size;
+      }
+    };
+
+    /// Computes the mu0 measures of the triangles of a batch, as
+    /// mu0InterpolatedU(const RealPoint&,const RealPoint&,const RealPoint&,const RealVector&,const RealVector&,const RealVector&,bool).
+    /// @param T a batch of triangles with interpolated corrected normals.
+    /// @param[out] mu the array of the `T.size` measures.
+    /// @param unit_u when 'true' interpolated corrected normals are made unitary.
+    static
+    void mu0InterpolatedU( const TriangleBatch& T, Scalar* mu, bool unit_u = false )
+    {
+      for ( Index l = 0; l < T.size; ++l )
+        {
+          Scalar m0 = ( T.u[ 0 ][ l ] + T.u[ 3 ][ l ] + T.u[ 6 ][ l ] ) / 3.0;
+          Scalar m1 = ( T.u[ 1 ][ l ] + T.u[ 4 ][ l ] + T.u[ 7 ][ l ] ) / 3.0;
+          Scalar m2 = ( T.u[ 2 ][ l ] + T.u[ 5 ][ l ] + T.u[ 8 ][ l ] ) / 3.0;
+          if ( unit_u )
+            {
+              const Scalar n = std::sqrt( m0 * m0 + m1 * m1 + m2 * m2 );
+              const Scalar d = n == 0.0 ? 1.0 : n;
+              m0 /= d; m1 /= d; m2 /= d;
+            }
+          const Scalar ab0 = T.x[ 3 ][ l ] - T.x[ 0 ][ l ];
+          const Scalar ab1 = T.x[ 4 ][ l ] - T.x[ 1 ][ l ];
+          const Scalar ab2 = T.x[ 5 ][ l ] - T.x[ 2 ][ l ];
+          const Scalar ac0 = T.x[ 6 ][ l ] - T.x[ 0 ][ l ];
+          const Scalar ac1 = T.x[ 7 ][ l ] - T.x[ 1 ][ l ];
+          const Scalar ac2 = T.x[ 8 ][ l ] - T.x[ 2 ][ l ];
+          mu[ l ] = 0.5 * ( ( ab1 * ac2 - ab2 * ac1 ) * m0
+                            + ( ab2 * ac0 - ab0 * ac2 ) * m1
+                            + ( ab0 * ac1 - ab1 * ac0 ) * m2 );
+        }
+    }
+
+    /// Computes the mu1 measures of the triangles of a batch, as
+    /// mu1InterpolatedU(const RealPoint&,const RealPoint&,const RealPoint&,const RealVector&,const RealVector&,const RealVector&,bool).
+    /// @param T a batch of triangles with interpolated corrected normals.
+    /// @param[out] mu the array of the `T.size` measures.
+    /// @param unit_u when 'true' interpolated corrected normals are made unitary.
+    static
+    void mu1InterpolatedU( const TriangleBatch& T, Scalar* mu, bool unit_u = false )
+    {
+      for ( Index l = 0; l < T.size; ++l )
+        {
+          Scalar m0 = ( T.u[ 0 ][ l ] + T.u[ 3 ][ l ] + T.u[ 6 ][ l ] ) / 3.0;
+          Scalar m1 = ( T.u[ 1 ][ l ] + T.u[ 4 ][ l ] + T.u[ 7 ][ l ] ) / 3.0;
+          Scalar m2 = ( T.u[ 2 ][ l ] + T.u[ 5 ][ l ] + T.u[ 8 ][ l ] ) / 3.0;
+          if ( unit_u )
+            {
+              const Scalar n = std::sqrt( m0 * m0 + m1 * m1 + m2 * m2 );
+              m0 /= n; m1 /= n; m2 /= n;
+            }
+          // < uM x d | p > for d = uc-ub, ua-uc, ub-ua and p = a, b, c.
+          Scalar s[ 3 ];
+          for ( Index i = 0; i < 3; ++i )
+            {
+              const Index  i1 = 3 * ( ( i + 1 ) % 3 ), i2 = 3 * ( ( i + 2 ) % 3 );
+              const Scalar d0 = T.u[ i2 ][ l ]     - T.u[ i1 ][ l ];
+              const Scalar d1 = T.u[ i2 + 1 ][ l ] - T.u[ i1 + 1 ][ l ];
+              const Scalar d2 = T.u[ i2 + 2 ][ l ] - T.u[ i1 + 2 ][ l ];
+              s[ i ] = ( m1 * d2 - m2 * d1 ) * T.x[ 3 * i ][ l ]
+                + ( m2 * d0 - m0 * d2 ) * T.x[ 3 * i + 1 ][ l ]
+                + ( m0 * d1 - m1 * d0 ) * T.x[ 3 * i + 2 ][ l ];
+            }
+          mu[ l ] = 0.5 * ( s[ 0 ] + s[ 1 ] + s[ 2 ] );
+        }
+    }
+
+    /// Computes the mu2 measures of the triangles of a batch, as
+    /// mu2InterpolatedU(const RealPoint&,const RealPoint&,const RealPoint&,const RealVector&,const RealVector&,const RealVector&,bool).
+    /// @param T a batch of triangles with interpolated corrected normals.
+    /// @param[out] mu the array of the `T.size` measures.
+    /// @param unit_u when 'true' interpolated corrected normals are
+    /// made unitary (spherical triangles are then computed one by one).
+    static
+    void mu2InterpolatedU( const TriangleBatch& T, Scalar* mu, bool unit_u = false )
+    {
+      if ( unit_u )
+        {
+          for ( Index l = 0; l < T.size; ++l )
+            {
+              const RealVector ua( T.u[ 0 ][ l ], T.u[ 1 ][ l ], T.u[ 2 ][ l ] );
+              const RealVector ub( T.u[ 3 ][ l ], T.u[ 4 ][ l ], T.u[ 5 ][ l ] );
+              const RealVector uc( T.u[ 6 ][ l ], T.u[ 7 ][ l ], T.u[ 8 ][ l ] );
+              mu[ l ] = mu2InterpolatedU( RealPoint(), RealPoint(), RealPoint(),
+                                          ua, ub, uc, true );
+            }
+          return;
+        }
+      for ( Index l = 0; l < T.size; ++l )
+        {
+          const Scalar w0 = T.u[ 1 ][ l ] * T.u[ 5 ][ l ] - T.u[ 2 ][ l ] * T.u[ 4 ][ l ];
+          const Scalar w1 = T.u[ 2 ][ l ] * T.u[ 3 ][ l ] - T.u[ 0 ][ l ] * T.u[ 5 ][ l ];
+          const Scalar w2 = T.u[ 0 ][ l ] * T.u[ 4 ][ l ] - T.u[ 1 ][ l ] * T.u[ 3 ][ l ];
+          mu[ l ] = 0.5 * ( w0 * T.u[ 6 ][ l ] + w1 * T.u[ 7 ][ l ] + w2 * T.u[ 8 ][ l ] );
+        }
+    }
+
+    /// Computes the muXY measures of the triangles of a batch, as
+    /// muXYInterpolatedU(const RealPoint&,const RealPoint&,const RealPoint&,const RealVector&,const RealVector&,const RealVector&,bool).
+    /// @param T a batch of triangles with interpolated corrected normals.
+    /// @param[out] mu the array of the `T.size` measures.
+    /// @param unit_u when 'true' interpolated corrected normals are made unitary.
+    static
+    void muXYInterpolatedU( const TriangleBatch& T, RealTensor* mu, bool unit_u = false )
+    {
+      const Index n = T.size;
+      alignas( 64 ) Scalar uM [ 3 ][ TriangleBatch::capacity ];
+      alignas( 64 ) Scalar tij[ TriangleBatch::capacity ];
+      for ( Dimension k = 0; k < 3; ++k )
+        for ( Index l = 0; l < n; ++l )
+          uM[ k ][ l ] = ( T.u[ k ][ l ] + T.u[ 3+k ][ l ] + T.u[ 6+k ][ l ] ) / 3.0;
+      if ( unit_u )
+        for ( Index l = 0; l < n; ++l )
+          {
+            const Scalar nm = std::sqrt( uM[ 0 ][ l ] * uM[ 0 ][ l ] + uM[ 1 ][ l ] * uM[ 1 ][ l ]
+                                         + uM[ 2 ][ l ] * uM[ 2 ][ l ] );
+            uM[ 0 ][ l ] /= nm; uM[ 1 ][ l ] /= nm; uM[ 2 ][ l ] /= nm;
+          }
+      // With X the i-th basis vector, X x v = -v[i2] e_i1 + v[i1] e_i2,
+      // hence tij = 1/2 ( uM[i1] Z[i1] + uM[i2] Z[i2] ) with
+      // Z = uac[j] X x ab - uab[j] X x ac.
+      for ( Dimension i = 0; i < 3; ++i )
+        {
+          const Dimension i1 = ( i + 1 ) % 3, i2 = ( i + 2 ) % 3;
+          for ( Dimension j = 0; j < 3; ++j )
+            {
+              for ( Index l = 0; l < n; ++l )
+                {
+                  const Scalar uac = T.u[ 6+j ][ l ] - T.u[ j ][ l ];
+                  const Scalar uab = T.u[ 3+j ][ l ] - T.u[ j ][ l ];
+                  const Scalar Z1  = uac * -( T.x[ 3+i2 ][ l ] - T.x[ i2 ][ l ] )
+                    - uab * -( T.x[ 6+i2 ][ l ] - T.x[ i2 ][ l ] );
+                  const Scalar Z2  = uac * ( T.x[ 3+i1 ][ l ] - T.x[ i1 ][ l ] )
+                    - uab * ( T.x[ 6+i1 ][ l ] - T.x[ i1 ][ l ] );
+                  const Scalar t1  = uM[ i1 ][ l ] * Z1;
+                  const Scalar t2  = uM[ i2 ][ l ] * Z2;
+                  tij[ l ] = 0.5 * ( t1 + t2 );
+                }
+              for ( Index l = 0; l < n; ++l )
+                mu[ l ].setComponent( i, j, tij[ l ] );
+            }
+        }
+    }
+
+    /// @}
+
     
     //-------------------------------------------------------------------------
   public:
@@ -41,8 +41,11 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <vector>
+#include <algorithm>
+#include "DGtal/base/ParallelPolicy.h"
 #include "DGtal/kernel/CCommutativeRing.h"
 #include "DGtal/shapes/SurfaceMesh.h"
+#include "DGtal/shapes/SurfaceMeshSpatialIndex.h"
 
 namespace DGtal
 {
@@ -74,6 +77,17 @@ namespace DGtal
      SurfaceMeshMeasure::edgeMeasure, SurfaceMeshMeasure::faceMeasure,
      with potential weights.
 
+     The measures of many balls of the same radius, e.g. centered on
+     every vertex or every face, are computed in parallel by
+     SurfaceMeshMeasure::measures, SurfaceMeshMeasure::vertexMeasures
+     and SurfaceMeshMeasure::faceMeasures, optionally with a
+     SurfaceMeshSpatialIndex that can be reused across radii.
+
+     \code
+     SurfaceMeshSpatialIndex< RealPoint, RealVector > index( myMesh );
+     auto areas = mu0.vertexMeasures( r, ParallelPolicy::threads(), &index );
+     \endcode
+
      @tparam TRealPoint an arbitrary model of RealPoint.
      @tparam TRealVector an arbitrary model of RealVector.
      @tparam TValue an arbitrary model of CCommutativeRing
@@ -112,6 +126,7 @@ namespace DGtal
     typedef std::vector< WeightedVertex >  WeightedVertices;
     typedef std::vector< WeightedEdge >    WeightedEdges;
     typedef std::vector< WeightedFace >    WeightedFaces;
+    typedef SurfaceMeshSpatialIndex< RealPoint, RealVector > SpatialIndex;
     static const Dimension dimension = RealPoint::dimension;
 
     // ------------------------- Standard services ------------------------------
@@ -191,6 +206,86 @@ namespace DGtal
           return m;
         }
     }
+
+    /// Computes the total measures on the balls of radius \a r
+    /// centered on the given points, in parallel. The center \a
+    /// centers[ i ] must lie on or close to the face \a faces[ i ],
+    /// as in \ref measure( const RealPoint&, Scalar, Face ) const,
+    /// which gives the same results. Each thread reuses its own query
+    /// buffers.
+    ///
+    /// @param centers the centers of the balls.
+    /// @param faces for each ball, the face where its center lies (a
+    /// ball whose face is not valid has a zero measure, unless \a
+    /// index is given).
+    /// @param r the radius of the balls.
+    /// @param policy the parallel policy.
+    /// @param index if not null, a spatial index of the mesh, used to
+    /// find the cells intersecting each ball instead of traversing
+    /// the mesh from its face (see SurfaceMeshSpatialIndex).
+    /// @return the measure of each ball.
+    Values measures( const std::vector< RealPoint >& centers, const Faces& faces,
+                     Scalar r,
+                     const ParallelPolicy& policy = ParallelPolicy::sequential(),
+                     const SpatialIndex* index = nullptr ) const
+    {
+      ASSERT( centers.size() == faces.size() );
+      ASSERT( index == nullptr || index->meshPtr() == myMeshPtr );
+      const Size n = centers.size();
+      Values result( n, myZero );
+      const std::size_t nb_chunks = std::min< std::size_t >
+        ( n, policy.isSequential() ? 1 : 8 * policy.nbThreads() );
+      std::vector< QueryBuffers > buffers( policy.nbThreads() );
+      WorkStealingScheduler scheduler( policy );
+      scheduler.run( nb_chunks, [&] ( std::size_t c, unsigned int t )
+        {
+          for ( Size i = c * n / nb_chunks; i < ( c + 1 ) * n / nb_chunks; ++i )
+            result[ i ] = ballMeasure( centers[ i ], r, faces[ i ], index, buffers[ t ] );
+        } );
+      return result;
+    }
+
+    /// Computes the total measures on the balls of radius \a r
+    /// centered on each vertex, in parallel (see \ref measures).
+    ///
+    /// @param r the radius of the balls.
+    /// @param policy the parallel policy.
+    /// @param index if not null, a spatial index of the mesh.
+    /// @return the measure of the ball of each vertex.
+    Values vertexMeasures( Scalar r,
+                           const ParallelPolicy& policy = ParallelPolicy::sequential(),
+                           const SpatialIndex* index = nullptr ) const
+    {
+      Faces faces( myMeshPtr->nbVertices() );
+      for ( Vertex v = 0; v < faces.size(); ++v )
+        {
+          const auto& inc_f = myMeshPtr->incidentFaces( v );
+          faces[ v ] = inc_f.empty() ? myMeshPtr->nbFaces() : inc_f.front();
+        }
+      return measures( myMeshPtr->positions(), faces, r, policy, index );
+    }
+
+    /// Computes the total measures on the balls of radius \a r
+    /// centered on the centroid of each face, in parallel (see \ref
+    /// measures).
+    ///
+    /// @param r the radius of the balls.
+    /// @param policy the parallel policy.
+    /// @param index if not null, a spatial index of the mesh.
+    /// @return the measure of the ball of each face.
+    Values faceMeasures( Scalar r,
+                         const ParallelPolicy& policy = ParallelPolicy::sequential(),
+                         const SpatialIndex* index = nullptr ) const
+    {
+      std::vector< RealPoint > centers( myMeshPtr->nbFaces() );
+      Faces faces( myMeshPtr->nbFaces() );
+      for ( Face f = 0; f < faces.size(); ++f )
+        {
+          centers[ f ] = myMeshPtr->faceCentroid( f );
+          faces  [ f ] = f;
+        }
+      return measures( centers, faces, r, policy, index );
+    }
       
     /// @param v any vertex index.
     /// @return its measure.
@@ -290,6 +385,51 @@ namespace DGtal
     const SurfaceMesh* myMeshPtr;
     /// Zero value for the given type.
     Value myZero;
+
+    // ------------------------- Internals ------------------------------------
+  protected:
+    /// The buffers of a thread for computing measures of balls.
+    struct QueryBuffers
+    {
+      typename SurfaceMesh::BallQueryBuffers ball;
+      Vertices      vertices;
+      WeightedEdges edges;
+      WeightedFaces faces;
+    };
+
+    /// Computes the total measure on the ball of center \a x and
+    /// radius \a r with the given buffers.
+    ///
+    /// @param x the position where the ball is centered.
+    /// @param r the radius of the ball.
+    /// @param f the face where center point \a x lies.
+    /// @param index if not null, a spatial index of the mesh.
+    /// @param buffers the buffers of the calling thread.
+    Value ballMeasure( const RealPoint& x, Scalar r, Face f,
+                       const SpatialIndex* index, QueryBuffers& buffers ) const
+    {
+      // Tiny balls are reduced to face f, which requires the traversal.
+      const bool use_index = index != nullptr && r >= 0.000001;
+      if ( ! use_index && f >= myMeshPtr->nbFaces() ) return myZero;
+      if ( vertex_measures.empty() && edge_measures.empty() )
+        {
+          if ( use_index )
+            index->computeFacesInclusionsInBall( r, x, buffers.ball, buffers.faces );
+          else
+            myMeshPtr->computeFacesInclusionsInBall( r, f, x, buffers.ball, buffers.faces );
+          return faceMeasure( buffers.faces );
+        }
+      if ( use_index )
+        index->computeCellsInclusionsInBall( r, x, buffers.ball, buffers.vertices,
+                                             buffers.edges, buffers.faces );
+      else
+        myMeshPtr->computeCellsInclusionsInBall( r, f, x, buffers.ball, buffers.vertices,
+                                                 buffers.edges, buffers.faces );
+      Value m = vertexMeasure( buffers.vertices );
+      m      += edgeMeasure  ( buffers.edges );
+      m      += faceMeasure  ( buffers.faces );
+      return m;
+    }
   };
 
   
@@ -0,0 +1,384 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+#pragma once
+
+/**
+ * @file DigitalSurfaceFFTConvolver.h
+ * @brief Computes, with Fast Fourier Transforms, the convolution of a
+ * nD-shape with a kernel and its moments on all the surfels of a range.
+ *
+ * @date 2026/10/17
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see DigitalSurfaceConvolver.h IntegralInvariantVolumeEstimator.h
+ * IntegralInvariantCovarianceEstimator.h
+ */
+
+#if defined(DigitalSurfaceFFTConvolver_RECURSES)
+#error Recursive header files inclusion detected in DigitalSurfaceFFTConvolver.h
+#else // defined(DigitalSurfaceFFTConvolver_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSurfaceFFTConvolver_RECURSES
+
+#if !defined DigitalSurfaceFFTConvolver_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSurfaceFFTConvolver_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <complex>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/math/linalg/SimpleMatrix.h"
+#ifdef WITH_FFTW3
+#include "DGtal/math/RealFFT.h"
+#endif
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /**
+   * Methods of computation of the convolutions of the integral
+   * invariant estimators on a range of surfels.
+   *
+   * - INCREMENTAL: DigitalSurfaceConvolver, the kernel sums are
+   *   updated from one surfel to the next one with difference masks.
+   * - FFT: DigitalSurfaceFFTConvolver, the convolutions are computed
+   *   once for all the surfels of the range with Fast Fourier Transforms.
+   */
+  enum class IIConvolutionMethod { INCREMENTAL, FFT };
+
+  namespace detail
+  {
+    /**
+     * Description of template class 'FFTCorrelator' <p>
+     * \brief Aim: cyclic correlation of a real signal with several
+     * real kernels, sharing the transform of the signal.
+     *
+     * The result of correlate() at position p is
+     * \f$ \sum_q s(p+q) g(q) \f$ where the positions are taken modulo
+     * the extent of the cyclic domain.
+     *
+     * Transforms are computed by RealFFT (hence FFTW3) when DGtal is
+     * built WITH_FFTW3, and otherwise by a radix-2 complex transform,
+     * the extents being then rounded up to powers of two.
+     *
+     * @tparam TSpace the digital space (model of concepts::CSpace).
+     */
+    template < typename TSpace >
+    class FFTCorrelator
+    {
+    public:
+      typedef TSpace Space;
+      typedef typename Space::Point Point;
+      typedef HyperRectDomain<Space> Domain;
+      typedef std::complex<double> Complex;
+
+      /**
+       * Constructor.
+       * @param aMinimalExtent the minimal extent of the cyclic domain.
+       */
+      FFTCorrelator( const Point & aMinimalExtent );
+
+      /// @return the extent of the cyclic domain.
+      const Point & extent() const { return myExtent; }
+
+      /**
+       * @param aPoint a point of the cyclic domain [0,extent()).
+       * @return the index of @a aPoint in the signal and kernel buffers.
+       */
+      std::size_t index( const Point & aPoint ) const;
+
+      /// Sets the signal to zero.
+      void clearSignal();
+
+      /**
+       * @param i an index given by index().
+       * @return a reference on the value of the signal at @a i.
+       */
+      double & signal( std::size_t i );
+
+      /// Computes the transform of the signal, must be called once the
+      /// signal is filled and before correlate().
+      void transformSignal();
+
+      /// Sets the kernel to zero.
+      void clearKernel();
+
+      /**
+       * @param i an index given by index().
+       * @return a reference on the value of the kernel at @a i.
+       */
+      double & kernel( std::size_t i );
+
+      /// Computes the correlation of the signal with the kernel.
+      void correlate();
+
+      /**
+       * @param i an index given by index().
+       * @return the value at @a i of the last correlation.
+       */
+      double result( std::size_t i ) const;
+
+    private:
+#ifdef WITH_FFTW3
+      Point myExtent;                   ///< Extent of the cyclic domain.
+      RealFFT<Domain, double> mySignal; ///< Signal, then its transform.
+      RealFFT<Domain, double> myKernel; ///< Kernel, its transform, then the correlation.
+      std::size_t myRowSize;            ///< Number of reals of a (padded) row along dimension 0.
+      std::size_t myStorageSize;        ///< Number of reals of a buffer.
+#else
+      Point myExtent;                   ///< Extent of the cyclic domain (powers of two).
+      std::vector<Complex> mySignal;    ///< Signal, then its transform.
+      std::vector<Complex> myKernel;    ///< Kernel, its transform, then the correlation.
+
+      /**
+       * In-place nD complex transform.
+       * @param data the values, first dimension varying the fastest.
+       * @param inverse if true, computes the (non normalized) inverse transform.
+       */
+      void transform( std::vector<Complex> & data, bool inverse ) const;
+#endif
+    }; // end of class FFTCorrelator
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSurfaceFFTConvolver
+  /**
+   * Description of template class 'DigitalSurfaceFFTConvolver' <p>
+   * \brief Aim: Computes the convolution of a digital shape with a
+   * digital kernel, and the moments of order up to 2 of their
+   * intersection, for all the surfels of a range at once.
+   *
+   * It gives the same quantities as DigitalSurfaceConvolver: for each
+   * surfel, the kernel is centered on the inner and outer spels of
+   * the surfel, and the result is the average of the two values. But
+   * instead of summing the kernel over the shape for each surfel, the
+   * characteristic function of the shape, restricted to the bounding
+   * box of the range enlarged by the kernel, is correlated with the
+   * kernel (volume) and with the kernel times the monomials
+   * \f$ x_i \f$ and \f$ x_i x_j \f$ (moments) by Fast Fourier
+   * Transforms, then sampled at the centers. The cost no longer grows
+   * with the kernel size for each surfel, which pays when the kernel
+   * is large and the range covers a large part of the surface.
+   *
+   * The moments are taken with respect to the center of the kernel,
+   * so that they are integers, and correlations are rounded: volumes
+   * are exactly the ones of DigitalSurfaceConvolver, and covariance
+   * matrices are equal up to rounding errors.
+   *
+   * @code
+   * DigitalSurfaceFFTConvolver<KSpace, ShapePointFunctor> convolver( shapeFunctor, K );
+   * convolver.init( digitalKernel );
+   * convolver.evalCovarianceMatrix( surfels.begin(), surfels.end(), output, functor );
+   * @endcode
+   *
+   * @tparam TKSpace a model of CCellularGridSpaceND, the cellular
+   * space in which the shape is defined (non-periodic).
+   * @tparam TShapeFunctor a functor Point -> value (0 outside the
+   * shape, 1 inside), e.g. functors::PointFunctorFromPointPredicateAndDomain.
+   *
+   * @see IntegralInvariantVolumeEstimator IntegralInvariantCovarianceEstimator
+   */
+  template < typename TKSpace, typename TShapeFunctor >
+  class DigitalSurfaceFFTConvolver
+  {
+  public:
+    typedef DigitalSurfaceFFTConvolver<TKSpace, TShapeFunctor> Self;
+    typedef TKSpace KSpace;
+    typedef TShapeFunctor ShapeFunctor;
+    typedef typename KSpace::Space Space;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::SCell SCell;
+    typedef typename KSpace::Surfel Surfel;
+    typedef HyperRectDomain<Space> Domain;
+    typedef detail::FFTCorrelator<Space> Correlator;
+
+    static const Dimension dimension = KSpace::dimension;
+    /// Number of moments of order up to 2.
+    static const unsigned int nbMoments = 1 + dimension + dimension * ( dimension + 1 ) / 2;
+
+    typedef double Quantity;
+    typedef SimpleMatrix< double, dimension, dimension > CovarianceMatrix;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param[in] aShapeFunctor the characteristic function of the shape.
+     * @param[in] aKSpace the cellular grid space in which the shape is defined.
+     */
+    DigitalSurfaceFFTConvolver( ConstAlias< ShapeFunctor > aShapeFunctor,
+                                ConstAlias< KSpace > aKSpace );
+
+    /**
+     * Sets the kernel.
+     *
+     * @tparam TDigitalKernel a digital shape providing getDomain() and
+     * a point predicate operator() (e.g. GaussDigitizer).
+     * @param[in] aKernel the kernel, centered on the origin.
+     */
+    template < typename TDigitalKernel >
+    void init( const TDigitalKernel & aKernel );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Convolves the shape with the kernel for a range of surfels.
+     *
+     * @tparam SurfelIterator a forward iterator on surfels.
+     * @tparam OutputIterator an output iterator on the results of @a functor.
+     * @tparam EvalFunctor a functor Quantity -> value.
+     *
+     * @param[in] itbegin the first surfel of the range.
+     * @param[in] itend the surfel after the last one.
+     * @param[in,out] result the output iterator, receives one value per surfel.
+     * @param[in] functor the functor applied to each convolution.
+     */
+    template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+    void eval( const SurfelIterator & itbegin,
+               const SurfelIterator & itend,
+               OutputIterator & result,
+               EvalFunctor functor ) const;
+
+    /**
+     * Computes the covariance matrices of the intersection of the
+     * shape with the kernel for a range of surfels.
+     *
+     * @tparam SurfelIterator a forward iterator on surfels.
+     * @tparam OutputIterator an output iterator on the results of @a functor.
+     * @tparam EvalFunctor a functor CovarianceMatrix -> value.
+     *
+     * @param[in] itbegin the first surfel of the range.
+     * @param[in] itend the surfel after the last one.
+     * @param[in,out] result the output iterator, receives one value per surfel.
+     * @param[in] functor the functor applied to each covariance matrix.
+     */
+    template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+    void evalCovarianceMatrix( const SurfelIterator & itbegin,
+                               const SurfelIterator & itend,
+                               OutputIterator & result,
+                               EvalFunctor functor ) const;
+
+    /**
+     * @return the extent of the cyclic domain of the last
+     * convolutions, or zero before any convolution.
+     */
+    const Point & lastTransformExtent() const
+    {
+      return myLastTransformExtent;
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private methods ------------------------------
+  private:
+
+    /**
+     * Computes the first moments at the inner and outer spels of the
+     * surfels of a range.
+     *
+     * @param[in] itbegin the first surfel of the range.
+     * @param[in] itend the surfel after the last one.
+     * @param[in] aNbMoments the number of moments to compute (1 for
+     * the volume only, nbMoments for the covariance matrix).
+     * @param[out] moments the moments, @a aNbMoments values for the
+     * inner spel then for the outer spel of each surfel.
+     */
+    template< typename SurfelIterator >
+    void computeMoments( const SurfelIterator & itbegin,
+                         const SurfelIterator & itend,
+                         unsigned int aNbMoments,
+                         std::vector<Quantity> & moments ) const;
+
+    /**
+     * @param m the index of a moment.
+     * @param q a vector.
+     * @return the monomial of index @a m taken at @a q: 1, then the
+     * coordinates, then the products of two coordinates.
+     */
+    double monomial( unsigned int m, const Point & q ) const;
+
+    /**
+     * @param[in] moments the moments at some spel.
+     * @param[out] aMatrix the covariance matrix.
+     */
+    void computeCovarianceMatrix( const Quantity * moments,
+                                  CovarianceMatrix & aMatrix ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The characteristic function of the shape.
+    const ShapeFunctor * myShapeFunctor;
+    /// The cellular grid space.
+    const KSpace * myKSpace;
+    /// The points of the kernel.
+    std::vector<Point> myKernelPoints;
+    /// Lower bound of the kernel points.
+    Point myKernelLower;
+    /// Upper bound of the kernel points.
+    Point myKernelUpper;
+    /// Coordinates of the monomials of order 2.
+    std::vector< std::pair<Dimension, Dimension> > mySecondOrder;
+    /// Extent of the cyclic domain of the last convolutions.
+    mutable Point myLastTransformExtent;
+
+  }; // end of class DigitalSurfaceFFTConvolver
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSurfaceFFTConvolver'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSurfaceFFTConvolver' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TKSpace, typename TShapeFunctor >
+  std::ostream&
+  operator<< ( std::ostream & out, const DigitalSurfaceFFTConvolver<TKSpace, TShapeFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/DigitalSurfaceFFTConvolver.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSurfaceFFTConvolver_h
+
+#undef DigitalSurfaceFFTConvolver_RECURSES
+#endif // else defined(DigitalSurfaceFFTConvolver_RECURSES)
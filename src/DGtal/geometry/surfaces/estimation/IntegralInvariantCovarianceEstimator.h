@@ -56,6 +56,7 @@
 #include "DGtal/shapes/Shapes.h"
 
 #include "DGtal/geometry/surfaces/DigitalSurfaceConvolver.h"
+#include "DGtal/geometry/surfaces/DigitalSurfaceFFTConvolver.h"
 #include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
 #include "DGtal/shapes/EuclideanShapesDecorator.h"
 
@@ -84,7 +85,10 @@ namespace DGtal
 * confirm the multigrid convergence.
 *
 * Optimization is available when we give a range of 0-adjacent
-* surfels to the estimator. Note that you should use
+* surfels to the estimator. For large kernels, the range version of
+* eval can instead compute all the convolutions at once with Fast
+* Fourier Transforms (see setConvolutionMethod and
+* DigitalSurfaceFFTConvolver). Note that you should use
 * IntegralInvariantVolumeEstimator instead when trying to estimate the
 * 2D curvature or the mean curvature.
 *
@@ -155,6 +159,7 @@ public:
 
   typedef DigitalSurfaceConvolver<ShapeSpelFunctor, KernelSpelFunctor, 
                                   KSpace, DigitalShapeKernel> Convolver;
+  typedef DigitalSurfaceFFTConvolver<KSpace, ShapePointFunctor> FFTConvolver;
   typedef typename Convolver::PairIterators PairIterators;
   typedef typename Convolver::CovarianceMatrix Matrix;
   typedef typename Matrix::Component Component;
@@ -247,6 +252,21 @@ public:
   template <typename SurfelConstIterator>
   void init( const double _h, SurfelConstIterator itb, SurfelConstIterator ite );
 
+  /**
+  * Selects how the range version of eval computes the convolutions:
+  * IIConvolutionMethod::INCREMENTAL (default, DigitalSurfaceConvolver)
+  * or IIConvolutionMethod::FFT (DigitalSurfaceFFTConvolver). The
+  * estimation at a single surfel always uses DigitalSurfaceConvolver.
+  * DigitalSurfaceFFTConvolver is only created (at init, or here if
+  * init was already called) when IIConvolutionMethod::FFT is selected.
+  *
+  * @param[in] aMethod the convolution method.
+  */
+  void setConvolutionMethod( IIConvolutionMethod aMethod );
+
+  /// @return the convolution method of the range version of eval.
+  IIConvolutionMethod convolutionMethod() const;
+
   /**
   * -- Estimation -- 
   *
@@ -302,6 +322,16 @@ public:
   */
   bool isValid() const;
 
+  // ------------------------- Internals ------------------------------------
+private:
+
+  /**
+  * Creates the convolver by Fast Fourier Transforms and sets its
+  * kernel. It is only called when IIConvolutionMethod::FFT is
+  * selected, so that the incremental method does not pay for it.
+  */
+  void initFFTConvolver();
+
   // ------------------------- Private Datas --------------------------------
 private:
 
@@ -316,6 +346,9 @@ private:
   CountedPtr<ShapePointFunctor>  myShapePointFunctor; ///< Smart pointer on functor point -> {0,1}
   CountedPtr<ShapeSpelFunctor>   myShapeSpelFunctor;  ///< Smart pointer on functor spel ->  {0,1}
   CountedPtr<Convolver>          myConvolver;   ///< Convolver
+  CountedPtr<FFTConvolver>       myFFTConvolver; ///< Convolver by Fast Fourier Transforms (created only for IIConvolutionMethod::FFT)
+  CountedConstPtrOrConstPtr<KSpace> myKSpace;   ///< Smart pointer (if required) on the cellular grid space.
+  IIConvolutionMethod            myMethod;      ///< Convolution method of the range version of eval
   Scalar myH;                               ///< precision of the grid
   Scalar myRadius;                          ///< "digital" radius of the kernel (but may be non integer).
 
@@ -43,10 +43,14 @@
 #include <iostream>
 #include <string>
 #include <vector>
+#include <array>
 #include <queue>
-#include <set>
+#include <limits>
+#include <type_traits>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Clock.h"
+#include "DGtal/base/ParallelPolicy.h"
+#include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/geometry/tools/QuickHullKernels.h"
 
 namespace DGtal
@@ -134,6 +138,15 @@ namespace DGtal
   /// @note However this implementation is not tailored for incremental
   /// dynamic convex hull computations.
   ///
+  /// @note The assignment of points to facets may be spread over the
+  /// threads of a ParallelPolicy given to computeConvexHull. Points
+  /// are then processed by chunks of at least `parallel_grain` points,
+  /// and the output does not depend on the number of threads. When the
+  /// internal scalar of the kernel is not a native number (e.g.
+  /// BigInteger), heights of points are first approximated with
+  /// floating-point numbers during the assignment, the exact kernel
+  /// being called only when the sign of the approximation is uncertain.
+  ///
   /// @tparam TKernel any type of QuickHull kernel, like ConvexHullIntegralKernel.
   template < typename TKernel >
   struct QuickHull
@@ -150,19 +163,48 @@ namespace DGtal
     typedef typename Kernel::HalfSpace HalfSpace;
     typedef typename Kernel::CombinatorialPlaneSimplex CombinatorialPlaneSimplex;
     static const Size  dimension  = Point::dimension;
+    /// Minimal number of points processed by a task when point
+    /// assignment is done in parallel.
+    static const Size  parallel_grain = 4096;
+    /// When 'true', point assignment filters the exact height
+    /// computations with floating-point approximations (only useful
+    /// when exact computations are slow).
+    static const bool  filtered_heights = ! std::is_arithmetic< InternalScalar >::value;
 
     /// Label for points that are not assigned to any facet.
     enum { UNASSIGNED = (Index) -1 };
 
+    /// A floating-point approximation of the half-space of a facet,
+    /// with a bound on the error of the heights it computes for the
+    /// input points.
+    struct FilteredHalfSpace {
+      std::array< double, dimension > N; ///< the approximated normal vector
+      double c = 0.0;      ///< the approximated intercept
+      double error = 0.0;  ///< the bound on the error of approximated heights
+    };
+
+    /// Statistics of the last culling of interior points (see
+    /// cullInteriorPoints).
+    struct CullingStatistics {
+      Size nb_input_points = 0; ///< number of points before culling
+      Size nb_row_culled = 0; ///< number of points culled as interior to their row
+      Size nb_octahedron_culled = 0; ///< number of points culled as interior to the octahedron
+      double time = 0.0; ///< time spent in culling (in ms)
+      /// @return the total number of culled points.
+      Size nbCulled() const
+      { return nb_row_culled + nb_octahedron_culled; }
+    };
+
     /// A facet is d-1 dimensional convex cell lying on the boundary
     /// of a full dimensional convex set. Its supporting hyperplane
     /// defines an half-space touching and enclosing the convex set.
     struct Facet {
       HalfSpace  H; ///< the facet geometry
+      FilteredHalfSpace approx; ///< the approximated facet geometry
       IndexRange neighbors;   ///< neighbor facets
       IndexRange outside_set; ///< outside set, i.e. points above this facet
       IndexRange on_set;      ///< on set, i.e. points on this facet, *sorted*
-      Index below; ///< index of point that is below this facet
+      Index below = UNASSIGNED; ///< index of point that is below this facet (UNASSIGNED if deleted)
 
       Facet() = default;
       Facet( const Facet& ) = default;
@@ -215,6 +257,7 @@ namespace DGtal
       {
         if ( this != &other ) {
           std::swap( H, other.H );
+          std::swap( approx, other.approx );
           neighbors.swap  ( other.neighbors );
           outside_set.swap( other.outside_set );
           on_set.swap     ( other.on_set );
@@ -223,7 +266,7 @@ namespace DGtal
       }
       Size variableMemory() const
       {
-        Size M;
+        Size M = 0;
         M += neighbors.capacity()   * sizeof( Index );
         M += outside_set.capacity() * sizeof( Index );
         M += on_set.capacity()      * sizeof( Index );
@@ -280,6 +323,8 @@ namespace DGtal
       p2v.clear();
       v2p.clear();
       timings.clear();
+      culling_statistics = CullingStatistics();
+      myCoordinateBound = 0.0;
     }
 
     
@@ -304,9 +349,9 @@ namespace DGtal
       M += sizeof( std::vector< Facet > )
         + facets.capacity() * sizeof( Facet );
       for ( const auto& f : facets ) M += f.variableMemory();
-      // std::set< Index > deleted_facets;
-      M += sizeof( std::set< Index > )
-        + deleted_facets.size() * ( sizeof( Index ) + 2*sizeof(Index*) );
+      // IndexRange deleted_facets;
+      M += sizeof( std::vector< Index > )
+        + deleted_facets.capacity() * sizeof( Index );
       // IndexRange p2v;
       M += sizeof( std::vector< Index > )
         + p2v.capacity() * sizeof( Index );
@@ -388,6 +433,11 @@ namespace DGtal
       timings.clear();
       kernel.makeInput( points, input2comp,  comp2input,
                         input_points, remove_duplicates );
+      myCoordinateBound = 0.0;
+      for ( const auto& p : points )
+        for ( Dimension k = 0; k < dimension; k++ )
+          myCoordinateBound = std::max( myCoordinateBound,
+                                        std::fabs( NumberTraits< Scalar >::castToDouble( p[ k ] ) ) );
       timings.push_back( tic.stopClock() );
       if ( points.size() <= dimension ) {
         myStatus = Status::NotFullDimensional;
@@ -397,6 +447,60 @@ namespace DGtal
       return true;
     }
 
+    /// Removes from the input points some points that cannot be
+    /// vertices of the convex hull (Akl-Toussaint heuristic), in
+    /// order to speed up the convex hull computation of dense point
+    /// sets. Two passes are made:
+    ///
+    /// - if the points are dense, i.e. their bounding box has at most
+    ///   as many rows along its longest axis as there are points, only
+    ///   the two extremal points of each row are kept (linear time);
+    ///
+    /// - the points strictly inside the octahedron spanned by the
+    ///   points with extremal coordinates along each axis are removed.
+    ///
+    /// Facets and vertices of the convex hull are unchanged, but the
+    /// culled input points are mapped to UNASSIGNED in `input2comp`.
+    /// Does nothing for kernels with infinite facets (like Delaunay
+    /// kernels), since all their input points are vertices.
+    ///
+    /// @pre status() must be Status::InputInitialized
+    ///
+    /// @return the number of culled points, which is detailed in
+    /// `culling_statistics`.
+    Size cullInteriorPoints()
+    {
+      culling_statistics = CullingStatistics();
+      if ( status() != Status::InputInitialized || kernel.hasInfiniteFacets() )
+        return 0;
+      Clock tic;
+      tic.startClock();
+      const Size n = points.size();
+      std::vector< char > culled( n, 0 );
+      culling_statistics.nb_input_points      = n;
+      culling_statistics.nb_row_culled        = cullRowInteriorPoints( culled );
+      culling_statistics.nb_octahedron_culled = cullOctahedronInteriorPoints( culled );
+      if ( culling_statistics.nbCulled() != 0 )
+        { // Compacts points and updates the input/output mappings.
+          IndexRange old2new( n, UNASSIGNED );
+          Index j = 0;
+          for ( Index i = 0; i < n; i++ )
+            if ( ! culled[ i ] )
+              {
+                old2new   [ i ] = j;
+                points    [ j ] = points[ i ];
+                comp2input[ j ] = comp2input[ i ];
+                j++;
+              }
+          points.resize( j );
+          comp2input.resize( j );
+          for ( auto& i : input2comp ) i = old2new[ i ];
+        }
+      culling_statistics.time = tic.stopClock();
+      if ( points.size() <= dimension ) myStatus = Status::NotFullDimensional;
+      return culling_statistics.nbCulled();
+    }
+
     /// Sets the initial full dimensional simplex
     ///
     /// @pre status() must be Status::InputInitialized
@@ -404,10 +508,14 @@ namespace DGtal
     /// @param full_splx a `dimension+1`-simplex specified as indices in the
     /// vector of input point.
     ///
+    /// @param policy the parallel policy used to assign points to the
+    /// facets of the simplex.
+    ///
     /// @return 'true' iff this initial simplex is full dimensional,
     /// the object has then the status SimplexCompleted, otherwise
     /// returns 'false' and the status is NotFullDimensional.
-    bool setInitialSimplex( const IndexRange& full_splx )
+    bool setInitialSimplex( const IndexRange& full_splx,
+                            const ParallelPolicy& policy = ParallelPolicy() )
     {
       if ( status() != Status::InputInitialized ) return false;
       if ( full_splx.size() != dimension + 1 )
@@ -423,7 +531,7 @@ namespace DGtal
       const auto      H = kernel.compute( points, splx, full_splx.back() );
       const auto volume = kernel.volume( H, points[ full_splx.back() ] );
       if ( volume > 0 )
-        return computeSimplexConfiguration( full_splx );
+        return computeSimplexConfiguration( full_splx, policy );
       myStatus = Status::NotFullDimensional;
       return false;
     }
@@ -454,10 +562,14 @@ namespace DGtal
     /// @param[in] target the computation target in Status::SimplexCompleted,
     /// Status::FacetsCompleted, Status::VerticesCompleted.
     ///
+    /// @param[in] policy the parallel policy used to assign points to
+    /// facets (the result does not depend on it).
+    ///
     /// @return 'true' if the computation target has been successfully
     /// achieved, 'false' if the achieved status is not the one
     /// specified.
-    bool computeConvexHull( Status target = Status::VerticesCompleted )
+    bool computeConvexHull( Status target = Status::VerticesCompleted,
+                            const ParallelPolicy& policy = ParallelPolicy() )
     {
       if ( target < Status::InputInitialized || target > Status::AllCompleted )
         return false;
@@ -465,7 +577,7 @@ namespace DGtal
       if ( status() == Status::InputInitialized )
         { // Initialization
           tic.startClock();
-          bool ok1 = computeInitialSimplex();
+          bool ok1 = computeInitialSimplex( policy );
           timings.push_back( tic.stopClock() );
           if ( ! ok1 )              return false;
           if ( status() == target ) return true;
@@ -473,7 +585,7 @@ namespace DGtal
       if ( status() == Status::SimplexCompleted )
         { // Computes facets
           tic.startClock();
-          bool ok2 = computeFacets();
+          bool ok2 = computeFacets( policy );
           timings.push_back( tic.stopClock() );
           if ( ! ok2 )              return false;
           if ( status() == target ) return true;
@@ -498,17 +610,20 @@ namespace DGtal
   
     /// Computes the initial full dimensional simplex from the input data.
     ///
+    /// @param[in] policy the parallel policy used to assign points to
+    /// the facets of the simplex.
+    ///
     /// @return 'true' iff the input data contains d+1 points in general
     /// position, the object has then the status SimplexCompleted, otherwise
     /// returns 'false' and the status is NotFullDimensional.
-    bool computeInitialSimplex()
+    bool computeInitialSimplex( const ParallelPolicy& policy = ParallelPolicy() )
     {
       const auto full_simplex = pickInitialSimplex();
       if ( full_simplex.empty() ) {
         myStatus = Status::NotFullDimensional;
         return false;
       }
-      return computeSimplexConfiguration( full_simplex );
+      return computeSimplexConfiguration( full_simplex, policy );
     }
 
     /// Computes the facets of the convex hull using Quickhull
@@ -518,16 +633,19 @@ namespace DGtal
     /// @pre the status shoud be Status::SimplexCompleted
     /// (computeInitialSimplex should have been called).
     ///
+    /// @param[in] policy the parallel policy used to look for the
+    /// furthest points and to assign points to new facets.
+    ///
     /// @return 'true' except if the status is not Initialized when
     /// called.
-    bool computeFacets()
+    bool computeFacets( const ParallelPolicy& policy = ParallelPolicy() )
     {
       if ( status() != Status::SimplexCompleted ) return false;
       std::queue< Index > Q;
       for ( Index fi = 0; fi < facets.size(); ++fi )
         Q.push( fi );
       Index n = 0;
-      while ( processFacet( Q ) ) {
+      while ( processFacet( Q, policy ) ) {
         if ( debug_level >= 1 )
           trace.info() << "---- Iteration " << n++ << " #Q=" << Q.size() << std::endl;
       }
@@ -745,7 +863,7 @@ namespace DGtal
       Size   nb = 0;
       Size nbok = 0;
       for ( Index f = 0; f < facets.size(); ++f )
-        if ( deleted_facets.count( f ) == 0 ) {
+        if ( ! isFacetDeleted( f ) ) {
           bool ok = checkFacet( f );
           nbok   += ok ? 1 : 0;
           nb     += 1;
@@ -766,7 +884,7 @@ namespace DGtal
       for ( auto v : processed_points ) {
         bool ok = true;
         for ( Index f = 0; f < facets.size(); ++f )
-          if ( deleted_facets.count( f ) == 0 ) {
+          if ( ! isFacetDeleted( f ) ) {
             if ( above( facets[ f ], points[ v ] ) ) {
               ok = false;
               trace.error() << "- bad vertex " << v << " " << points[ v ]
@@ -812,8 +930,8 @@ namespace DGtal
     std::vector< Index > assignment;
     /// the current set of facets.
     std::vector< Facet > facets;
-    /// set of deleted facets
-    std::set< Index > deleted_facets;
+    /// indices of deleted facets, which are reused by new facets.
+    IndexRange deleted_facets;
     /// point index -> vertex index (or UNASSIGNED)
     IndexRange p2v;
     /// vertex index -> point index
@@ -824,6 +942,8 @@ namespace DGtal
     Size nb_infinite_facets;
     /// Timings of the different phases: 0: init, 1: facets, 2: vertices.
     std::vector< double > timings;
+    /// Statistics of the last call to cullInteriorPoints.
+    CullingStatistics culling_statistics;
     /// Counts the number of facets with a given number of vertices.
     std::vector< Size > facet_counter;
     
@@ -837,6 +957,10 @@ namespace DGtal
     /// SimplexCompleted, FacetsCompleted, VerticesCompleted,
     /// InvalidRidge, InvalidConvexHull, NotFullDimensional
     Status myStatus;
+    /// The maximal absolute value of the coordinates of points.
+    double myCoordinateBound = 0.0;
+    /// Marks of facets, used when extracting visible facets.
+    std::vector< char > myFacetMarks;
   
     /// @}
     // --------------------- protected services --------------------------
@@ -844,6 +968,141 @@ namespace DGtal
     /// @name protected services
     /// @{
 
+    /// Culls the points lying strictly between the two extremal
+    /// points of their row along the longest axis of the bounding box,
+    /// provided points are dense in their bounding box.
+    ///
+    /// @param[in,out] culled the flags of culled points, which are updated.
+    /// @return the number of points culled by this pass.
+    Size cullRowInteriorPoints( std::vector< char >& culled ) const
+    {
+      const Size n = points.size();
+      if ( n <= 2 * dimension ) return 0;
+      Point lo = points[ 0 ];
+      Point up = points[ 0 ];
+      for ( const auto& p : points ) { lo = lo.inf( p ); up = up.sup( p ); }
+      Dimension a = 0;
+      for ( Dimension k = 1; k < dimension; k++ )
+        if ( up[ k ] - lo[ k ] > up[ a ] - lo[ a ] ) a = k;
+      // Rows are indexed by their coordinates other than a.
+      std::array< Size, dimension > stride;
+      double nb_rows = 1.0;
+      for ( Dimension k = 0; k < dimension; k++ )
+        {
+          stride[ k ] = ( k == a ) ? 0 : Size( nb_rows );
+          if ( k != a )
+            nb_rows *= NumberTraits< Scalar >::castToDouble( up[ k ] - lo[ k ] ) + 1.0;
+        }
+      if ( nb_rows > double( n ) ) return 0;
+      const auto row = [&] ( const Point& p ) -> Size
+      {
+        Size r = 0;
+        for ( Dimension k = 0; k < dimension; k++ )
+          if ( k != a )
+            r += stride[ k ]
+              * Size( NumberTraits< Scalar >::castToDouble( p[ k ] - lo[ k ] ) );
+        return r;
+      };
+      std::vector< Scalar > row_min( Size( nb_rows ), up[ a ] );
+      std::vector< Scalar > row_max( Size( nb_rows ), lo[ a ] );
+      for ( const auto& p : points )
+        {
+          const Size r = row( p );
+          if ( p[ a ] < row_min[ r ] ) row_min[ r ] = p[ a ];
+          if ( p[ a ] > row_max[ r ] ) row_max[ r ] = p[ a ];
+        }
+      Size nb = 0;
+      for ( Index i = 0; i < n; i++ )
+        {
+          const Size r = row( points[ i ] );
+          if ( row_min[ r ] < points[ i ][ a ] && points[ i ][ a ] < row_max[ r ] )
+            {
+              culled[ i ] = 1;
+              nb++;
+            }
+        }
+      return nb;
+    }
+
+    /// Culls the points that are not culled yet and that lie strictly
+    /// inside the octahedron spanned by the points with extremal
+    /// coordinates along each axis. Nothing is culled if this
+    /// octahedron is degenerated or not convex.
+    ///
+    /// @param[in,out] culled the flags of culled points, which are updated.
+    /// @return the number of points culled by this pass.
+    Size cullOctahedronInteriorPoints( std::vector< char >& culled ) const
+    {
+      const Size n = points.size();
+      if ( n <= 2 * dimension ) return 0;
+      // E[ 2k ] (resp. E[ 2k+1 ]) is a point with minimal (resp. maximal) k-th coordinate.
+      std::array< Index, 2 * dimension > E;
+      E.fill( UNASSIGNED );
+      for ( Index i = 0; i < n; i++ )
+        {
+          if ( culled[ i ] ) continue;
+          const Point& p = points[ i ];
+          for ( Dimension k = 0; k < dimension; k++ )
+            {
+              if ( E[ 2*k ]   == UNASSIGNED || p[ k ] < points[ E[ 2*k ] ][ k ] )
+                E[ 2*k ]   = i;
+              if ( E[ 2*k+1 ] == UNASSIGNED || p[ k ] > points[ E[ 2*k+1 ] ][ k ] )
+                E[ 2*k+1 ] = i;
+            }
+        }
+      // The octahedron with vertices -e_k, +e_k gives the orientation
+      // of the 2^d facets, each one choosing a min or max point per axis.
+      std::vector< Point > ref( 2 * dimension, Point::zero );
+      for ( Dimension k = 0; k < dimension; k++ )
+        {
+          ref[ 2*k   ][ k ] = -1;
+          ref[ 2*k+1 ][ k ] =  1;
+        }
+      std::vector< HalfSpace > H;    // the facets of the octahedron
+      std::vector< bool >      outer;// 'true' iff the normal of H is outward
+      for ( Size m = 0; m < ( Size( 1 ) << dimension ); m++ )
+        {
+          CombinatorialPlaneSimplex ref_splx, splx;
+          for ( Dimension k = 0; k < dimension; k++ )
+            {
+              ref_splx[ k ] = 2*k + ( ( m >> k ) & 1 );
+              splx    [ k ] = E[ ref_splx[ k ] ];
+            }
+          const auto ref_H = kernel.compute( ref, ref_splx );
+          const auto Hm    = kernel.compute( points, splx );
+          const bool out   = kernel.height( ref_H, Point::zero ) < 0;
+          // Every extremal point must be inside or on the facet, and
+          // their barycenter must be strictly inside.
+          InternalScalar s = 0;
+          for ( auto e : E )
+            {
+              const InternalScalar h = kernel.height( Hm, points[ e ] );
+              if ( out ? ( h > 0 ) : ( h < 0 ) ) return 0;
+              s += h;
+            }
+          if ( out ? ( s >= 0 ) : ( s <= 0 ) ) return 0;
+          H.push_back( Hm );
+          outer.push_back( out );
+        }
+      Size nb = 0;
+      for ( Index i = 0; i < n; i++ )
+        {
+          if ( culled[ i ] ) continue;
+          bool inside = true;
+          for ( Size j = 0; inside && j < H.size(); j++ )
+            {
+              const InternalScalar h = kernel.height( H[ j ], points[ i ] );
+              inside = outer[ j ] ? ( h < 0 ) : ( h > 0 );
+            }
+          if ( inside )
+            {
+              culled[ i ] = 1;
+              nb++;
+            }
+        }
+      return nb;
+    }
+
     /// @param F any valid facet
     /// @param p any point
     /// @return the height of p wrt F (0: on, >0: above ).
@@ -867,6 +1126,66 @@ namespace DGtal
     /// @return 'true' iff p lies on F.
     bool on( const Facet& F, const Point& p ) const
     { return kernel.on( F.H, p ); }
+
+    /// @param F any valid facet
+    /// @param p any point
+    /// @return the approximated height of p wrt F, which differs from
+    /// the exact height by at most `F.approx.error`.
+    double approximateHeight( const Facet& F, const Point& p ) const
+    {
+      double h = -F.approx.c;
+      for ( Dimension k = 0; k < dimension; k++ )
+        h += F.approx.N[ k ] * NumberTraits< Scalar >::castToDouble( p[ k ] );
+      return h;
+    }
+
+    /// Same as above, but the exact kernel is only called when the
+    /// approximated height of p is too close to zero (if
+    /// `filtered_heights` is 'true').
+    /// @param F any valid facet
+    /// @param p any point
+    /// @return 'true' iff p is above F.
+    bool filteredAbove( const Facet& F, const Point& p ) const
+    {
+      if ( ! filtered_heights ) return above( F, p );
+      const double h = approximateHeight( F, p );
+      if ( h >   F.approx.error ) return true;
+      if ( h < - F.approx.error ) return false;
+      return above( F, p );
+    }
+
+    /// @param f any facet index
+    /// @return 'true' iff the facet \a f has been deleted.
+    bool isFacetDeleted( Index f ) const
+    { return facets[ f ].below == UNASSIGNED; }
+
+    /// @param n a number of points.
+    /// @param policy a parallel policy.
+    /// @return the number of chunks of points used to process \a n
+    /// points in parallel with \a policy.
+    static Size nbChunks( Size n, const ParallelPolicy& policy )
+    {
+      return policy.isSequential() ? 1
+        : std::max< Size >( 1, std::min< Size >( n / parallel_grain,
+                                                 8 * policy.nbThreads() ) );
+    }
+
+    /// Splits the range [0,n) into nbChunks( n, policy ) consecutive
+    /// chunks and calls `f( c, b, e )` for each chunk `c` of range
+    /// [b,e), with the threads of \a policy.
+    /// @param n a number of points.
+    /// @param policy a parallel policy.
+    /// @param f a functor called for each chunk.
+    template < typename ChunkFunction >
+    static void forEachChunk( Size n, const ParallelPolicy& policy,
+                              const ChunkFunction& f )
+    {
+      const Size nb = nbChunks( n, policy );
+      if ( nb == 1 ) { f( 0, 0, n ); return; }
+      WorkStealingScheduler scheduler( policy );
+      scheduler.run( nb, [&] ( std::size_t c, unsigned int )
+                     { f( c, c * n / nb, ( c + 1 ) * n / nb ); } );
+    }
     
     /// Cleans and renumber the facets so that no one belongs to
     /// deleted_facets.
@@ -877,7 +1196,7 @@ namespace DGtal
       Index i = 0;
       Index j = 0;
       for ( auto& l : renumbering ) {
-        if ( ! deleted_facets.count( j ) ) l = i++;
+        if ( ! isFacetDeleted( j ) ) l = i++;
         else l = UNASSIGNED;
         j++;
       }
@@ -885,7 +1204,7 @@ namespace DGtal
       deleted_facets.clear();
       for ( Index f = 0; f < facets.size(); f++ )
         if ( ( renumbering[ f ] != UNASSIGNED ) && ( f != renumbering[ f ] ) )
-          facets[ renumbering[ f ] ] = facets[ f ];
+          facets[ renumbering[ f ] ].swap( facets[ f ] );
       facets.resize( nf );
       for ( auto& F : facets ) {
         for ( auto& N : F.neighbors ) {
@@ -963,17 +1282,21 @@ namespace DGtal
     /// @param[inout] Q a queue of facet index to process. which is
     /// updated by the method.
     ///
+    /// @param[in] policy the parallel policy used to look for the
+    /// furthest point and to assign points to new facets.
+    ///
     /// @return 'true' if there is still work to do, 'false' when finished
     ///
     /// @note Core of Quickhull algorithm.
-    bool processFacet( std::queue< Index >& Q )
+    bool processFacet( std::queue< Index >& Q,
+                       const ParallelPolicy& policy = ParallelPolicy() )
     {
       // If Q empty, we are done
       if ( Q.empty() ) return false;
       Index F = Q.front();
       Q.pop();
       // If F is already deleted, proceed to next in queue.
-      if ( deleted_facets.count( F ) ) return true;
+      if ( isFacetDeleted( F ) ) return true;
       // Take car of current facet.
       const Facet& facet = facets[ F ];
       if ( debug_level >= 3 ) {
@@ -981,7 +1304,7 @@ namespace DGtal
         trace.info() << "---- ACTIVE FACETS---------------------------" << std::endl;
         bool ok = true;
         for ( Index i = 0; i < facets.size(); i++ )
-          if ( ! deleted_facets.count( i ) ) {
+          if ( ! isFacetDeleted( i ) ) {
             trace.info() << "- facet " << i << " ";
             facets[ i ].display( trace.info() );
             ok = ok && checkFacet( i );
@@ -998,36 +1321,34 @@ namespace DGtal
       }
       if ( facet.outside_set.empty() ) return true;
       // Selects furthest vertex
-      Index  furthest_v = facet.outside_set[ 0 ];
-      auto   furthest_h = height( facet, points[ furthest_v ] );
-      for ( Index v = 1; v < facet.outside_set.size(); v++ ) {
-        auto h = height( facet, points[ facet.outside_set[ v ] ] );
-        if ( h > furthest_h ) {
-          furthest_h = h;
-          furthest_v = facet.outside_set[ v ];
-        }
-      }
+      const Index  furthest_v = furthestPoint( facet, policy );
       const Point& p = points[ furthest_v ];
       // Extracts Visible facets V and Horizon Ridges H
       std::vector< Index > V;   // visible facets
-      std::set< Index >    M;   // marked facets (are in E or were in E)
+      IndexRange           M;   // marked facets (are in E or were in E)
       std::queue< Index >  E;   // queue to extract visible facets
       std::vector< Ridge > H;   // visible facets
-      E.push  ( F );
-      M.insert( F );
+      myFacetMarks.resize( facets.size(), 0 );
+      E.push     ( F );
+      M.push_back( F );
+      myFacetMarks[ F ] = 1;
       while ( ! E.empty() ) {
         Index G = E.front(); E.pop();
         V.push_back( G );
         for ( auto& N : facets[ G ].neighbors ) {
           if ( aboveOrOn( facets[ N ], p ) ) {
-            if ( M.count( N ) ) continue;
+            if ( myFacetMarks[ N ] ) continue;
             E.push( N );
           } else {
             H.push_back( { G, N } );
           }
-          M.insert( N );
+          if ( ! myFacetMarks[ N ] ) {
+            M.push_back( N );
+            myFacetMarks[ N ] = 1;
+          }
         }
       } // while ( ! E.empty() ) 
+      for ( auto G : M ) myFacetMarks[ G ] = 0;
       if ( debug_level >= 1 ) {
         trace.info() << "#Visible=" << V.size() << " #Horizon=" << H.size()
                   << " furthest_v=" << furthest_v << std::endl;
@@ -1057,9 +1378,7 @@ namespace DGtal
           }                    
           Index nf = newFacet();
           new_facets.push_back( nf );
-          facets[ nf ] = makeFacet( base, facets[ H[i].first ].below );
-          facets[ nf ].on_set = IndexRange { base.cbegin(), base.cend() };
-          std::sort( facets[ nf ].on_set.begin(), facets[ nf ].on_set.end() );
+          setFacet( facets[ nf ], base, facets[ H[i].first ].below );
           makeNeighbors( nf, H[ i ].second );
           if ( debug_level >= 3 ) {
             trace.info() << "* New facet " << nf << " ";
@@ -1101,28 +1420,37 @@ namespace DGtal
           }
         }
       }
-      // For each new facet F'
-      for ( Index i = 0; i < new_facets.size(); i++ ) {
-        Facet& Fp = facets[ new_facets[ i ] ];
-        Index max_j = outside_pts.size();
-        for ( Index j = 0; j < max_j; ) {
-          const Index v = outside_pts[ j ];
-          if ( above( Fp, points[ v ] ) ) {
-            Fp.outside_set.push_back( v );
-            assignment[ v ]  = new_facets[ i ];
-            outside_pts[ j ] = outside_pts.back();
-            outside_pts.pop_back();
-            max_j--;
-          } else j++;
-        }
-        if ( debug_level >= 3 ) {
-          trace.info() << "- New facet " << new_facets[ i ] << " ";
-          Fp.display( trace.info() );
+      // Each outside point is assigned to the first new facet F'
+      // below it (by chunks of points), otherwise it is processed.
+      IndexRange target( outside_pts.size() );
+      forEachChunk( outside_pts.size(), policy,
+                    [&] ( Size, Size b, Size e )
+                    {
+                      for ( Index j = b; j < e; j++ ) {
+                        const Point& q = points[ outside_pts[ j ] ];
+                        target[ j ] = UNASSIGNED;
+                        for ( auto nf : new_facets )
+                          if ( filteredAbove( facets[ nf ], q ) ) {
+                            target[ j ] = nf;
+                            break;
+                          }
+                      }
+                    } );
+      processed_points.push_back( furthest_v );
+      for ( Index j = 0; j < outside_pts.size(); j++ ) {
+        const Index v  = outside_pts[ j ];
+        assignment[ v ] = target[ j ];
+        if ( target[ j ] != UNASSIGNED )
+          facets[ target[ j ] ].outside_set.push_back( v );
+        else
+          processed_points.push_back( v );
+      }
+      if ( debug_level >= 3 ) {
+        for ( auto nf : new_facets ) {
+          trace.info() << "- New facet " << nf << " ";
+          facets[ nf ].display( trace.info() );
         }
       }
-      // Update processed points
-      processed_points.push_back( furthest_v );
-      for ( auto v : outside_pts ) processed_points.push_back( v );
       
       // Delete the facets in V
       for ( auto&& v : V ) {
@@ -1204,10 +1532,15 @@ namespace DGtal
       return ok;
     }
   
-    /// @return an unused facet index
+    /// @return an unused facet index, which is a deleted facet if any
+    /// (so that its allocated ranges are reused).
     Index newFacet()
     {
-      // SLightly faster to postpone deletion of intermediate facets.
+      if ( ! deleted_facets.empty() ) {
+        const Index f = deleted_facets.back();
+        deleted_facets.pop_back();
+        return f;
+      }
       const Index f = facets.size();
       facets.push_back( Facet() );
       return f;
@@ -1219,7 +1552,7 @@ namespace DGtal
     {
       for ( auto n : facets[ f ].neighbors )
         facets[ n ].subNeighbor( f );
-      deleted_facets.insert( f );
+      deleted_facets.push_back( f );
       facets[ f ].clear();
     }
 
@@ -1306,20 +1639,67 @@ namespace DGtal
     /// Builds a facet from a base convex set of at least d different
     /// points and a point below.
     ///
+    /// @param[out] F a cleared facet, whose normal and c parameter are
+    /// set such as the points of \a base lies on the facet hyperplane
+    /// while point \a below lies under. Its on set is the sorted
+    /// range \a base.
+    ///
     /// @param[in] base a range containing at least d distinct points
     /// in general position.
     ///
     /// @param[in] below a point below the hyperplane containing \a simplex.
-    ///
-    /// @return a facet object of normal and c parameter such as the
-    /// points of \a simplex lies on the facet hyperplane while point \a
-    /// below lies under.
-    Facet makeFacet( const IndexRange& base, Index below ) const
+    void setFacet( Facet& F, const IndexRange& base, Index below ) const
     {
       CombinatorialPlaneSimplex simplex;
       for ( Size i = 0; i < dimension; i++ ) simplex[ i ] = base[ i ];
-      auto plane = kernel.compute( points, simplex, below );
-      return Facet( plane, below );
+      F.H     = kernel.compute( points, simplex, below );
+      F.below = below;
+      F.on_set.assign( base.cbegin(), base.cend() );
+      std::sort( F.on_set.begin(), F.on_set.end() );
+      // The rounding errors of the conversions, products and sums of
+      // approximateHeight are below (d+4) eps sum_k |N_k p_k| + |c|.
+      const auto& N = F.H.internalNormal();
+      F.approx.c    = NumberTraits< InternalScalar >::castToDouble( F.H.internalIntercept() );
+      double      M = std::fabs( F.approx.c );
+      for ( Dimension k = 0; k < dimension; k++ ) {
+        F.approx.N[ k ] = NumberTraits< InternalScalar >::castToDouble( N[ k ] );
+        M += std::fabs( F.approx.N[ k ] ) * myCoordinateBound;
+      }
+      F.approx.error = ( dimension + 4 ) * std::numeric_limits< double >::epsilon() * M;
+    }
+
+    /// @param[in] F any valid facet with a non empty outside set.
+    /// @param[in] policy the parallel policy used to look for the point.
+    /// @return the first point of the outside set of \a F that is the
+    /// furthest from \a F.
+    Index furthestPoint( const Facet& F, const ParallelPolicy& policy ) const
+    {
+      const IndexRange& O  = F.outside_set;
+      IndexRange furthest( nbChunks( O.size(), policy ) );
+      forEachChunk( O.size(), policy,
+                    [&] ( Size c, Size b, Size e )
+                    {
+                      Index  furthest_v = O[ b ];
+                      auto   furthest_h = height( F, points[ furthest_v ] );
+                      for ( Index v = b + 1; v < e; v++ ) {
+                        auto h = height( F, points[ O[ v ] ] );
+                        if ( h > furthest_h ) {
+                          furthest_h = h;
+                          furthest_v = O[ v ];
+                        }
+                      }
+                      furthest[ c ] = furthest_v;
+                    } );
+      Index  furthest_v = furthest[ 0 ];
+      auto   furthest_h = height( F, points[ furthest_v ] );
+      for ( Index c = 1; c < furthest.size(); c++ ) {
+        auto h = height( F, points[ furthest[ c ] ] );
+        if ( h > furthest_h ) {
+          furthest_h = h;
+          furthest_v = furthest[ c ];
+        }
+      }
+      return furthest_v;
     }
 
     /// @param[in] R a ridge between two facets (a pair of facets).
@@ -1448,12 +1828,17 @@ namespace DGtal
     /// terminate with Status::SimplexCompleted if everything went
     /// well.
     ///
+    /// @param[in] full_simplex the indices of d+1 points.
+    /// @param[in] policy the parallel policy used to assign points to facets.
+    ///
     /// @return 'true' iff the input data contains d+1 points in general
     /// position, the object has then the status SimplexCompleted, otherwise
     /// returns 'false' and the status is NotFullDimensional.
-    bool computeSimplexConfiguration( const IndexRange& full_simplex )
+    bool computeSimplexConfiguration( const IndexRange& full_simplex,
+                                      const ParallelPolicy& policy = ParallelPolicy() )
     {
       assignment = std::vector< Index >( points.size(), UNASSIGNED );
+      facets.clear();
       facets.resize( dimension + 1 );
       deleted_facets.clear();
       for ( Index j = 0; j < full_simplex.size(); ++j )
@@ -1467,25 +1852,38 @@ namespace DGtal
               isimplex[ s ] = full_simplex[ i ];
               s++;
             }
-          facets[ j ] = makeFacet( isimplex, full_simplex[ j ] );
+          setFacet( facets[ j ], isimplex, full_simplex[ j ] );
           facets[ j ].neighbors = lsimplex;
-          for ( auto&& v : isimplex ) facets[ j ].on_set.push_back( v );
-          std::sort( facets[ j ].on_set.begin(), facets[ j ].on_set.end() );
         }
-      // List of unassigned vertices
-      for ( Index fi = 0; fi < facets.size(); ++fi ) {
-        Facet& f = facets[ fi ];
-        for ( Index v = 0; v < points.size(); v++ )
-          {
-            if ( assignment[ v ] == UNASSIGNED && above( f, points[ v ] ) ) {
-              f.outside_set.push_back( v );
-              assignment[ v ] = fi;
-            } 
-          }
+      // Each point is assigned to the first facet below it (by chunks
+      // of points), otherwise it is processed.
+      const Size nb = nbChunks( points.size(), policy );
+      std::vector< std::vector< IndexRange > > outside
+        ( nb, std::vector< IndexRange >( facets.size() ) );
+      std::vector< IndexRange > inside( nb );
+      forEachChunk( points.size(), policy,
+                    [&] ( Size c, Size b, Size e )
+                    {
+                      for ( Index v = b; v < e; v++ ) {
+                        Index fi = 0;
+                        while ( fi < facets.size()
+                                && ! filteredAbove( facets[ fi ], points[ v ] ) )
+                          fi++;
+                        if ( fi < facets.size() ) {
+                          outside[ c ][ fi ].push_back( v );
+                          assignment[ v ] = fi;
+                        }
+                        else inside[ c ].push_back( v );
+                      }
+                    } );
+      for ( Index c = 0; c < nb; c++ ) {
+        for ( Index fi = 0; fi < facets.size(); ++fi )
+          facets[ fi ].outside_set.insert( facets[ fi ].outside_set.end(),
+                                           outside[ c ][ fi ].cbegin(),
+                                           outside[ c ][ fi ].cend() );
+        processed_points.insert( processed_points.end(),
+                                 inside[ c ].cbegin(), inside[ c ].cend() );
       }
-      for ( Index v = 0; v < points.size(); v++ )
-        if ( assignment[ v ] == UNASSIGNED )
-          processed_points.push_back( v );
       
       // Display some information
       if ( debug_level >= 2 ) {
@@ -121,9 +121,9 @@ namespace DGtal
       }
       if ( ! remove_duplicates ) {
         output_values.swap( input );
-        input2output.resize( input.size() );
-        output2input.resize( input.size() );
-        for ( Size i = 0; i < input.size(); ++i )
+        input2output.resize( output_values.size() );
+        output2input.resize( output_values.size() );
+        for ( Size i = 0; i < output_values.size(); ++i )
           input2output[ i ] = output2input[ i ] = i;
       }
       else {
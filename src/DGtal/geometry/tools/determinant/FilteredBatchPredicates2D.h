@@ -0,0 +1,357 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FilteredBatchPredicates2D.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module FilteredBatchPredicates2D.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(FilteredBatchPredicates2D_RECURSES)
+#error Recursive header files inclusion detected in FilteredBatchPredicates2D.h
+#else // defined(FilteredBatchPredicates2D_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FilteredBatchPredicates2D_RECURSES
+
+#if !defined FilteredBatchPredicates2D_h
+/** Prevents repeated inclusion of headers. */
+#define FilteredBatchPredicates2D_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <array>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/kernel/CEuclideanRing.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FilteredBatchPredicates2D
+  /**
+   * \brief Aim: Class that implements the orientation test of three
+   * 2d points and the in-circle test of four 2d points, either one
+   * at a time or for whole ranges of points.
+   *
+   * After an initialization step with two points P, Q (resp. three
+   * points A, B, C), the orientation of P, Q, R (resp. the position
+   * of D wrt the circle passing by A, B, C) is computed for one point
+   * R (resp. D) or for a range of points. The returned values are:
+   * - zero if P, Q, R belong to the same line (resp. if A, B, C, D
+   *   belong to the same circle),
+   * - strictly positive if P, Q, R are counter-clockwise oriented
+   *   (resp. if D lies inside the circle and A, B, C are
+   *   counter-clockwise oriented),
+   * - strictly negative otherwise.
+   *
+   * Determinants are first evaluated with doubles. Their sign is
+   * returned if the value is greater than a static bound on the
+   * rounding errors (Shewchuk's error bounds \cite Shewchuk1997), and
+   * zero is returned if the value and the bound are small enough to
+   * contain no other integer. Otherwise, the determinant is computed
+   * exactly with integers of type @a TInteger. Ranges of points are
+   * processed by blocks of `lanes` points, whose filtering loops are
+   * branch-free so that compilers vectorize them; exact computations
+   * are only done for the points of a block whose sign is uncertain.
+   *
+   * This class is a model of COrientationFunctor2, and may thus be
+   * used for instance by MelkmanConvexHull or by the functions of
+   * functions::Hull2D, which then evaluate one point at a time. No
+   * algorithm of the library uses it by default, nor calls its range
+   * methods: Preimage2D uses its own shape predicates, and the
+   * QuickHull kernels compute facet heights with their own filter.
+   *
+   * Basic usage:
+   @code
+   ...
+   typedef Z2i::Point Point;
+   typedef FilteredBatchPredicates2D<Point, DGtal::int64_t> Predicates;
+
+   Predicates predicates;
+   std::vector<Point> R = { Point(2,1), Point(3,1), Point(10,4) };
+   std::vector<Predicates::Value> signs;
+   predicates.init( Point(0,0), Point(5,2) );
+   predicates.orientations( R.cbegin(), R.cend(), std::back_inserter( signs ) );
+   //signs is { 1, -1, 0 }
+   @endcode
+   *
+   * @tparam TPoint a model of point, whose coordinates are integers
+   * with absolute value less than 2^53.
+   *
+   * @tparam TInteger a model of integer for the exact computations,
+   * at least a model of CEuclideanRing. It must represent integers
+   * with 2b+3 bits for the orientation test and 4b+6 bits for the
+   * in-circle test if point coordinates are coded with b bits.
+   *
+   * @see InHalfPlaneBySimple3x3Matrix, Filtered2x2DetComputer
+   */
+  template <typename TPoint, typename TInteger>
+  class FilteredBatchPredicates2D
+  {
+    // ----------------------- Types  ------------------------------------
+  public:
+
+    /**
+     * Type of points
+     */
+    typedef TPoint Point;
+
+    /**
+     * Type of point array
+     */
+    typedef std::array<Point,2> PointArray;
+    /**
+     * Type used to represent the size of the array
+     */
+    typedef typename PointArray::size_type SizeArray;
+    /**
+     * static size of the array, ie. 2
+     */
+    static const SizeArray size = 2;
+
+    /**
+     * Type of integers for exact computations
+     */
+    typedef TInteger Integer;
+    BOOST_CONCEPT_ASSERT(( concepts::CEuclideanRing<Integer> ));
+
+    /**
+     * Type of the result, which is -1, 0 or 1
+     */
+    typedef Integer Value;
+
+    /**
+     * Type used to count the evaluated predicates
+     */
+    typedef std::size_t Size;
+
+    /**
+     * Number of points processed together by range evaluations.
+     */
+    static const Size lanes = 8;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Initialisation of the orientation test.
+     * @param aP first point
+     * @param aQ second point
+     */
+    void init(const Point& aP, const Point& aQ);
+
+    /**
+     * Initialisation of the orientation test.
+     * @param aA array of two points
+     */
+    void init(const PointArray& aA);
+
+    /**
+     * Main operator.
+     * @warning FilteredBatchPredicates2D::init() should be called before
+     * @param aR any point to test
+     * @return orientation of the three points @a aP @a aQ @a aR :
+     * - zero if the three points belong to the same line
+     * - strictly positive if the three points are counter-clockwise oriented
+     * - striclty negative if the three points are clockwise oriented
+     */
+    Value operator()(const Point& aR) const;
+
+    /**
+     * Computes the orientation of the points @a aP @a aQ given at
+     * initialization and of each point of a range.
+     * @warning FilteredBatchPredicates2D::init() should be called before
+     *
+     * @param itb an iterator on the first point of the range
+     * @param ite an iterator past the last point of the range
+     * @param out an output iterator where the orientations are written
+     * @return the output iterator after the last written orientation
+     *
+     * @tparam PointIterator a model of input iterator on points
+     * @tparam OutputIterator a model of output iterator on Value
+     */
+    template <typename PointIterator, typename OutputIterator>
+    OutputIterator orientations(PointIterator itb, PointIterator ite,
+                                OutputIterator out) const;
+
+    /**
+     * Initialisation of the in-circle test.
+     * @param aA first point
+     * @param aB second point
+     * @param aC third point
+     */
+    void initCircle(const Point& aA, const Point& aB, const Point& aC);
+
+    /**
+     * @warning FilteredBatchPredicates2D::initCircle() should be called before
+     * @param aD any point to test
+     * @return the position of @a aD wrt the circle passing by the
+     * three points @a aA @a aB @a aC given at initialization:
+     * - zero if the four points belong to the same circle
+     * - strictly positive if @a aD lies inside the circle and @a aA @a aB @a aC
+     *   are counter-clockwise oriented, or if @a aD lies outside the
+     *   circle and @a aA @a aB @a aC are clockwise oriented
+     * - strictly negative otherwise
+     */
+    Value inCircle(const Point& aD) const;
+
+    /**
+     * Computes the position of each point of a range wrt the circle
+     * passing by the three points given at initialization.
+     * @warning FilteredBatchPredicates2D::initCircle() should be called before
+     *
+     * @param itb an iterator on the first point of the range
+     * @param ite an iterator past the last point of the range
+     * @param out an output iterator where the positions are written
+     * @return the output iterator after the last written position
+     *
+     * @tparam PointIterator a model of input iterator on points
+     * @tparam OutputIterator a model of output iterator on Value
+     * @see inCircle
+     */
+    template <typename PointIterator, typename OutputIterator>
+    OutputIterator inCircles(PointIterator itb, PointIterator ite,
+                             OutputIterator out) const;
+
+    /**
+     * @return the number of predicates decided by the floating-point filter.
+     */
+    Size nbFiltered() const;
+
+    /**
+     * @return the number of predicates computed with exact integers.
+     */
+    Size nbExact() const;
+
+    /**
+     * Resets the counters of evaluated predicates.
+     */
+    void resetStatistics();
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The two points of the orientation test.
+    Point myP, myQ;
+    /// The coordinates of the points of the orientation test, as doubles.
+    double myPx = 0.0, myPy = 0.0, myQx = 0.0, myQy = 0.0;
+    /// The three points of the in-circle test.
+    std::array<Point,3> myCircle;
+    /// The coordinates of the points of the in-circle test, as doubles.
+    std::array<double,6> myCircleXY = {};
+    /// Number of predicates decided by the floating-point filter.
+    mutable Size myNbFiltered = 0;
+    /// Number of predicates computed exactly.
+    mutable Size myNbExact = 0;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param x any coordinate
+     * @return its conversion to double.
+     */
+    static double toDouble(const typename Point::Coordinate& x);
+
+    /**
+     * Evaluates the orientation determinant of (P,Q,R) with doubles.
+     * @param rx,ry the coordinates of R
+     * @param[out] det the approximated determinant
+     * @param[out] err the bound on its error
+     */
+    void approxOrientation(double rx, double ry, double& det, double& err) const;
+
+    /**
+     * Evaluates the in-circle determinant of (A,B,C,D) with doubles.
+     * @param dx,dy the coordinates of D
+     * @param[out] det the approximated determinant
+     * @param[out] err the bound on its error
+     */
+    void approxInCircle(double dx, double dy, double& det, double& err) const;
+
+    /**
+     * @param aR any point
+     * @return the exact orientation of (P,Q,R).
+     */
+    Value exactOrientation(const Point& aR) const;
+
+    /**
+     * @param aD any point
+     * @return the exact position of D wrt the circle (A,B,C).
+     */
+    Value exactInCircle(const Point& aD) const;
+
+    /// Value returned by certifiedSign when the sign is uncertain.
+    enum { UNCERTAIN = 2 };
+
+    /**
+     * @param det the approximated determinant
+     * @param err the bound on its error
+     * @return the sign (1, 0 or -1) of the exact determinant if it is
+     * certified, UNCERTAIN otherwise.
+     */
+    static int certifiedSign(double det, double err);
+
+  }; // end of class FilteredBatchPredicates2D
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FilteredBatchPredicates2D'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FilteredBatchPredicates2D' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint, typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const FilteredBatchPredicates2D<TPoint, TInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/tools/determinant/FilteredBatchPredicates2D.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FilteredBatchPredicates2D_h
+
+#undef FilteredBatchPredicates2D_RECURSES
+#endif // else defined(FilteredBatchPredicates2D_RECURSES)
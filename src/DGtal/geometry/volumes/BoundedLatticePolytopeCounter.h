@@ -44,6 +44,7 @@
 #include <iostream>
 #include <map>
 #include "DGtal/kernel/IntegralIntervals.h"
+#include "DGtal/kernel/FlatLatticeSetByIntervals.h"
 #include "DGtal/geometry/volumes/BoundedLatticePolytope.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -88,6 +89,9 @@ namespace DGtal
 
     /// Internal type used to represent any lattice point set.
     using LatticeSetByIntervals = std::map< Point, Intervals >;
+
+    /// Flat type used to represent any lattice point set.
+    using FlatLatticeSet        = FlatLatticeSetByIntervals< Space >;
     
     /// Default constructor
     BoundedLatticePolytopeCounter() = default;
@@ -173,10 +177,19 @@ namespace DGtal
     /// @param a any axis with 0 <= a < d, where d is the dimension of the space.
     ///
     /// @return the set of lattice points within the current polytope,
-    /// represented as intervals along the given rows specified by the
-    /// axis.
+    /// represented as closed intervals along the given rows specified
+    /// by the axis (rows are points with a null \a a-th coordinate).
     LatticeSetByInterval getLatticeSet( Dimension a ) const;
 
+    /// @param a any axis with 0 <= a < d, where d is the dimension of the space.
+    ///
+    /// @return the set of lattice points within the current polytope,
+    /// as a flat lattice set along the given axis.
+    ///
+    /// @note Same as getLatticeSet, but rows are computed directly in
+    /// increasing order.
+    FlatLatticeSet getFlatLatticeSet( Dimension a ) const;
+
     /// @param a any axis with 0 <= a < d, where d is the dimension of the space.
     ///
     /// @return the set of cells (as points with Khalimsky
@@ -189,6 +202,17 @@ namespace DGtal
     /// Star of the initial polytope.
     LatticeSetByInterval getLatticeCells( Dimension a ) const;
 
+    /// @param a any axis with 0 <= a < d, where d is the dimension of the space.
+    ///
+    /// @return the set of cells (as points with Khalimsky
+    /// coordinates) whose closure touched the current polytope, as a
+    /// flat lattice set along the given axis.
+    ///
+    /// @note Same as getLatticeCells, but the rows of k-cells are
+    /// obtained by merging sorted arrays of rows instead of map
+    /// lookups and insertions.
+    FlatLatticeSet getFlatLatticeCells( Dimension a ) const;
+
     /// @return the most elongated axis of the bounding box of the
     /// current polytope.
     Dimension longestAxis() const;
@@ -198,7 +222,18 @@ namespace DGtal
     /// @return the upper point of the tight bounding box of the current polytope.
     Point upperBound() const { return myUpper; }
 
-    
+
+    // --------------------------- internals -----------------------------------
+    /// Calls \a f on each row point of the bounding box projected
+    /// along axis \a a (its \a a-th coordinate is null), in
+    /// lexicographic order.
+    ///
+    /// @tparam RowFunctor the type of functor, called as f( p ).
+    /// @param a any axis with 0 <= a < d, where d is the dimension of the space.
+    /// @param f the functor.
+    template < typename RowFunctor >
+    void forEachRow( Dimension a, const RowFunctor& f ) const;
+
     // --------------------------- protected datas -----------------------------------
     /// The associated polytope.
     const Polytope* myPolytope;
@@ -210,6 +210,14 @@ namespace DGtal
     /// polytope. Useful for checking full convexity (see
     /// moduleDigitalConvexity).
     ///
+    /// @param[in] cull_interior_points when 'true', the points that
+    /// are provably interior are removed before computing the convex
+    /// hull (see QuickHull::cullInteriorPoints), which is much faster
+    /// for dense lattice sets.
+    ///
+    /// @param[in] policy the parallel policy used by QuickHull to
+    /// assign points to facets (useful for large ranges of points).
+    ///
     /// @return the tightiest bounded lattice polytope
     /// (i.e. H-representation) including the given range of points,
     /// or an empty range if the dimension is greater than 3 and the
@@ -218,7 +226,9 @@ namespace DGtal
     LatticePolytope
     computeLatticePolytope( const PointRange& input_points,
                             bool remove_duplicates = true,
-                            bool make_minkowski_summable = false );
+                            bool make_minkowski_summable = false,
+                            bool cull_interior_points = true,
+                            const ParallelPolicy& policy = ParallelPolicy() );
 
     /// Computes and returns the vertices of the tightiest lattice
     /// polytope enclosing all the given input lattice points.
@@ -228,6 +238,14 @@ namespace DGtal
     /// @param[in] remove_duplicates should be set to 'true' if the
     /// input data has duplicates.
     ///
+    /// @param[in] cull_interior_points when 'true', the points that
+    /// are provably interior are removed before computing the convex
+    /// hull (see QuickHull::cullInteriorPoints), which is much faster
+    /// for dense lattice sets.
+    ///
+    /// @param[in] policy the parallel policy used by QuickHull to
+    /// assign points to facets (useful for large ranges of points).
+    ///
     /// @return the vertices of the tightiest bounded lattice polytope
     /// including the given range of points, or an empty range if the
     /// dimension is greater than 3 and the given range of points is
@@ -235,7 +253,9 @@ namespace DGtal
     static
     PointRange
     computeConvexHullVertices( const PointRange& input_points,
-                               bool remove_duplicates = true );    
+                               bool remove_duplicates = true,
+                               bool cull_interior_points = true,
+                               const ParallelPolicy& policy = ParallelPolicy() );
 
     
     /// Computes a surface mesh representation of the boundary of the
@@ -48,6 +48,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Clone.h"
 #include "DGtal/kernel/LatticeSetByIntervals.h"
+#include "DGtal/kernel/FlatLatticeSetByIntervals.h"
 #include "DGtal/topology/CCellularGridSpaceND.h"
 #include "DGtal/topology/KhalimskySpaceND.h"
 #include "DGtal/geometry/volumes/BoundedLatticePolytope.h"
@@ -96,6 +97,7 @@ namespace DGtal
     typedef DGtal::BoundedLatticePolytopeCounter< Space > Counter;
     typedef typename Counter::Interval      Interval;
     typedef DGtal::LatticeSetByIntervals< Space > LatticeSet;
+    typedef DGtal::FlatLatticeSetByIntervals< Space > FlatLatticeSet;
     
     static const Dimension dimension = KSpace::dimension;
 
@@ -438,6 +440,14 @@ namespace DGtal
     /// summable polytope, i.e. `P.canBeSummed() == true`.
     bool isFullySubconvex( const PointRange& Y, const LatticeSet& StarX ) const;
 
+    /// Tells if a given set of points Y is digitally fully subconvex to
+    /// some flat lattice set \a Star_X, i.e. the cell cover of some set X
+    /// represented by lattice points.
+    ///
+    /// @param Y any set of points
+    /// @param StarX any flat lattice set representing an open cubical complex.
+    /// @return 'true' iff  Y is digitally fully subconvex to X.
+    bool isFullySubconvex( const PointRange& Y, const FlatLatticeSet& StarX ) const;
 
     /// Tells if the non-degenerated 3D triangle a,b,c is digitally
     /// fully subconvex to some lattice set \a Star_X, i.e. the cell
@@ -455,6 +465,19 @@ namespace DGtal
     bool isFullySubconvex( const Point& a, const Point& b, const Point& c,
 			   const LatticeSet& StarX ) const;
 
+    /// Tells if the non-degenerated 3D triangle a,b,c is digitally
+    /// fully subconvex to some flat lattice set \a Star_X, i.e. the cell
+    /// cover of some set X represented by lattice points.
+    ///
+    /// @param a any 3D point (distinct from the two others)
+    /// @param b any 3D point (distinct from the two others)
+    /// @param c any 3D point (distinct from the two others)
+    ///
+    /// @param StarX any flat lattice set representing an open cubical complex.
+    /// @return 'true' iff  Y is digitally fully subconvex to X.
+    bool isFullySubconvex( const Point& a, const Point& b, const Point& c,
+                           const FlatLatticeSet& StarX ) const;
+
     
     /// Tells if a given segment from \a a to \a b is digitally
     /// k-subconvex (i.e. k-tangent) to some cell cover \a C. The
@@ -509,6 +532,18 @@ namespace DGtal
     /// polytope and then checking if it subconvex.
     bool isFullySubconvex( const Point& a, const Point& b,
                            const LatticeSet& StarX ) const;
+
+    /// Tells if a given segment from \a a to \a b is digitally fully
+    /// subconvex (i.e. tangent) to some open complex \a StarX.
+    ///
+    /// @param a any point
+    /// @param b any point
+    /// @param StarX any flat lattice set representing an open cubical complex.
+    ///
+    /// @return 'true' iff the segment is a digitally fully subconvex
+    /// of C, i.e. the two points are cotangent.
+    bool isFullySubconvex( const Point& a, const Point& b,
+                           const FlatLatticeSet& StarX ) const;
     
     /// Given a range of distinct points \a X, computes the tightiest
     /// polytope that enclosed it. Note that this polytope may contain
@@ -578,6 +613,37 @@ namespace DGtal
     /// must indeed have the same axis.
     LatticeSet StarCvxH( const Point& a, const Point& b, const Point& c,
                          Dimension axis = dimension ) const;
+
+    /// Builds the cell complex Star(CvxH(X)) for X a digital set,
+    /// represented as a flat lattice set.
+    ///
+    /// @param X any range of lattice points
+    ///
+    /// @param axis specifies the projection axis for the row
+    /// representation if below space dimension, otherwise chooses the
+    /// axis that minimizes memory/computations.
+    ///
+    /// @return the range of cells touching the convex hull of X,
+    /// represented as a flat lattice set (cells are represented with
+    /// Khalimsky coordinates).
+    FlatLatticeSet FlatStarCvxH( const PointRange& X,
+                                 Dimension axis = dimension ) const;
+
+    /// Builds the cell complex `Star(CvxH({a,b,c}))` for `a,b,c` a
+    /// non-degenerate 3D triangle, represented as a flat lattice set.
+    ///
+    /// @param a any 3D point (distinct from the two others)
+    /// @param b any 3D point (distinct from the two others)
+    /// @param c any 3D point (distinct from the two others)
+    ///
+    /// @param axis specifies the projection axis for the row
+    /// representation if below space dimension, otherwise chooses the
+    /// axis that minimizes memory/computations.
+    ///
+    /// @return the range of cells touching the triangle `abc`, or an
+    /// empty set if the triangle is degenerate.
+    FlatLatticeSet FlatStarCvxH( const Point& a, const Point& b, const Point& c,
+                                 Dimension axis = dimension ) const;
     
     /// Computes the number of cells in Star(CvxH(X)) for X a digital set.
     ///
@@ -605,6 +671,20 @@ namespace DGtal
     LatticeSet Star( const PointRange& X,
                      Dimension axis = dimension ) const;
 
+    /// Builds the cell complex Star(X) for X a digital set,
+    /// represented as a flat lattice set.
+    ///
+    /// @param X any range of lattice points
+    ///
+    /// @param axis specifies the projection axis for the row
+    /// representation if below space dimension, otherwise chooses
+    /// axis 0.
+    ///
+    /// @return the set of cells, represented as a flat lattice set,
+    /// that touches points of \a X, i.e. `Star(X)`.
+    FlatLatticeSet FlatStar( const PointRange& X,
+                             Dimension axis = dimension ) const;
+
     /// Builds the cell complex Star(C) for C a range of cells,
     /// represented as a lattice set (stacked row representation).
     ///
@@ -683,7 +763,8 @@ namespace DGtal
     /// a digital set.
     enum class EnvelopeAlgorithm
       { DIRECT /**< Slightly faster but quite ugly big function */,
-        LATTICE_SET /**< Slightly slower function but decomposes well the algorithm */ 
+        LATTICE_SET /**< Slightly slower function but decomposes well the algorithm */,
+        FLAT_LATTICE_SET /**< Same decomposition with flat lattice sets, faster than both others */
       };
     
     /// Computes `FC(Z):=Extr(Skel(Star(CvxH(Z))))`, for \a Z a range of points
@@ -821,6 +902,15 @@ namespace DGtal
     /// @param StarX any lattice set representing an open cubical complex.
     /// @return 'true' iff  Y is digitally fully subconvex to X.
     bool isFullySubconvex( const LatticePolytope& P, const LatticeSet& StarX ) const;
+
+    /// Tells if a given polytope \a P is digitally fully subconvex to
+    /// some flat lattice set \a Star_X, i.e. the cell cover of some set X
+    /// represented by lattice points.
+    ///
+    /// @param P any lattice polytope such that `P.canBeSummed() == true`.
+    /// @param StarX any flat lattice set representing an open cubical complex.
+    /// @return 'true' iff  Y is digitally fully subconvex to X.
+    bool isFullySubconvex( const LatticePolytope& P, const FlatLatticeSet& StarX ) const;
     
     
     /// @}
@@ -938,6 +1028,30 @@ namespace DGtal
     /// @return  FC( Z )
     PointRange FC_LatticeSet( const PointRange& Z ) const;
 
+    /// Computes `FC(Z):=Extr(Skel(Star(CvxH(Z))))`, for \a Z a range of points
+    /// @param Z any range of points (must be sorted).
+    /// @return  FC( Z )
+    PointRange FC_FlatLatticeSet( const PointRange& Z ) const;
+
+    /// @param X any range of lattice points
+    /// @return the polytope CvxH(X) + [0,1]^d, whose lattice points
+    /// correspond 1-1 to the d-cells intersected by CvxH(X).
+    LatticePolytope makeStarPolytope( const PointRange& X ) const;
+
+    /// @param a any 3D point (distinct from the two others)
+    /// @param b any 3D point (distinct from the two others)
+    /// @param c any 3D point (distinct from the two others)
+    /// @return the polytope CvxH({a,b,c}) + [0,1]^3, or an invalid
+    /// polytope if the triangle is degenerate.
+    LatticePolytope makeStarPolytope( const Point& a, const Point& b, const Point& c ) const;
+
+    /// @param a any point
+    /// @param b any point
+    /// @return the cells (in Khalimsky coordinates) of the digital
+    /// straight segment from \a a to \a b, whose star is the star of
+    /// the segment.
+    PointRange segmentCells( const Point& a, const Point& b ) const;
+
     /// Erase the interval I from the intervals in V such that the integer
     /// in I are not part of V anymore.
     ///
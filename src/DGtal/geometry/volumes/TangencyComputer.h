@@ -44,9 +44,13 @@
 #include <vector>
 #include <string>
 #include <limits>
+#include <queue>
+#include <set>
+#include <tuple>
 #include <unordered_set>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Clone.h"
+#include "DGtal/base/ParallelPolicy.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/topology/CCellularGridSpaceND.h"
 #include "DGtal/kernel/LatticeSetByIntervals.h"
@@ -65,6 +69,22 @@ namespace DGtal
      provides services to compute all the cotangent points to a given
      point, or to compute shortest paths.
 
+     When many shortest paths are computed in the same digital set
+     (e.g. geodesic distances from many sources), the cotangent points
+     of all points can be computed once and cached as a compact graph
+     (see computeCotangencyGraph). Shortest paths then use this graph
+     instead of testing cotangency again at each visited point, and
+     several sources may be processed in parallel (see
+     forEachShortestPaths and shortestDistances).
+
+     \code
+     TangencyComputer< KSpace > TC( K );
+     TC.init( X.cbegin(), X.cend() );
+     TC.computeCotangencyGraph();
+     auto D = TC.shortestDistances( sources ); // D[ k ][ i ] is the distance of point i to sources[ k ]
+     auto P = TC.shortestPathAStar( sources[ 0 ], sources[ 1 ] );
+     \endcode
+
      @see moduleDigitalConvexityApplications
 
      @tparam TKSpace an arbitrary model of CCellularGridSpaceND.
@@ -86,6 +106,14 @@ namespace DGtal
     typedef std::vector< Index >        Path;
     typedef CellGeometry< KSpace >      CellCover;
     typedef LatticeSetByIntervals< Space > LatticeCellCover;
+
+    /// The cotangency graph of the digital set in compressed sparse
+    /// row form: the cotangent points of point \a i are
+    /// `neighbors[ offsets[ i ] ]`, ..., `neighbors[ offsets[ i+1 ] - 1 ]`.
+    struct CotangencyGraph {
+      std::vector< Index > offsets;
+      std::vector< Index > neighbors;
+    };
     
     // ------------------------- Shortest path services --------------------------------
   public:
@@ -169,14 +197,18 @@ namespace DGtal
       
       /// Clears the object and prepares it for a shortest path
       /// computation.
+      ///
+      /// @note Arrays are reused, so that clearing an object to
+      /// compute shortest paths from another source does not allocate
+      /// memory.
       void clear()
       {
         const auto nb = size();
-        myAncestor = std::vector< Index > ( nb, nb );
-        myDistance = std::vector< double >( nb, std::numeric_limits<double>::infinity() );
-        myVisited  = std::vector< bool >  ( nb, false );
+        myAncestor.assign( nb, nb );
+        myDistance.assign( nb, std::numeric_limits<double>::infinity() );
+        myVisited .assign( nb, false );
         myQ        = std::priority_queue< Node, std::vector< Node >, Comparator >();
-  }
+      }
 
       /// Adds the point with index \a i as a source point
       /// @param[in] i any valid index
@@ -349,6 +381,8 @@ namespace DGtal
     protected:
 
       /// Updates the queue with the cotangent points of the point given in parameter.
+      /// They are read in the cotangency graph of the tangency
+      /// computer if it was computed.
       ///
       /// @param current the index of the point where we determine its
       /// adjacent (here cotangent) to update the queue of the bft.
@@ -505,6 +539,47 @@ namespace DGtal
                         const std::vector< bool > & to_avoid ) const;
     
     /// @}
+
+    // ------------------------- Cotangency graph services --------------------------------
+  public:
+    /// @name Cotangency graph services
+    /// @{
+
+    /// Computes and caches the cotangent points of every point (see
+    /// getCotangentPoints( const Point& ) ), as a graph in compressed
+    /// sparse row form. Shortest paths then read cotangent points in
+    /// this graph instead of testing cotangency again, which pays off
+    /// as soon as distances to several sources are computed. Points
+    /// are split in chunks processed in parallel according to \a
+    /// policy.
+    ///
+    /// @param policy the parallel policy used for the computation.
+    ///
+    /// @note The graph is cleared by 'init'. Its size is the sum of
+    /// the number of cotangent points of each point, which may be
+    /// large for volumetric (thick) digital sets.
+    void computeCotangencyGraph( const ParallelPolicy& policy = ParallelPolicy() );
+
+    /// Clears the cotangency graph, if any.
+    void clearCotangencyGraph()
+    {
+      myCotangencyGraph = CotangencyGraph();
+    }
+
+    /// @return 'true' iff the cotangency graph has been computed.
+    bool hasCotangencyGraph() const
+    {
+      return ! myCotangencyGraph.offsets.empty();
+    }
+
+    /// @return a const reference to the cotangency graph (empty if
+    /// not computed).
+    const CotangencyGraph& cotangencyGraph() const
+    {
+      return myCotangencyGraph;
+    }
+
+    /// @}
     
     // ------------------------- Shortest paths services --------------------------------
   public:
@@ -589,6 +664,86 @@ namespace DGtal
     shortestPath( Index source, Index target,
                   double secure = sqrt( KSpace::dimension ),
                   bool verbose = false ) const;
+
+    /// Computes a shortest path from a source to a target by a
+    /// bidirectional A* search, returned as a sequence of point
+    /// indices, where the first is the source and the last is the
+    /// target. It returns an empty sequence if there is no path
+    /// between them.
+    ///
+    /// The forward and backward searches are guided by the average
+    /// of the Euclidean distances to the target and to the source,
+    /// which is a consistent heuristic for both searches, and stop as
+    /// soon as the shortest path is known. Contrary to shortestPath,
+    /// the output path is thus a shortest path in the graph of
+    /// cotangent points that are visited, and only points lying
+    /// around the segment [source,target] are usually visited.
+    ///
+    /// @param[in] source the index of the source point.
+    /// @param[in] target the index of the target point.
+    ///
+    /// @param[in] verbose when 'true' some information are displayed
+    /// during computation.
+    ///
+    /// @return the sequence of point indices from \a source to \a
+    /// target, i.e. `[source, ..., target]`, which form a
+    /// valid path in the object.
+    ///
+    /// @note Uses the cotangency graph if it was computed.
+    Path
+    shortestPathAStar( Index source, Index target,
+                       bool verbose = false ) const;
+
+    /// Computes shortest paths from each given source to every other
+    /// point, sources being processed in parallel according to \a
+    /// policy. For each source, a ShortestPaths object is initialized
+    /// with this source and expanded until it is finished, then it is
+    /// given to \a visitor. ShortestPaths objects are reused between
+    /// sources processed by the same thread.
+    ///
+    /// @tparam Visitor the type of functor, called as `visitor( k, SP, t )`
+    /// where \a k is the index of the source in \a sources, \a SP a
+    /// const reference to the finished ShortestPaths object and \a t
+    /// the index of the calling thread.
+    ///
+    /// @param[in] sources the indices of the source points.
+    /// @param[in] visitor the functor called for each source.
+    ///
+    /// @param secure This value is used to prune vertices in the
+    /// bft (see ShortestPaths). It is not used when the cotangency
+    /// graph is computed, since all cotangent points are then used.
+    ///
+    /// @param policy the parallel policy used to process sources.
+    ///
+    /// @note Computing the cotangency graph beforehand (see
+    /// computeCotangencyGraph) is generally much faster when there are
+    /// many sources.
+    template < typename Visitor >
+    void
+    forEachShortestPaths( const std::vector< Index >& sources,
+                          const Visitor& visitor,
+                          double secure = sqrt( KSpace::dimension ),
+                          const ParallelPolicy& policy = ParallelPolicy() ) const;
+
+    /// Computes the geodesic distances from each given source to every
+    /// other point, sources being processed in parallel according to
+    /// \a policy (see forEachShortestPaths).
+    ///
+    /// @param[in] sources the indices of the `m` source points.
+    ///
+    /// @param secure This value is used to prune vertices in the
+    /// bft (see ShortestPaths). It is not used when the cotangency
+    /// graph is computed, since all cotangent points are then used.
+    ///
+    /// @param policy the parallel policy used to process sources.
+    ///
+    /// @return `m` arrays of distances, such that the distance of point
+    /// \a i to source `sources[ k ]` is the i-th value of the k-th array
+    /// (infinity if unreachable).
+    std::vector< std::vector< double > >
+    shortestDistances( const std::vector< Index >& sources,
+                       double secure = sqrt( KSpace::dimension ),
+                       const ParallelPolicy& policy = ParallelPolicy() ) const;
     
     /// @}
     
@@ -617,6 +772,9 @@ namespace DGtal
     
     /// A map giving for each point its index.
     std::unordered_map< Point, Index > myPt2Index;
+
+    /// The cotangency graph, empty if not computed.
+    CotangencyGraph myCotangencyGraph;
     
     // ------------------------- Private Datas --------------------------------
   private:
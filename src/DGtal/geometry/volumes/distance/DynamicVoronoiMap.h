@@ -0,0 +1,285 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DynamicVoronoiMap.h
+ * @brief Voronoi map supporting batches of site insertions and removals
+ * @date 2026/10/17
+ *
+ * Header file for module DynamicVoronoiMap.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testDynamicVoronoiMap.cpp
+ */
+
+#if defined(DynamicVoronoiMap_RECURSES)
+#error Recursive header files inclusion detected in DynamicVoronoiMap.h
+#else // defined(DynamicVoronoiMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DynamicVoronoiMap_RECURSES
+
+#if !defined DynamicVoronoiMap_h
+/** Prevents repeated inclusion of headers. */
+#define DynamicVoronoiMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ParallelPolicy.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DynamicVoronoiMap
+  /**
+   * Description of template class 'DynamicVoronoiMap' <p>
+   * \brief Aim: Voronoi map whose set of sites can be modified by
+   * batches of insertions and removals, the map being repaired only
+   * where it changes.
+   *
+   * The initial sites are given, as for VoronoiMap, by the points for
+   * which the predicate is false. The predicate is no longer used
+   * afterwards: sites are then inserted and removed with update().
+   *
+   * The map is computed by the same separable process as VoronoiMap,
+   * but the result of each pass along the dimensions 0 to d-2 is kept
+   * (d-1 extra arrays of points, plus one bit per point for the
+   * sites). Since the result of a pass along a line only depends on
+   * the result of the previous pass on this line, an update recomputes
+   * along dimension 0 the lines containing a modified site, then along
+   * dimension k the lines containing a point whose value changed during
+   * the pass along dimension k-1. Each line being processed by the
+   * 1D procedure of VoronoiMap, the map after an update is identical
+   * to a VoronoiMap computed from scratch on the new set of sites
+   * (including the choice among equidistant sites), while the cost
+   * of an update grows with the region whose Voronoi sites change.
+   *
+   * Distances are obtained from the metric, as in
+   * DistanceTransformation:
+   * @code
+   * DynamicVoronoiMap<Z3i::Space, Predicate, L2Metric> voronoi( domain, predicate, l2 );
+   * voronoi.update( newSites, removedSites );
+   * double d = l2( p, voronoi( p ) );
+   * @endcode
+   *
+   * This class is a model of concepts::CConstImage.
+   *
+   * @tparam TSpace type of Digital Space (model of concepts::CSpace).
+   * @tparam TPointPredicate point predicate returning false for the
+   * initial sites (model of concepts::CPointPredicate).
+   * @tparam TSeparableMetric a model of concepts::CSeparableMetric.
+   * @tparam TImageContainer any model of concepts::CImage to store the
+   * map (see VoronoiMap).
+   *
+   * @see VoronoiMap
+   */
+  template < typename TSpace,
+             typename TPointPredicate,
+             typename TSeparableMetric,
+             typename TImageContainer =
+             ImageContainerBySTLVector<HyperRectDomain<TSpace>,
+                                       typename TSpace::Vector>
+             >
+  class DynamicVoronoiMap
+    : public VoronoiMap<TSpace, TPointPredicate, TSeparableMetric, TImageContainer>
+  {
+  public:
+    typedef VoronoiMap<TSpace, TPointPredicate, TSeparableMetric, TImageContainer> Parent;
+    typedef DynamicVoronoiMap<TSpace, TPointPredicate, TSeparableMetric, TImageContainer> Self;
+
+    typedef typename Parent::Space Space;
+    typedef typename Parent::PointPredicate PointPredicate;
+    typedef typename Parent::Domain Domain;
+    typedef typename Parent::SeparableMetric SeparableMetric;
+    typedef typename Parent::Point Point;
+    typedef typename Parent::Vector Vector;
+    typedef typename Parent::Value Value;
+    typedef typename Parent::Dimension Dimension;
+    typedef typename Parent::Size Size;
+    typedef typename Parent::PeriodicitySpec PeriodicitySpec;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor in the non-periodic case: computes the Voronoi map
+     * of the initial sites.
+     *
+     * @param aDomain the (hyper-rectangular) domain.
+     * @param aPredicate the point predicate, false for initial sites.
+     * @param aMetric the separable metric.
+     * @param aPolicy the parallel policy of the computations.
+     */
+    DynamicVoronoiMap( ConstAlias<Domain> aDomain,
+                       ConstAlias<PointPredicate> aPredicate,
+                       ConstAlias<SeparableMetric> aMetric,
+                       const ParallelPolicy & aPolicy = ParallelPolicy() );
+
+    /**
+     * Constructor with periodicity specification: computes the
+     * Voronoi map of the initial sites.
+     *
+     * @param aDomain the (hyper-rectangular) domain.
+     * @param aPredicate the point predicate, false for initial sites.
+     * @param aMetric the separable metric.
+     * @param aPeriodicitySpec the periodicity of each dimension.
+     * @param aPolicy the parallel policy of the computations.
+     */
+    DynamicVoronoiMap( ConstAlias<Domain> aDomain,
+                       ConstAlias<PointPredicate> aPredicate,
+                       ConstAlias<SeparableMetric> aMetric,
+                       PeriodicitySpec const & aPeriodicitySpec,
+                       const ParallelPolicy & aPolicy = ParallelPolicy() );
+
+    /**
+     * Default destructor
+     */
+    ~DynamicVoronoiMap() = default;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Inserts and removes sites, and repairs the map. Removals are
+     * applied before insertions, inserting an existing site or
+     * removing a point which is not a site has no effect.
+     *
+     * @param insertedSites the points becoming sites.
+     * @param removedSites the sites becoming non-site points.
+     */
+    void update( const std::vector<Point> & insertedSites,
+                 const std::vector<Point> & removedSites );
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return true if @a aPoint is currently a site.
+     */
+    bool isSite( const Point & aPoint ) const;
+
+    /**
+     * @return for each dimension, the number of lines processed along
+     * it by the last computation (full computation or update).
+     */
+    const std::vector<Size> & nbRecomputedLines() const
+    {
+      return myNbRecomputedLines;
+    }
+
+    /**
+     * @return the number of points of the map whose value changed
+     * during the last update.
+     */
+    Size nbChangedPoints() const
+    {
+      return myNbChangedPoints;
+    }
+
+    /**
+     * Self Display method.
+     *
+     * @param out output stream
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    // ------------------------- Private methods ------------------------------
+  private:
+
+    /// Computes all the passes from the initial predicate.
+    void computeAll();
+
+    /**
+     * Processes a set of lines along a dimension: the input of the 1D
+     * procedure is the result of the previous pass (or the sites for
+     * dimension 0) and its result is stored.
+     *
+     * @param dim the dimension of the lines.
+     * @param lines the linear index of the first point of each line.
+     * @param[out] changed if not null, receives the linear indices of
+     * the points whose value changed.
+     */
+    void processLines( const Dimension dim,
+                       const std::vector<Size> & lines,
+                       std::vector<Size> * changed );
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return its linear index (first dimension varying the fastest).
+     */
+    Size linearIndex( const Point & aPoint ) const;
+
+    /**
+     * @param index a linear index.
+     * @return the corresponding point of the domain.
+     */
+    Point pointOf( Size index ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// One flag per point of the domain, true for sites.
+    std::vector<bool> mySites;
+
+    /// Results of the passes along dimensions 0 to d-2.
+    std::vector< std::vector<Point> > myPasses;
+
+    /// Extent of the domain along each dimension.
+    std::vector<Size> myExtents;
+
+    /// Distance between consecutive points along each dimension.
+    std::vector<Size> myStrides;
+
+    /// Number of lines processed along each dimension by the last computation.
+    std::vector<Size> myNbRecomputedLines;
+
+    /// Number of points changed by the last update.
+    Size myNbChangedPoints;
+
+  }; // end of class DynamicVoronoiMap
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DynamicVoronoiMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DynamicVoronoiMap' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename S, typename P, typename Sep, typename TI>
+  std::ostream&
+  operator<< ( std::ostream & out, const DynamicVoronoiMap<S,P,Sep,TI> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/DynamicVoronoiMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DynamicVoronoiMap_h
+
+#undef DynamicVoronoiMap_RECURSES
+#endif // else defined(DynamicVoronoiMap_RECURSES)
@@ -0,0 +1,317 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file OutOfCoreDistanceTransformation.h
+ * @brief Euclidean distance transformation with bounded memory, for
+ * images stored out of core (e.g. TiledImage)
+ * @date 2026/10/17
+ *
+ * Header file for module OutOfCoreDistanceTransformation.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testOutOfCoreDistanceTransformation.cpp
+ */
+
+#if defined(OutOfCoreDistanceTransformation_RECURSES)
+#error Recursive header files inclusion detected in OutOfCoreDistanceTransformation.h
+#else // defined(OutOfCoreDistanceTransformation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define OutOfCoreDistanceTransformation_RECURSES
+
+#if !defined OutOfCoreDistanceTransformation_h
+/** Prevents repeated inclusion of headers. */
+#define OutOfCoreDistanceTransformation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/CSpace.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMapLineSites.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+    /**
+     * Tile fault counters of an image: zero for images without cache,
+     * the cache misses for images providing getCacheMissRead() and
+     * getCacheMissWrite() such as TiledImage.
+     *
+     * @tparam TImage an image type.
+     */
+    template < typename TImage, typename = void >
+    struct ImageTileFaults
+    {
+      /// @return the number of faults in read.
+      static std::size_t read( TImage & ) { return 0; }
+      /// @return the number of faults in write.
+      static std::size_t write( TImage & ) { return 0; }
+    };
+
+    /// Specialization for images with a tile cache.
+    template < typename TImage >
+    struct ImageTileFaults< TImage,
+                            decltype( (void) std::declval<TImage &>().getCacheMissRead(),
+                                      (void) std::declval<TImage &>().getCacheMissWrite() ) >
+    {
+      /// @return the number of faults in read.
+      static std::size_t read( TImage & anImage ) { return anImage.getCacheMissRead(); }
+      /// @return the number of faults in write.
+      static std::size_t write( TImage & anImage ) { return anImage.getCacheMissWrite(); }
+    };
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OutOfCoreDistanceTransformation
+  /**
+   * Description of template class 'OutOfCoreDistanceTransformation' <p>
+   * \brief Aim: Exact Euclidean distance transformation of a domain
+   * too large to be held in memory, with a user given memory budget.
+   *
+   * The object is given by a point predicate (e.g. a threshold on a
+   * TiledImage) and distances are written into an output image, which
+   * is typically a TiledImage whose tiles are produced by an
+   * ImageFactoryFromHDF5. As in DistanceTransformation, the distance
+   * is computed at each point to the closest point for which the
+   * predicate is false.
+   *
+   * The separable algorithm (same 1D lower envelope passes as
+   * VoronoiMap with the exact l_2 metric) is organized in two phases,
+   * so that only a bounded part of the domain is in memory at once:
+   *
+   * - slabs of hyperplanes orthogonal to the last dimension are
+   *   processed one after the other: the predicate is sampled on the
+   *   slab, the passes along dimensions 0 to d-2 are done in memory,
+   *   and the partial squared distances are written into the output
+   *   image;
+   * - blocks of columns along the last dimension are then read back
+   *   from the output image, the last pass is done in memory and the
+   *   final distances are written in place.
+   *
+   * Both phases access the output image in domain order within a slab
+   * or a block, hence a tile cache sees few faults as long as a slab
+   * (resp. a block of columns) of tiles fits into it. The slab
+   * thickness and the number of columns per block are chosen from the
+   * memory budget.
+   *
+   * Squared distances are exact (integer arithmetic) and the final
+   * distances are computed as in ExactPredicateLpSeparableMetric,
+   * hence the output is identical to the one of
+   * DistanceTransformation with the l_2 metric. Points without any
+   * site in the domain get the value
+   * std::numeric_limits<Value>::max().
+   *
+   * @code
+   * typedef ImageFactoryFromHDF5< ImageContainerBySTLVector<Z3i::Domain,double> > Factory;
+   * Factory factory( "dt.h5", "distances" );
+   * ... // read and write cache policies, TiledImage tiled( factory, read, write, 8 );
+   * OutOfCoreDistanceTransformation<Z3i::Space, Predicate, Tiled>
+   *   dt( domain, predicate, 256 * 1024 * 1024 );
+   * dt.compute( tiled );
+   * trace.info() << dt.statistics().nbTileFaultsRead << std::endl;
+   * @endcode
+   *
+   * @tparam TSpace type of Digital Space (model of concepts::CSpace).
+   * @tparam TPointPredicate point predicate returning false for points
+   * from which we compute the distance (model of concepts::CPointPredicate).
+   * @tparam TImage type of the output image (model of concepts::CImage
+   * on a HyperRectDomain<TSpace>). Its arithmetic value type must
+   * represent the squared distances exactly (e.g. double or
+   * DGtal::int64_t), since they are stored in the image between the
+   * two phases.
+   *
+   * @see DistanceTransformation, TiledImage, ImageFactoryFromHDF5
+   */
+  template < typename TSpace, typename TPointPredicate, typename TImage >
+  class OutOfCoreDistanceTransformation
+  {
+  public:
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate< TPointPredicate > ));
+    BOOST_CONCEPT_ASSERT(( concepts::CImage< TImage > ));
+
+    typedef TSpace Space;
+    typedef TPointPredicate PointPredicate;
+    typedef TImage Image;
+    typedef typename Image::Value Value;
+    typedef typename Space::Point Point;
+    typedef typename Space::Dimension Dimension;
+    typedef HyperRectDomain< Space > Domain;
+    BOOST_STATIC_ASSERT(( std::is_arithmetic< Value >::value ));
+    BOOST_STATIC_ASSERT(( boost::is_same< typename Image::Domain, Domain >::value ));
+
+    /// Type of the squared distances.
+    typedef DGtal::int64_t RawValue;
+
+    /// Default memory budget (64MB).
+    static constexpr std::size_t defaultMemoryBudget = 64 * 1024 * 1024;
+
+    /// Statistics of the last call to compute().
+    struct Statistics
+    {
+      /// Number of slabs of the first phase.
+      std::size_t nbSlabs = 0;
+      /// Number of blocks of columns of the second phase.
+      std::size_t nbColumnBlocks = 0;
+      /// Peak size (in bytes) of the buffers allocated by compute().
+      std::size_t peakBufferBytes = 0;
+      /// Peak resident memory of the process (in bytes, 0 if unknown).
+      std::size_t peakResidentBytes = 0;
+      /// Number of tile faults in read of the output image (0 if not a TiledImage).
+      std::size_t nbTileFaultsRead = 0;
+      /// Number of tile faults in write of the output image (0 if not a TiledImage).
+      std::size_t nbTileFaultsWrite = 0;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aDomain the domain (must be included in the domain of
+     * the output image).
+     * @param aPredicate the point predicate.
+     * @param aMemoryBudget the maximal size (in bytes) of the buffers
+     * used by compute(). At least one hyperplane and one column are
+     * in memory whatever the budget.
+     */
+    OutOfCoreDistanceTransformation( ConstAlias<Domain> aDomain,
+                                     ConstAlias<PointPredicate> aPredicate,
+                                     std::size_t aMemoryBudget = defaultMemoryBudget );
+
+    /**
+     * Computes the distance transformation and writes the distances
+     * into @a anImage.
+     *
+     * @param[in,out] anImage the output image.
+     */
+    void compute( Image & anImage );
+
+    /// @return the memory budget (in bytes).
+    std::size_t memoryBudget() const
+    {
+      return myMemoryBudget;
+    }
+
+    /// @return the statistics of the last call to compute().
+    const Statistics & statistics() const
+    {
+      return myStatistics;
+    }
+
+    /**
+     * @return the peak resident memory of the process in bytes, or 0
+     * if it cannot be queried on this platform.
+     */
+    static std::size_t peakResidentMemory();
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private methods ------------------------------
+  private:
+
+    /**
+     * Lower envelope of the parabolas @f$ x \mapsto (x-i)^2 + g_i @f$
+     * along a 1D line: replaces each value by the minimum over @a i.
+     * Uses the detail::L2LineEnvelope kernel of VoronoiMap.
+     *
+     * @param line the first value of the line.
+     * @param stride the distance between two consecutive values.
+     * @param n the number of values.
+     * @param infinity the value marking points without site.
+     */
+    void lineEnvelope( RawValue * line, std::size_t stride, std::size_t n,
+                       RawValue infinity );
+
+    /**
+     * Increments the first @a nbDims coordinates of a point in domain
+     * order (odometer).
+     *
+     * @param[in,out] p the point.
+     * @param nbDims the number of coordinates to consider.
+     */
+    void nextPoint( Point & p, Dimension nbDims ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The domain.
+    const Domain * myDomainPtr;
+
+    /// The point predicate.
+    const PointPredicate * myPredicatePtr;
+
+    /// The memory budget in bytes.
+    std::size_t myMemoryBudget;
+
+    /// Statistics of the last computation.
+    Statistics myStatistics;
+
+    /// Scratch lower envelope (same kernel as VoronoiMap with the l_2 metric).
+    detail::L2LineEnvelope< RawValue > myEnvelope;
+
+  }; // end of class OutOfCoreDistanceTransformation
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'OutOfCoreDistanceTransformation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'OutOfCoreDistanceTransformation' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename S, typename P, typename I >
+  std::ostream&
+  operator<< ( std::ostream & out, const OutOfCoreDistanceTransformation<S,P,I> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/OutOfCoreDistanceTransformation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined OutOfCoreDistanceTransformation_h
+
+#undef OutOfCoreDistanceTransformation_RECURSES
+#endif // else defined(OutOfCoreDistanceTransformation_RECURSES)
@@ -48,6 +48,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ParallelPolicy.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/images/CConstImage.h"
@@ -90,6 +91,13 @@ namespace DGtal
    * class constructor). For Euclidean the @f$ l_2@f$ metric, the
    * overall computation is in @f$ O(d.n^d)@f$, which is optimal.
    *
+   * As in VoronoiMap, lines along dimensions other than the first one
+   * are processed by blocks of adjacent lines copied into a
+   * transposed scratch buffer (see defaultLineBlockSize), and the
+   * computation can be done in parallel according to a ParallelPolicy
+   * given to the constructors (passes 0 to d-2 slab by slab, then the
+   * last pass by blocks of lines, with work stealing).
+   *
    * This class is a model of concepts::CConstImage.
    *
    * @see &nbsp; \ref toricVol
@@ -158,6 +166,10 @@ namespace DGtal
     /// Periodicity specification type.
     typedef std::array< bool, Space::dimension > PeriodicitySpec;
 
+    /// Default number of adjacent lines processed together in the
+    /// passes along dimensions greater than 0.
+    static constexpr Size defaultLineBlockSize = 64;
+
     /**
      * Constructor.
      *
@@ -180,10 +192,15 @@ namespace DGtal
      * returning the weight for some points
      * @param aMetric a power
      * seprable metric instance.
+     * @param aPolicy the parallel policy of the computation.
+     * @param aLineBlockSize the number of adjacent lines processed
+     * together in the passes along dimensions greater than 0.
      */
     PowerMap(ConstAlias<Domain> aDomain,
              ConstAlias<WeightImage> aWeightImage,
-             ConstAlias<PowerSeparableMetric> aMetric);
+             ConstAlias<PowerSeparableMetric> aMetric,
+             const ParallelPolicy & aPolicy = ParallelPolicy(),
+             const Size aLineBlockSize = defaultLineBlockSize);
 
     /**
      * Constructor with periodicity specification.
@@ -205,11 +222,16 @@ namespace DGtal
      * @param aPeriodicitySpec an array of size equal to the space dimension
      *        where the i-th value is \c true if the i-th dimension of the
      *        space is periodic, \c false otherwise.
+     * @param aPolicy the parallel policy of the computation.
+     * @param aLineBlockSize the number of adjacent lines processed
+     *        together in the passes along dimensions greater than 0.
      */
     PowerMap(ConstAlias<Domain> aDomain,
              ConstAlias<WeightImage> aWeightImage,
              ConstAlias<PowerSeparableMetric> aMetric,
-             PeriodicitySpec const & aPeriodicitySpec);
+             PeriodicitySpec const & aPeriodicitySpec,
+             const ParallelPolicy & aPolicy = ParallelPolicy(),
+             const Size aLineBlockSize = defaultLineBlockSize);
 
     /**
      * Disable default constructor.
@@ -297,6 +319,23 @@ namespace DGtal
         return myPeriodicitySpec[ n ];
       }
 
+    /**
+     * @return the number of adjacent lines processed together in the
+     * passes along dimensions greater than 0.
+     */
+    Size lineBlockSize() const
+      {
+        return myLineBlockSize;
+      }
+
+    /**
+     * @return the parallel policy used for the computation.
+     */
+    const ParallelPolicy & parallelPolicy() const
+      {
+        return myPolicy;
+      }
+
     /**
      * Project point coordinates into the domain, taking into account
      * the periodicity.
@@ -329,11 +368,30 @@ namespace DGtal
 
 
     /**
-     *  Compute the other steps of the separable Power map.
+     * Starting points of the blocks of lines of the pass along @a dim
+     * restricted to the box [lower,upper].
+     *
+     * @param dim the dimension to process.
+     * @param lower the lower bound of the box.
+     * @param upper the upper bound of the box.
+     * @return the starting point of each block.
+     */
+    std::vector<Point> blockStartingPoints(const Dimension dim,
+                                           const Point & lower,
+                                           const Point & upper) const;
+
+    /**
+     * Given a power map valid at dimension @a dim-1, this method
+     * updates the map to make it consistent at dimension @a dim along
+     * the (at most) lineBlockSize() adjacent 1D spans along the
+     * dimension @a dim, starting at @a row and at its successors along
+     * the first dimension.
      *
-     * @param dim the dimension to process
+     * @param row starting point of the first 1D process.
+     * @param dim dimension of the update.
      */
-    void computeOtherSteps(const Dimension dim) const;
+    void computeOtherStepBlock (const Point &row,
+                                const Dimension dim) const;
 
     /**
      * Given  a voronoi map valid at dimension @a dim-1, this method
@@ -343,9 +401,12 @@ namespace DGtal
      *
      * @param row starting point of the 1D process.
      * @param dim dimension of the update.
+     * @param line the map values along the 1D span (indexed from the
+     * lower bound of the domain along @a dim).
      */
     void computeOtherStep1D (const Point &row,
-                             const Dimension dim) const;
+                             const Dimension dim,
+                             Point * line) const;
 
     /**
      * Project point coordinates into the domain, taking into account
@@ -400,6 +461,12 @@ namespace DGtal
     /// Domain extent.
     Point myDomainExtent;
 
+    /// Parallel policy.
+    ParallelPolicy myPolicy;
+
+    /// Number of adjacent lines processed together.
+    Size myLineBlockSize;
+
   protected:
     ///Pointer to the separable metric instance
     const PowerSeparableMetric * myMetricPtr;
@@ -53,8 +53,10 @@
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMapLineSites.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ParallelPolicy.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -97,10 +99,31 @@ namespace DGtal
    * l_2@f$ metric, the overall computation is in @f$ O(d.n^d)@f$,
    * which is optimal.
    *
-   * If DGtal has been built with OpenMP support (WITH_OPENMP flag set
-   * to "true"), the computation is done in parallel (multithreaded)
-   * in an optimal way: on @a p processors, expected runtime is in
-   * @f$ O(h.d.n^d / p)@f$.
+   * The computation can be done in parallel (multithreaded) by giving
+   * a ParallelPolicy to the constructors (by default, it is parallel
+   * only if DGtal has been built with OpenMP support). The passes
+   * along the dimensions 0 to d-2 only involve points of a same
+   * hyperplane orthogonal to the last dimension: they are done slab by
+   * slab, each slab being a task. The last pass is split into blocks
+   * of lines. Tasks are balanced between threads by work stealing
+   * (see WorkStealingScheduler) and there is a single barrier, before
+   * the last pass. On @a p processors, expected runtime is in @f$
+   * O(h.d.n^d / p)@f$. The point predicate is only called during
+   * the sequential initialization, so it needs not be thread-safe,
+   * but the image container must support concurrent writes at
+   * distinct points.
+   *
+   * Lines along dimensions other than the first one are not
+   * contiguous in memory. They are thus processed by blocks of
+   * adjacent lines (along the first dimension): the block is copied
+   * row by row into a transposed scratch buffer, the 1D problems are
+   * solved on contiguous data and the block is written back row by
+   * row. The number of lines per block can be given in the
+   * constructors (see defaultLineBlockSize, a value of 1 processes
+   * the lines one at a time). For the exact @f$ l_2@f$ metric
+   * (ExactPredicateLpSeparableMetric with p=2), the 1D lower envelope
+   * uses a dedicated kernel working on site abscissas and heights
+   * (see detail::VoronoiMapLineSites).
    *
    * This class is a model of concepts::CConstImage.
    *
@@ -186,6 +209,10 @@ namespace DGtal
     /// Periodicity specification type.
     typedef std::array< bool, Space::dimension > PeriodicitySpec;
 
+    /// Default number of adjacent lines processed together in the
+    /// passes along dimensions greater than 0.
+    static constexpr Size defaultLineBlockSize = 64;
+
     /**
      * Constructor in the non-periodic case.
      *
@@ -204,10 +231,17 @@ namespace DGtal
      * Voronoi sites (false points).
      *
      * @param aMetric a pointer to the separable metric instance.
+     *
+     * @param aPolicy the parallel policy of the computation.
+     *
+     * @param aLineBlockSize the number of adjacent lines processed
+     * together in the passes along dimensions greater than 0.
      */
     VoronoiMap(ConstAlias<Domain> aDomain,
                ConstAlias<PointPredicate> predicate,
-               ConstAlias<SeparableMetric> aMetric);
+               ConstAlias<SeparableMetric> aMetric,
+               const ParallelPolicy & aPolicy = ParallelPolicy(),
+               const Size aLineBlockSize = defaultLineBlockSize);
 
     /**
      * Constructor with periodicity specification.
@@ -232,11 +266,18 @@ namespace DGtal
      * @param aPeriodicitySpec an array of size equal to the space dimension
      *        where the i-th value is \c true if the i-th dimension of the
      *        space is periodic, \c false otherwise.
+     *
+     * @param aPolicy the parallel policy of the computation.
+     *
+     * @param aLineBlockSize the number of adjacent lines processed
+     * together in the passes along dimensions greater than 0.
      */
     VoronoiMap(ConstAlias<Domain> aDomain,
                ConstAlias<PointPredicate> predicate,
                ConstAlias<SeparableMetric> aMetric,
-               PeriodicitySpec const & aPeriodicitySpec);
+               PeriodicitySpec const & aPeriodicitySpec,
+               const ParallelPolicy & aPolicy = ParallelPolicy(),
+               const Size aLineBlockSize = defaultLineBlockSize);
     /**
      * Default destructor
      */
@@ -314,6 +355,23 @@ namespace DGtal
         return myPeriodicitySpec[ n ];
       }
 
+    /**
+     * @return the number of adjacent lines processed together in the
+     * passes along dimensions greater than 0.
+     */
+    Size lineBlockSize() const
+      {
+        return myLineBlockSize;
+      }
+
+    /**
+     * @return the parallel policy used for the computation.
+     */
+    const ParallelPolicy & parallelPolicy() const
+      {
+        return myPolicy;
+      }
+
     /**
      * Project point coordinates into the domain, taking into account
      * the periodicity.
@@ -333,8 +391,31 @@ namespace DGtal
      */
     void selfDisplay ( std::ostream & out ) const;
 
-    // ------------------- Private functions ------------------------
-  private:
+    // ------------------- Protected functions ------------------------
+  protected:
+
+    /// Tag of the constructor which does not compute the map.
+    struct NoComputationTag {};
+
+    /**
+     * Constructor which only sets up the map (bounds, periodicity,
+     * policy and output image) without computing it, for derived
+     * classes organizing the passes themselves.
+     *
+     * @param aDomain a pointer to the (hyper-rectangular) domain.
+     * @param predicate a pointer to the point predicate.
+     * @param aMetric a pointer to the separable metric instance.
+     * @param aPeriodicitySpec the periodicity of each dimension.
+     * @param aPolicy the parallel policy of the computation.
+     * @param aLineBlockSize the number of adjacent lines processed together.
+     */
+    VoronoiMap(ConstAlias<Domain> aDomain,
+               ConstAlias<PointPredicate> predicate,
+               ConstAlias<SeparableMetric> aMetric,
+               PeriodicitySpec const & aPeriodicitySpec,
+               const ParallelPolicy & aPolicy,
+               const Size aLineBlockSize,
+               NoComputationTag);
 
     /**
      * Compute the Voronoi Map of a set of point sites using a
@@ -346,11 +427,31 @@ namespace DGtal
 
 
     /**
-     *  Compute the other steps of the separable Voronoi map.
+     * Starting points of the blocks of lines of the pass along @a dim
+     * restricted to the box [lower,upper].
+     *
+     * @param [in] dim the dimension to process.
+     * @param [in] lower the lower bound of the box.
+     * @param [in] upper the upper bound of the box.
+     * @return the starting point of each block.
+     */
+    std::vector<Point> blockStartingPoints(const Dimension dim,
+                                           const Point & lower,
+                                           const Point & upper) const;
+
+    /**
+     * Given a voronoi map valid at dimension @a dim-1, this method
+     * updates the map to make it consistent at dimension @a dim along
+     * the (at most) lineBlockSize() adjacent 1D spans along the
+     * dimension @a dim, starting at @a row and at its successors along
+     * the first dimension.
      *
-     * @param [in] dim the dimension to process
+     * @param [in] row starting point of the first 1D process.
+     * @param [in] dim dimension of the update.
      */
-    void computeOtherSteps(const Dimension dim) const;
+    void computeOtherStepBlock (const Point &row,
+                                const Dimension dim) const;
+
     /**
      * Given  a voronoi map valid at dimension @a dim-1, this method
      * updates the map to make it consistent at dimension @a dim along
@@ -359,9 +460,12 @@ namespace DGtal
      *
      * @param [in] row starting point of the 1D process.
      * @param [in] dim dimension of the update.
+     * @param [in,out] line the map values along the 1D span (indexed
+     * from the lower bound of the domain along @a dim).
      */
     void computeOtherStep1D (const Point &row,
-                             const Dimension dim) const;
+                             const Dimension dim,
+                             Point * line) const;
 
     /**
      * Project a coordinate into the domain, taking into account
@@ -376,8 +480,8 @@ namespace DGtal
      */
     typename Point::Coordinate projectCoordinate( typename Point::Coordinate aCoordinate, const Dimension aDim ) const;
 
-    // ------------------- Private members ------------------------
-  private:
+    // ------------------- Protected members ------------------------
+  protected:
 
     ///Pointer to the computation domain
     const Domain * myDomainPtr;
@@ -400,7 +504,11 @@ namespace DGtal
     /// Domain extent.
     Point myDomainExtent;
 
-  protected:
+    /// Parallel policy.
+    ParallelPolicy myPolicy;
+
+    /// Number of adjacent lines processed together.
+    Size myLineBlockSize;
 
     ///Pointer to the separable metric instance
     const SeparableMetric * myMetricPtr;
@@ -0,0 +1,342 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file VoronoiMapLineSites.h
+ * @brief Site stacks used by the 1D passes of the separable Voronoi map
+ * @date 2026/10/17
+ *
+ * Header file for module VoronoiMapLineSites
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see VoronoiMap.h
+ */
+
+#if defined(VoronoiMapLineSites_RECURSES)
+#error Recursive header files inclusion detected in VoronoiMapLineSites.h
+#else // defined(VoronoiMapLineSites_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define VoronoiMapLineSites_RECURSES
+
+#if !defined VoronoiMapLineSites_h
+/** Prevents repeated inclusion of headers. */
+#define VoronoiMapLineSites_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+  /////////////////////////////////////////////////////////////////////////////
+  // template class VoronoiMapLineSites
+  /**
+   * Description of template class 'VoronoiMapLineSites' <p>
+   * \brief Aim: Stack of the sites retained along a 1D line during
+   * one pass of the separable Voronoi map construction (lower
+   * envelope of the site distance functions along the line).
+   *
+   * The generic version stores the sites and delegates the @a
+   * hiddenBy and @a closest predicates to the separable metric.
+   *
+   * @tparam TSeparableMetric a model of concepts::CSeparableMetric.
+   */
+    template <typename TSeparableMetric>
+    class VoronoiMapLineSites
+    {
+    public:
+      typedef TSeparableMetric SeparableMetric;
+      typedef typename SeparableMetric::Point Point;
+
+      /**
+       * Constructor.
+       *
+       * @param aMetric the separable metric.
+       * @param aStartingPoint the first point of the line.
+       * @param aDim the direction of the line.
+       */
+      VoronoiMapLineSites( const SeparableMetric * aMetric,
+                           const Point & aStartingPoint,
+                           const Dimension aDim )
+        : myMetric( aMetric ), myStartingPoint( aStartingPoint ), myDim( aDim )
+      {}
+
+      /// @param n the number of sites to reserve.
+      void reserve( const std::size_t n ) { mySites.reserve( n ); }
+
+      /// @return the number of sites in the stack.
+      std::size_t size() const { return mySites.size(); }
+
+      /// @return the i-th site of the stack.
+      const Point & operator[]( const std::size_t i ) const { return mySites[ i ]; }
+
+      /// @param site a site to push on top of the stack.
+      void push_back( const Point & site ) { mySites.push_back( site ); }
+
+      /// Removes the top of the stack.
+      void pop_back() { mySites.pop_back(); }
+
+      /**
+       * @param site a new site (greater than the top of the stack along the line).
+       * @param endPoint the last point of the line.
+       * @return true if the stack has at least two sites and if the
+       * top of the stack is hidden by its predecessor and @a site.
+       */
+      bool topHiddenBy( const Point & site, const Point & endPoint ) const
+      {
+        const std::size_t n = mySites.size();
+        return ( n >= 2 ) &&
+          myMetric->hiddenBy( mySites[ n-2 ], mySites[ n-1 ], site,
+                              myStartingPoint, endPoint, myDim );
+      }
+
+      /**
+       * @param point a point of the line.
+       * @param i a site index such that i+1 < size().
+       * @return true if @a point is not strictly closer to the i-th
+       * site than to the (i+1)-th site.
+       */
+      bool notCloserThanNext( const Point & point, const std::size_t i ) const
+      {
+        return myMetric->closest( point, mySites[ i ], mySites[ i+1 ] ) != DGtal::ClosestFIRST;
+      }
+
+    private:
+      const SeparableMetric * myMetric;
+      Point myStartingPoint;
+      Dimension myDim;
+      std::vector<Point> mySites;
+    };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class L2LineEnvelope
+  /**
+   * Description of template class 'L2LineEnvelope' <p>
+   * \brief Aim: Stack of the parabolas @f$ x \mapsto (x - a)^2 + h
+   * @f$ retained along a 1D line by the exact l_2 lower envelope, in
+   * reduced form (abscissa @a a and height @a h of each site).
+   *
+   * The predicates are the integer expressions of the @a hiddenBy
+   * and @a closest predicates of ExactPredicateLpSeparableMetric for
+   * p = 2. This is the kernel shared by the l_2 specialization of
+   * VoronoiMapLineSites and by OutOfCoreDistanceTransformation.
+   *
+   * @tparam TRawValue the type of abscissas and squared distances
+   * (model of concepts::CSignedNumber).
+   */
+    template <typename TRawValue>
+    class L2LineEnvelope
+    {
+    public:
+      typedef TRawValue RawValue;
+
+      /// @param n the number of parabolas to reserve.
+      void reserve( const std::size_t n )
+      {
+        myAbscissas.reserve( n );
+        myHeights.reserve( n );
+      }
+
+      /// @return the number of parabolas in the stack.
+      std::size_t size() const { return myAbscissas.size(); }
+
+      /// Removes all the parabolas.
+      void clear()
+      {
+        myAbscissas.clear();
+        myHeights.clear();
+      }
+
+      /**
+       * @param a the abscissa of a new parabola.
+       * @param h the height of the new parabola.
+       */
+      void push_back( const RawValue a, const RawValue h )
+      {
+        myAbscissas.push_back( a );
+        myHeights.push_back( h );
+      }
+
+      /// Removes the top of the stack.
+      void pop_back()
+      {
+        myAbscissas.pop_back();
+        myHeights.pop_back();
+      }
+
+      /**
+       * @param w the abscissa of a new parabola (greater than the one
+       * of the top of the stack).
+       * @param hw the height of the new parabola.
+       * @return true if the stack has at least two parabolas and if
+       * the top of the stack is hidden by its predecessor and the new
+       * parabola.
+       */
+      bool topHiddenBy( const RawValue w, const RawValue hw ) const
+      {
+        const std::size_t n = myAbscissas.size();
+        if ( n < 2 )
+          return false;
+
+        const RawValue a = myAbscissas[ n-1 ] - myAbscissas[ n-2 ];
+        const RawValue b = w - myAbscissas[ n-1 ];
+        const RawValue c = a + b;
+        return ( c * myHeights[ n-1 ] - b * myHeights[ n-2 ] - a * hw - a * b * c ) > 0;
+      }
+
+      /**
+       * @param x an abscissa.
+       * @param i a parabola index.
+       * @return the value at @a x of the i-th parabola.
+       */
+      RawValue value( const RawValue x, const std::size_t i ) const
+      {
+        const RawValue d = x - myAbscissas[ i ];
+        return d * d + myHeights[ i ];
+      }
+
+      /**
+       * @param x an abscissa.
+       * @param i a parabola index such that i+1 < size().
+       * @return true if the i-th parabola is not strictly below the
+       * (i+1)-th one at @a x.
+       */
+      bool notCloserThanNext( const RawValue x, const std::size_t i ) const
+      {
+        return ! ( value( x, i ) < value( x, i+1 ) );
+      }
+
+    private:
+      std::vector<RawValue> myAbscissas;
+      std::vector<RawValue> myHeights;
+    };
+
+  /**
+   * Specialization of VoronoiMapLineSites for the exact l_2 metric.
+   *
+   * Along a line, the squared distance to a site @a s is @f$ (x -
+   * s_{dim})^2 + h_s @f$ where the height @f$ h_s @f$ is the squared
+   * distance from @a s to the line. Abscissas and heights are stored
+   * in an L2LineEnvelope and computed once when a site is pushed,
+   * instead of being recomputed over all the coordinates at each call
+   * of @a hiddenBy and @a closest. Predicates are the same integer
+   * expressions as in ExactPredicateLpSeparableMetric, hence the
+   * results are identical.
+   */
+    template <typename TSpace, typename TRawValue>
+    class VoronoiMapLineSites< ExactPredicateLpSeparableMetric<TSpace, 2, TRawValue> >
+    {
+    public:
+      typedef ExactPredicateLpSeparableMetric<TSpace, 2, TRawValue> SeparableMetric;
+      typedef typename SeparableMetric::Point Point;
+      typedef typename SeparableMetric::RawValue RawValue;
+
+      /**
+       * Constructor.
+       *
+       * @param aMetric the separable metric (not used).
+       * @param aStartingPoint the first point of the line.
+       * @param aDim the direction of the line.
+       */
+      VoronoiMapLineSites( const SeparableMetric * /*aMetric*/,
+                           const Point & aStartingPoint,
+                           const Dimension aDim )
+        : myStartingPoint( aStartingPoint ), myDim( aDim )
+      {}
+
+      /// @param n the number of sites to reserve.
+      void reserve( const std::size_t n )
+      {
+        mySites.reserve( n );
+        myEnvelope.reserve( n );
+      }
+
+      /// @return the number of sites in the stack.
+      std::size_t size() const { return mySites.size(); }
+
+      /// @return the i-th site of the stack.
+      const Point & operator[]( const std::size_t i ) const { return mySites[ i ]; }
+
+      /// @param site a site to push on top of the stack.
+      void push_back( const Point & site )
+      {
+        mySites.push_back( site );
+        myEnvelope.push_back( static_cast<RawValue>( site[ myDim ] ), height( site ) );
+      }
+
+      /// Removes the top of the stack.
+      void pop_back()
+      {
+        mySites.pop_back();
+        myEnvelope.pop_back();
+      }
+
+      /**
+       * @param site a new site (greater than the top of the stack along the line).
+       * @return true if the stack has at least two sites and if the
+       * top of the stack is hidden by its predecessor and @a site.
+       */
+      bool topHiddenBy( const Point & site, const Point & /*endPoint*/ ) const
+      {
+        return ( mySites.size() >= 2 ) &&
+          myEnvelope.topHiddenBy( static_cast<RawValue>( site[ myDim ] ), height( site ) );
+      }
+
+      /**
+       * @param point a point of the line.
+       * @param i a site index such that i+1 < size().
+       * @return true if @a point is not strictly closer to the i-th
+       * site than to the (i+1)-th site.
+       */
+      bool notCloserThanNext( const Point & point, const std::size_t i ) const
+      {
+        return myEnvelope.notCloserThanNext( static_cast<RawValue>( point[ myDim ] ), i );
+      }
+
+    private:
+      /// @return the squared distance from @a site to the line.
+      RawValue height( const Point & site ) const
+      {
+        RawValue h = NumberTraits<RawValue>::ZERO;
+        for ( Dimension i = 0; i < Point::dimension; ++i )
+          {
+            const RawValue delta = static_cast<RawValue>( site[ i ] - myStartingPoint[ i ] );
+            h += ( i != myDim ) ? delta * delta : NumberTraits<RawValue>::ZERO;
+          }
+        return h;
+      }
+
+      Point myStartingPoint;
+      Dimension myDim;
+      std::vector<Point> mySites;
+      L2LineEnvelope<RawValue> myEnvelope;
+    };
+
+  } // namespace detail
+} // namespace DGtal
+
+#endif // !defined VoronoiMapLineSites_h
+
+#undef VoronoiMapLineSites_RECURSES
+#endif // else defined(VoronoiMapLineSites_RECURSES)
@@ -83,6 +83,7 @@
 #include "DGtal/graph/DepthFirstVisitor.h"
 #include "DGtal/graph/GraphVisitorRange.h"
 #include "DGtal/helpers/Parameters.h"
+#include "DGtal/base/ParallelPolicy.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -993,13 +994,15 @@ namespace DGtal
       ///   - nbTriesToFindABel   [   100000]: number of tries in method Surfaces::findABel
       ///   - surfaceComponents   [ "AnyBig"]: "AnyBig"|"All", "AnyBig": any big-enough componen
       ///   - surfaceTraversal    ["Default"]: "Default"|"DepthFirst"|"BreadthFirst": "Default" default surface traversal, "DepthFirst": depth-first surface traversal, "BreadthFirst": breadth-first surface traversal.
+      ///   - threads             [        1]: the number of threads extracting all the boundary surfels and components, 0: one per hardware core.
       static Parameters parametersDigitalSurface()
       {
         return Parameters
           ( "surfelAdjacency",   0 )
           ( "nbTriesToFindABel", 100000 )
           ( "surfaceComponents", "AnyBig" )
-          ( "surfaceTraversal",  "Default" );
+          ( "surfaceTraversal",  "Default" )
+          ( "threads",           1 );
       }
 
       /// @tparam TDigitalSurfaceContainer either kind of DigitalSurfaceContainer
@@ -1141,6 +1144,7 @@ namespace DGtal
       ///   - surfelAdjacency   [       0]: specifies the surfel adjacency (1:ext, 0:int)
       ///   - nbTriesToFindABel [  100000]: number of tries in method Surfaces::findABel
       ///   - surfaceComponents ["AnyBig"]: "AnyBig"|"All", "AnyBig": any big-enough component (> twice space width), "All": all components
+      ///   - threads           [       1]: the number of threads extracting all the components, 0: one per hardware core (the result does not depend on it).
       ///
       /// @return a vector of smart pointers to the connected (light)
       /// digital surfaces present in the binary image.
@@ -1161,6 +1165,21 @@ namespace DGtal
           }	
         bool surfel_adjacency      = params[ "surfelAdjacency" ].as<int>();
         SurfelAdjacency< KSpace::dimension > surfAdj( surfel_adjacency );
+        if ( params[ "threads" ].as<int>() != 1 )
+          { // Components are computed at once by slabs and union-find.
+            std::vector< SurfelRange > components;
+            Surfaces<KSpace>::extractAllConnectedSCell
+              ( components, K, surfAdj, *bimage, false, getParallelPolicy( params ) );
+            for ( auto const & component : components )
+              {
+                surfel_reps.push_back( component[ 0 ] );
+                LightSurfaceContainer* surfContainer
+                  = new LightSurfaceContainer( K, *bimage, surfAdj, component[ 0 ] );
+                result.push_back( CountedPtr<LightDigitalSurface>
+                                  ( new LightDigitalSurface( surfContainer ) ) ); // acquired
+              }
+            return result;
+          }
         // Extracts all boundary surfels
         SurfelSet all_surfels;
         Surfaces<KSpace>::sMakeBoundary( all_surfels, K, *bimage,
@@ -1200,6 +1219,7 @@ namespace DGtal
       ///
       /// @param[in] params the parameters:
       ///   - surfelAdjacency   [       0]: specifies the surfel adjacency (1:ext, 0:int)
+      ///   - threads           [       1]: the number of threads extracting the boundary, 0: one per hardware core.
       ///
       /// @return a smart pointer on the explicit digital surface
       /// representing the boundaries in the binary image.
@@ -1214,8 +1234,7 @@ namespace DGtal
           bool      surfel_adjacency = params[ "surfelAdjacency" ].as<int>();
           SurfelAdjacency< KSpace::dimension > surfAdj( surfel_adjacency );
           // Extracts all boundary surfels
-          Surfaces<KSpace>::sMakeBoundary( all_surfels, K, *bimage,
-                                           K.lowerBound(), K.upperBound() );
+          makeBoundary( all_surfels, *bimage, K, params );
           ExplicitSurfaceContainer* surfContainer
             = new ExplicitSurfaceContainer( K, surfAdj, all_surfels );
           return CountedPtr< DigitalSurface >
@@ -1268,6 +1287,7 @@ namespace DGtal
       ///   - surfelAdjacency   [     0]: specifies the surfel adjacency (1:ext, 0:int)
       ///   - nbTriesToFindABel [100000]: number of tries in method Surfaces::findABel
       ///   - surfaceComponents ["AnyBig"]: "AnyBig"|"All", "AnyBig": any big-enough component (> twice space width), "All": all components
+      ///   - threads           [     1]: the number of threads extracting all the components, 0: one per hardware core.
       ///
       /// @return a smart pointer on the required indexed digital surface.
       static CountedPtr<IdxDigitalSurface>
@@ -1285,8 +1305,7 @@ namespace DGtal
           }
         else if ( component == "All" )
           {
-            Surfaces<KSpace>::sMakeBoundary( surfels, K, *bimage,
-                                             K.lowerBound(), K.upperBound() );
+            makeBoundary( surfels, *bimage, K, params );
           }
         return makeIdxDigitalSurface( surfels, K, params );
       }    
@@ -3276,8 +3295,49 @@ namespace DGtal
     protected:
 
       // ------------------------- Internals ------------------------------------
+    protected:
+
+      /// @param[in] params the parameters (only "threads" is used).
+      /// @return the parallel policy given by parameter "threads":
+      /// 1 is sequential, 0 uses one thread per hardware core.
+      static ParallelPolicy getParallelPolicy( const Parameters& params )
+      {
+        const int threads = params[ "threads" ].as<int>();
+        return ( threads == 1 )
+          ? ParallelPolicy::sequential()
+          : ParallelPolicy::threads( static_cast<unsigned int>( std::max( threads, 0 ) ) );
+      }
+
     private:
 
+      /// Extracts all the boundary surfels of a shape within the
+      /// bounds of \a K, scanning slabs concurrently unless parameter
+      /// "threads" is 1.
+      ///
+      /// @param[out] surfels the set of boundary surfels.
+      /// @param[in] shape any point predicate: Point -> boolean.
+      /// @param[in] K the Khalimsky space whose domain encompasses the shape.
+      /// @param[in] params the parameters (only "threads" is used).
+      template <typename TPointPredicate>
+        static void
+        makeBoundary( SurfelSet&             surfels,
+                      const TPointPredicate& shape,
+                      const KSpace&          K,
+                      const Parameters&      params )
+        {
+          if ( params[ "threads" ].as<int>() == 1 )
+            {
+              Surfaces<KSpace>::sMakeBoundary( surfels, K, shape,
+                                               K.lowerBound(), K.upperBound() );
+              return;
+            }
+          SurfelRange sorted_surfels;
+          Surfaces<KSpace>::sMakeBoundary( sorted_surfels, K, shape,
+                                           K.lowerBound(), K.upperBound(),
+                                           getParallelPolicy( params ) );
+          surfels.insert( sorted_surfels.begin(), sorted_surfels.end() );
+        }
+
     }; // end of class Shortcuts
 
 
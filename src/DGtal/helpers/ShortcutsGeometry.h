@@ -39,6 +39,7 @@
 #define ShortcutsGeometry_h
 
 //////////////////////////////////////////////////////////////////////////////
+#include <memory>
 #include "DGtal/helpers/Shortcuts.h"
 #include "DGtal/geometry/volumes/distance/LpMetric.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
@@ -51,6 +52,7 @@
 
 #include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
 #include "DGtal/dec/ATSolver2D.h"
+#include "DGtal/base/ParallelPolicy.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -639,6 +641,7 @@ namespace DGtal
       ///   - kernel          [ "hat"]: the kernel integration function chi_r, either "hat" or "ball". )
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - surfelEmbedding [     0]: the surfel -> point embedding for VCM estimator: 0: Pointels, 1: InnerSpel, 2: OuterSpel.
+      ///   - threads         [     1]: the number of threads of the II estimators, 0: one per hardware core.
       static Parameters parametersGeometryEstimation()
       {
         return Parameters
@@ -648,7 +651,8 @@ namespace DGtal
           ( "R-radius",       10.0 )
           ( "r-radius",        3.0 )
           ( "alpha",          0.33 )
-          ( "surfelEmbedding",   0 );
+          ( "surfelEmbedding",   0 )
+          ( "threads",           1 );
       }
 
       /// Given a digital space \a K and a vector of \a surfels,
@@ -832,6 +836,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads, 0: one per hardware core (the result does not depend on it).
       ///
       /// @return the vector containing the estimated normals, in the
       /// same order as \a surfels.
@@ -867,6 +872,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads, 0: one per hardware core (the result does not depend on it).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -908,6 +914,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads, 0: one per hardware core (the result does not depend on it).
       ///
       /// @return the vector containing the estimated normals, in the
       /// same order as \a surfels.
@@ -945,12 +952,8 @@ namespace DGtal
             }
           IINormalFunctor     functor;
           functor.init( h, r*h );
-          IINormalEstimator   ii_estimator( functor );
-          ii_estimator.attach( K, shape );
-          ii_estimator.setParams( r );
-          ii_estimator.init( h, surfels.begin(), surfels.end() );
-          ii_estimator.eval( surfels.begin(), surfels.end(),
-                             std::back_inserter( n_estimations ) );
+          n_estimations = getIIEstimations<IINormalEstimator>
+            ( shape, K, surfels, functor, h, r, params );
           const RealVectors n_trivial = getTrivialNormalVectors( K, surfels );
           orientVectors( n_estimations, n_trivial );
           return n_estimations;
@@ -969,6 +972,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads, 0: one per hardware core (the result does not depend on it).
       ///
       /// @return the vector containing the estimated mean curvatures, in the
       /// same order as \a surfels.
@@ -1000,6 +1004,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads, 0: one per hardware core (the result does not depend on it).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -1039,6 +1044,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads, 0: one per hardware core (the result does not depend on it).
       ///
       /// @return the vector containing the estimated mean curvatures, in the
       /// same order as \a surfels.
@@ -1072,12 +1078,8 @@ namespace DGtal
             }
           IIMeanCurvFunctor   functor;
           functor.init( h, r*h );
-          IIMeanCurvEstimator ii_estimator( functor );
-          ii_estimator.attach( K, shape );
-          ii_estimator.setParams( r );
-          ii_estimator.init( h, surfels.begin(), surfels.end() );
-          ii_estimator.eval( surfels.begin(), surfels.end(),
-                             std::back_inserter( mc_estimations ) );
+          mc_estimations = getIIEstimations<IIMeanCurvEstimator>
+            ( shape, K, surfels, functor, h, r, params );
           return mc_estimations;
         }
 
@@ -1093,6 +1095,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads, 0: one per hardware core (the result does not depend on it).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
       /// same order as \a surfels.
@@ -1124,6 +1127,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads, 0: one per hardware core (the result does not depend on it).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -1163,6 +1167,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads, 0: one per hardware core (the result does not depend on it).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
       /// same order as \a surfels.
@@ -1196,12 +1201,8 @@ namespace DGtal
             }
           IIGaussianCurvFunctor   functor;
           functor.init( h, r*h );
-          IIGaussianCurvEstimator ii_estimator( functor );
-          ii_estimator.attach( K, shape );
-          ii_estimator.setParams( r );
-          ii_estimator.init( h, surfels.begin(), surfels.end() );
-          ii_estimator.eval( surfels.begin(), surfels.end(),
-                             std::back_inserter( mc_estimations ) );
+          mc_estimations = getIIEstimations<IIGaussianCurvEstimator>
+            ( shape, K, surfels, functor, h, r, params );
           return mc_estimations;
         }
 
@@ -1218,6 +1219,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads, 0: one per hardware core (the result does not depend on it).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
       /// same order as \a surfels.
@@ -1250,6 +1252,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads, 0: one per hardware core (the result does not depend on it).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -1289,6 +1292,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads, 0: one per hardware core (the result does not depend on it).
       ///
       /// @return the vector containing the estimated principal curvatures and directions,
       ///  in the same order as \a surfels.
@@ -1321,12 +1325,8 @@ namespace DGtal
         }
         IICurvFunctor   functor;
         functor.init( h, r*h );
-        IICurvEstimator ii_estimator( functor );
-        ii_estimator.attach( K, shape );
-        ii_estimator.setParams( r );
-        ii_estimator.init( h, surfels.begin(), surfels.end() );
-        ii_estimator.eval( surfels.begin(), surfels.end(),
-                          std::back_inserter( mc_estimations ) );
+        mc_estimations = getIIEstimations<IICurvEstimator>
+          ( shape, K, surfels, functor, h, r, params );
         return mc_estimations;
       }
 
@@ -1812,6 +1812,62 @@ namespace DGtal
       // ------------------------- Internals ------------------------------------
     private:
 
+      /// Evaluates an integral invariant estimator at the specified
+      /// surfels. With several threads (parameter "threads"), the
+      /// surfel range is split into contiguous chunks, balanced by
+      /// work stealing, and each thread owns its estimator (hence its
+      /// DigitalSurfaceConvolver). Convolutions are integer sums,
+      /// hence the estimations do not depend on the partition.
+      ///
+      /// @tparam TEstimator an IntegralInvariantVolumeEstimator or IntegralInvariantCovarianceEstimator.
+      /// @tparam TPointPredicate any type of map Point -> boolean.
+      /// @tparam TFunctor the type of functor of the estimator.
+      ///
+      /// @param[in] shape a function Point -> boolean telling if you are inside the shape.
+      /// @param[in] K the Khalimsky space where the shape and surfels live.
+      /// @param[in] surfels the sequence of surfels at which we compute the estimations.
+      /// @param[in] functor the initialized functor of the estimator.
+      /// @param[in] h the gridstep.
+      /// @param[in] r the digital radius of the kernel.
+      /// @param[in] params the parameters (only "threads" is used).
+      ///
+      /// @return the estimations, in the same order as \a surfels.
+      template <typename TEstimator, typename TPointPredicate, typename TFunctor>
+        static std::vector< typename TEstimator::Quantity >
+        getIIEstimations( const TPointPredicate&  shape,
+                          const KSpace&           K,
+                          const SurfelRange&      surfels,
+                          const TFunctor&         functor,
+                          Scalar                  h,
+                          Scalar                  r,
+                          const Parameters&       params )
+        {
+          const ParallelPolicy policy = Base::getParallelPolicy( params );
+          WorkStealingScheduler scheduler( policy );
+
+          // A few chunks per thread, so that consecutive surfels (which
+          // share most of their convolution) stay in the same chunk.
+          const std::size_t nb_chunks = policy.isSequential()
+            ? 1 : std::min< std::size_t >( surfels.size(), 8 * policy.nbThreads() );
+          std::vector< typename TEstimator::Quantity > estimations( surfels.size() );
+          std::vector< std::unique_ptr< TEstimator > > estimators( scheduler.nbThreads() );
+          scheduler.run( nb_chunks, [&] ( std::size_t i, unsigned int t )
+            {
+              if ( ! estimators[ t ] )
+                {
+                  estimators[ t ].reset( new TEstimator( functor ) );
+                  estimators[ t ]->attach( K, shape );
+                  estimators[ t ]->setParams( r );
+                  estimators[ t ]->init( h, surfels.begin(), surfels.end() );
+                }
+              const std::size_t b = ( surfels.size() * i ) / nb_chunks;
+              const std::size_t e = ( surfels.size() * ( i + 1 ) ) / nb_chunks;
+              estimators[ t ]->eval( surfels.begin() + b, surfels.begin() + e,
+                                     estimations.begin() + b );
+            } );
+          return estimations;
+        }
+
     }; // end of class ShortcutsGeometry
 
 
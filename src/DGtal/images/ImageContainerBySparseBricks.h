@@ -0,0 +1,680 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerBySparseBricks.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ImageContainerBySparseBricks.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerBySparseBricks_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerBySparseBricks.h
+#else // defined(ImageContainerBySparseBricks_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerBySparseBricks_RECURSES
+
+#if !defined ImageContainerBySparseBricks_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerBySparseBricks_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <array>
+#include <string>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/SetValueIterator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerBySparseBricks
+  /**
+   * Description of template class 'ImageContainerBySparseBricks' <p>
+   * \brief Aim: Model of CImage storing a mostly-empty image of a
+   * HyperRectDomain as a shallow tree of dense bricks, in the spirit of
+   * VDB.
+   *
+   * The domain is cut into dense leaf bricks of side \f$ 2^{L} \f$
+   * (template parameter TLog2LeafSide, 8 voxels by default), grouped
+   * into internal nodes of \f$ 2^{N} \f$ bricks per side
+   * (TLog2NodeSide, 16 by default), themselves indexed by a dense root
+   * grid. Only the nodes and the bricks containing at least one stored
+   * voxel are allocated. Each brick stores the values of its voxels
+   * and a bit mask of its \e active voxels. A voxel is active if and
+   * only if its value differs from the background value given at
+   * construction: setting a voxel to the background value makes it
+   * inactive. Reading or writing a voxel costs two array lookups, and
+   * ConstAccessor caches the last visited brick so that neighbor
+   * accesses are amortized O(1).
+   *
+   * For a \f$ 2048^3 \f$ domain with default parameters, the root has
+   * \f$ 16^3 \f$ entries and each allocated node \f$ 16^3 \f$ brick
+   * indices (16KB), so that the memory is essentially proportional to
+   * the number of non-empty bricks, instead of the \f$ 2^{33} \f$
+   * values of ImageContainerBySTLVector.
+   *
+   * The active voxels also form a digital set: the class provides the
+   * services of CDigitalSet (insert, erase, find, iteration, etc), the
+   * iteration visiting the active voxels in the order of the domain
+   * (first coordinate fastest) row by row, skipping empty bricks. A
+   * voxel inserted as a point takes the foreground value given at
+   * construction. When Value is \c bool (with default background \c
+   * false and foreground \c true), the image is a model of both
+   * CImage and CDigitalSet since operator() is then the membership
+   * predicate. Bulk creation from a digital set or from a range of
+   * points is done by setValues, which allocates all the needed bricks
+   * at once.
+   *
+   * @code
+   typedef ImageContainerBySparseBricks<Z3i::Domain, bool> SparseSet;
+   SparseSet set( Z3i::Domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( 2047 ) ) );
+   set.setValues( digitalSet.begin(), digitalSet.end(), true );
+   SparseSet::ConstAccessor acc( set );
+   for ( auto const & p : set )
+     if ( ! acc( p + Z3i::Point( 1, 0, 0 ) ) ) ... // p is a boundary voxel
+   * @endcode
+   *
+   * Iterators and accessors are invalidated by insertions that create
+   * new bricks (like std::vector iterators), and remain valid after
+   * erasures, which never release bricks (see prune()).
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue the type of the values, a model of CLabel.
+   * @tparam TLog2LeafSide the base-2 logarithm of the side of leaf
+   * bricks (1 to 6).
+   * @tparam TLog2NodeSide the base-2 logarithm of the side of internal
+   * nodes, counted in bricks.
+   *
+   * @see testImageContainerBySparseBricks.cpp, benchmarkImageContainer.cpp
+   */
+  template <typename TDomain, typename TValue,
+            unsigned int TLog2LeafSide = 3, unsigned int TLog2NodeSide = 4>
+  class ImageContainerBySparseBricks
+  {
+  public:
+    typedef ImageContainerBySparseBricks<TDomain, TValue, TLog2LeafSide, TLog2NodeSide> Self;
+
+    /// domain
+    typedef TDomain Domain;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain, HyperRectDomain<Space> >::value ));
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT(( concepts::CLabel<TValue> ));
+    typedef TValue Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self> OutputIterator;
+
+    /// The type of a word of the masks of active voxels.
+    typedef DGtal::uint64_t Word;
+    /// The type of the indices of nodes and bricks.
+    typedef DGtal::uint32_t Index;
+
+    /// static constants
+    static constexpr Dimension dimension = Space::dimension;
+    static constexpr unsigned int Log2LeafSide = TLog2LeafSide;
+    static constexpr unsigned int LeafSide = 1u << TLog2LeafSide;
+    static constexpr Size LeafVolume = Size( 1 ) << ( TLog2LeafSide * dimension );
+    static constexpr unsigned int Log2NodeSide = TLog2NodeSide;
+    static constexpr unsigned int NodeSide = 1u << TLog2NodeSide;
+    static constexpr Size NodeVolume = Size( 1 ) << ( TLog2NodeSide * dimension );
+    static constexpr Size MaskSize = ( LeafVolume + 63 ) / 64;
+    /// The index of missing nodes and bricks.
+    static constexpr Index NoIndex = ~Index( 0 );
+
+    BOOST_STATIC_ASSERT(( TLog2LeafSide >= 1 && TLog2LeafSide <= 6 ));
+
+    /// A dense brick of voxels.
+    struct Leaf
+    {
+      /// The lowest point of the brick.
+      Point origin;
+      /// The position of the brick in the node table.
+      Size slot;
+      /// The number of active voxels of the brick.
+      Size count;
+      /// The bit mask of active voxels (first coordinate fastest).
+      std::array<Word, MaskSize> mask;
+      /// The values of the voxels (first coordinate fastest).
+      std::array<Value, LeafVolume> values;
+    };
+
+    /**
+       Constant iterator on the active voxels, visited in the order of
+       the domain (first coordinate fastest). It scans the rows of
+       voxels crossing non-empty bricks, brick after brick.
+    */
+    class ConstIterator
+      : public boost::iterator_facade< ConstIterator, Point const,
+                                       std::forward_iterator_tag >
+    {
+      friend class ImageContainerBySparseBricks;
+      friend class boost::iterator_core_access;
+    public:
+      /// Default constructor (singular iterator).
+      ConstIterator();
+
+    private:
+      /**
+         Constructor at the beginning (or the end) of an image.
+         @param image the iterated image.
+         @param atEnd when 'true', builds the past-the-end iterator.
+      */
+      ConstIterator( const Self* image, bool atEnd );
+
+      /// @return the bits of the current row in the current brick.
+      Word rowBits() const;
+      /// Moves to the next row of voxels, @return 'false' at the end.
+      bool nextRow();
+      /// Moves to the first active voxel from the current position.
+      void seek();
+      /// Sets the past-the-end position.
+      void setEnd();
+
+      /// Iterator service for boost::iterator_facade.
+      void increment();
+      /// Iterator service for boost::iterator_facade.
+      bool equal( const ConstIterator & other ) const;
+      /// Iterator service for boost::iterator_facade.
+      Point const & dereference() const;
+
+      /// The iterated image.
+      const Self* myImage;
+      /// The current group of bricks (bricks sharing a row of bricks).
+      Size myGroup;
+      /// The offsets of the current row in the bricks (coordinates 1..d-1).
+      std::array<unsigned int, dimension> myOffsets;
+      /// The position of the current brick in the ordered bricks.
+      Size myRank;
+      /// The active voxels of the current row not visited yet.
+      Word myBits;
+      /// The current point.
+      Point myPoint;
+    };
+    typedef ConstIterator Iterator;
+
+    /**
+       Cached read access to the values of an image: the brick of the
+       last accessed voxel is kept, so that accessing its neighbors
+       does not go through the tree. It is invalidated by insertions
+       in the image.
+    */
+    class ConstAccessor
+    {
+    public:
+      /**
+         Constructor.
+         @param image the accessed image.
+      */
+      ConstAccessor( const Self & image );
+
+      /**
+         @param p any point of the domain.
+         @return the value of the image at \a p.
+      */
+      Value operator()( const Point & p ) const;
+
+      /**
+         @param p any point of the domain.
+         @return 'true' iff \a p is an active voxel.
+      */
+      bool isActive( const Point & p ) const;
+
+    private:
+      /// Caches the brick of \a p, @return the offset of \a p in its brick.
+      Size cache( const Point & p ) const;
+
+      /// The accessed image.
+      const Self* myImage;
+      /// The lowest point of the cached brick.
+      mutable Point myOrigin;
+      /// The cached brick or 0 if it is not allocated.
+      mutable const Leaf* myLeaf;
+      /// 'true' iff some brick is cached.
+      mutable bool myValid;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Creates an image whose voxels all have the
+     * background value, i.e. an empty set.
+     *
+     * @param aDomain the image domain.
+     * @param aBackground the value of the inactive voxels.
+     * @param aForeground the value given to the points inserted as a
+     * digital set (see insert).
+     */
+    ImageContainerBySparseBricks( Clone<Domain> aDomain,
+                                  const Value & aBackground = Value(),
+                                  const Value & aForeground = Value( 1 ) );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    ImageContainerBySparseBricks( const ImageContainerBySparseBricks & other ) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    ImageContainerBySparseBricks & operator=( const ImageContainerBySparseBricks & other ) = default;
+
+    /**
+     * Destructor.
+     */
+    ~ImageContainerBySparseBricks() = default;
+
+    // ----------------------- Image services ---------------------------------
+  public:
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint, the background value for inactive voxels.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point. The
+     * voxel becomes active, unless \a aValue is the background value.
+     *
+     * @pre @c aPoint must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * Sets the same value to a collection of points in bulk: the
+     * needed bricks are allocated at once, in the order of the tree,
+     * before the values are written brick after brick.
+     *
+     * @param first the start point in the collection of Point (for
+     * instance the begin() of a digital set).
+     * @param last the last point in the collection of Point.
+     * @param aValue the value.
+     * @pre all points should belong to the domain.
+     */
+    template <typename PointInputIterator>
+    void setValues( PointInputIterator first, PointInputIterator last,
+                    const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a copy-on-write pointer on the domain.
+     */
+    CowPtr<Domain> domainPointer() const;
+
+    /**
+     * @return the const range providing constant
+     * iterators to iterate over the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing constant iterators
+     * and output iterators on the values of the image.
+     */
+    Range range();
+
+    /**
+     * @return an output iterator on the image.
+     */
+    OutputIterator outputIterator();
+
+    /**
+     * @return the value of the inactive voxels.
+     */
+    const Value & backgroundValue() const;
+
+    /**
+     * @return the value given to the points inserted as a digital set.
+     */
+    const Value & foregroundValue() const;
+
+    /**
+     * @return the number of allocated bricks.
+     */
+    Size nbBricks() const;
+
+    /**
+     * @return the number of bytes used by the image (nodes, bricks
+     * and iteration structures).
+     */
+    Size memoryUsage() const;
+
+    /**
+     * Releases the bricks without active voxels, and the nodes without
+     * bricks. Iterators and accessors are invalidated.
+     */
+    void prune();
+
+    // ----------------------- Digital set services ---------------------------
+  public:
+
+    /**
+     * @return the number of active voxels.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff there is no active voxel.
+     */
+    bool empty() const;
+
+    /**
+     * @param p any point.
+     * @return 'true' iff \a p is an active voxel of the domain.
+     */
+    bool isActive( const Point & p ) const;
+
+    /**
+     * Activates point [p] with the foreground value, if it is not
+     * already active.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Inserts the collection of points specified by the two iterators
+     * in bulk (see setValues).
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Same as insert.
+     * @param p any digital point.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Same as insert.
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Deactivates point [p] (its value becomes the background value).
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Deactivates the point pointed by [it]. Iterators remain valid.
+     *
+     * @param it an iterator on this set.
+     * @pre it should point on a valid element ( it != end() ).
+     */
+    void erase( Iterator it );
+
+    /**
+     * Deactivates the points specified by the two iterators.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Deactivates all voxels. Bricks are kept (see prune()).
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if active, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first active voxel.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator after the last active voxel.
+     */
+    ConstIterator end() const;
+
+    /**
+     * Union to left: the active voxels of \a other are copied with
+     * their values, brick by brick when both images share the same
+     * domain.
+     *
+     * @param other any other image.
+     * @return a reference on 'this'.
+     */
+    Self & operator+=( const Self & other );
+
+    /**
+     * Computes the complement in the domain of the active voxels.
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement( TOutputIterator& ito ) const;
+
+    /**
+     * Activates, with the foreground value, exactly the voxels that
+     * are not active in \a other_set.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const Self & other_set );
+
+    /**
+     * Computes the bounding box of the active voxels.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /// The image domain.
+    CowPtr<Domain> myDomain;
+    /// The value of the inactive voxels.
+    Value myBackground;
+    /// The value given to the inserted points.
+    Value myForeground;
+    /// The number of nodes of the root along each axis.
+    Point myRootExtent;
+    /// The root grid: index of the node of each root cell or NoIndex.
+    std::vector<Index> myRoot;
+    /// The node tables, NodeVolume brick indices (or NoIndex) per node.
+    std::vector<Index> myNodes;
+    /// The bricks.
+    std::vector<Leaf> myLeaves;
+    /// The number of active voxels.
+    Size mySize;
+
+    /// 'true' when the bricks have changed since the last computation of their order.
+    mutable bool myOrderIsDirty;
+    /// The bricks sorted in the order of the domain (last coordinate first).
+    mutable std::vector<Index> myOrder;
+    /// The rank of each brick in myOrder.
+    mutable std::vector<Index> myRanks;
+    /// The first rank of each group of bricks sharing coordinates 1..d-1, plus the end.
+    mutable std::vector<Index> myGroups;
+    /// The group of each rank.
+    mutable std::vector<Index> myGroupOfRank;
+    /// For each level j in 1..d-1, the first group of the block of each group.
+    mutable std::array<std::vector<Index>, dimension> myBlockBegin;
+    /// For each level j in 1..d-1, the end group of the block of each group.
+    mutable std::array<std::vector<Index>, dimension> myBlockEnd;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    ImageContainerBySparseBricks();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param p any point of the domain.
+     * @return the index of the root cell containing \a p.
+     */
+    Size rootIndex( const Point & p ) const;
+
+    /**
+     * @param p any point of the domain.
+     * @return the position of the brick of \a p in its node.
+     */
+    Size nodeOffset( const Point & p ) const;
+
+    /**
+     * @param p any point of the domain.
+     * @return the offset of \a p in its brick.
+     */
+    static Size offset( const Point & p, const Point & origin );
+
+    /**
+     * @param p any point of the domain.
+     * @return the lowest point of the brick of \a p.
+     */
+    Point brickOrigin( const Point & p ) const;
+
+    /**
+     * @param p any point of the domain.
+     * @return the index of the brick of \a p, or NoIndex.
+     */
+    Index leafIndex( const Point & p ) const;
+
+    /**
+     * @param p any point of the domain.
+     * @return the index of the brick of \a p, which is allocated if needed.
+     */
+    Index getOrCreateLeaf( const Point & p );
+
+    /**
+     * Activates the voxel at offset \a o of brick \a leaf with value \a aValue.
+     */
+    void activate( Leaf & leaf, Size o, const Value & aValue );
+
+    /**
+     * Computes the order of bricks used by iterators, if needed.
+     */
+    void updateOrder() const;
+
+  }; // end of class ImageContainerBySparseBricks
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerBySparseBricks'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerBySparseBricks' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue, unsigned int L, unsigned int N>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageContainerBySparseBricks<TDomain, TValue, L, N> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerBySparseBricks.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerBySparseBricks_h
+
+#undef ImageContainerBySparseBricks_RECURSES
+#endif // else defined(ImageContainerBySparseBricks_RECURSES)
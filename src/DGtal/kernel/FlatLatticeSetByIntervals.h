@@ -0,0 +1,512 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+/**
+ * @file FlatLatticeSetByIntervals.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module FlatLatticeSetByIntervals.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(FlatLatticeSetByIntervals_RECURSES)
+#error Recursive header files inclusion detected in FlatLatticeSetByIntervals.h
+#else // defined(FlatLatticeSetByIntervals_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FlatLatticeSetByIntervals_RECURSES
+
+#if !defined FlatLatticeSetByIntervals_h
+/** Prevents repeated inclusion of headers. */
+#define FlatLatticeSetByIntervals_h
+
+#include <iostream>
+#include <map>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelPolicy.h"
+#include "DGtal/kernel/CSpace.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/kernel/IntegralIntervals.h"
+#include "DGtal/kernel/LatticeSetByIntervals.h"
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FlatLatticeSetByIntervals
+  /**
+     Description of template class 'FlatLatticeSetByIntervals' <p> \brief Aim:
+
+     A class that represents a set of lattice points using intervals
+     along a given axis, like LatticeSetByIntervals, but stored in
+     flat arrays: the sorted array of (non empty) rows, and the
+     intervals of all rows stored contiguously, row after row (in
+     compressed sparse row form).
+
+     Rows are sorted like the keys of LatticeSetByIntervals (a row is
+     the point with a null coordinate along the axis), so that both
+     representations convert to each other in linear time and give
+     the same point ranges. Set operations are merge-joins of the
+     sorted rows, without any memory allocation per row, and the star
+     and skeleton operations, which are the core of full convexity
+     checks, process independent ranges of rows in parallel according
+     to a ParallelPolicy (sequentially by default, since sets built
+     in full convexity checks are generally small).
+
+     Contrary to LatticeSetByIntervals, points are not inserted one by
+     one: the set is built at once from a range of points, from
+     another lattice set, or by appending rows in increasing order.
+
+     @code
+     typedef FlatLatticeSetByIntervals< Z3i::Space > FlatLatticeSet;
+     FlatLatticeSet X( points.cbegin(), points.cend() );
+     FlatLatticeSet StarX = X.starOfPoints();
+     FlatLatticeSet Skel  = StarX.skeletonOfCells( ParallelPolicy::threads( 4 ) );
+     bool ok = StarX.includes( Skel.starOfCells() );
+     @endcode
+
+     @tparam TSpace any model of concepts::CSpace, for instance any SpaceND like Z2i::Space, Z3i::Space.
+
+     @see LatticeSetByIntervals
+  */
+  template < typename TSpace >
+  class FlatLatticeSetByIntervals
+  {
+  public:
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
+
+    typedef TSpace Space;
+    using Self       = FlatLatticeSetByIntervals< Space >;
+    using Point      = typename Space::Point;
+    using Vector     = typename Space::Vector;
+    using Integer    = typename Space::Integer;
+    using PointRange = std::vector< Point >;
+    using Intervals  = IntegralIntervals< Integer >;
+    using Interval   = typename Intervals::Interval;
+    using LatticeSet = LatticeSetByIntervals< Space >;
+    using LatticeSetByInterval = std::map< Point, Interval >;
+    using Size       = std::size_t;
+    using size_type  = Size;
+    static const Dimension dimension = Space::dimension;
+
+    //------------------- standard services (construction, move) -------------------
+  public:
+    /// @name Standard services (construction, move, clear)
+    /// @{
+
+    /// Constructor from axis.
+    /// @param axis the row axis chosen for stacking the points.
+    FlatLatticeSetByIntervals( Dimension axis = 0 )
+      : myAxis( axis ), myRows(), myOffsets( 1, 0 ), myIntervals() {}
+
+    /// Copy constructor
+    /// @param other any other object.
+    FlatLatticeSetByIntervals( const Self & other ) = default;
+
+    /// Move constructor (arrays are moved, not reallocated).
+    /// @param other any other object.
+    FlatLatticeSetByIntervals( Self&& other ) = default;
+
+    /// Assignment.
+    /// @param other any other object.
+    /// @return a reference to this object
+    Self& operator=( const Self & other ) = default;
+
+    /// Move Assignment (arrays are moved, not reallocated).
+    /// @param other any other object.
+    /// @return a reference to this object
+    Self& operator=( Self&& other ) = default;
+
+    /// Constructor from range of points (in any order).
+    /// @tparam PointIterator any model of input iterator on points.
+    /// @param it,itE the range of point
+    /// @param axis the row axis chosen for stacking the points.
+    template <typename PointIterator>
+    FlatLatticeSetByIntervals( PointIterator it, PointIterator itE, Dimension axis = 0 );
+
+    /// Constructor from lattice set of interval (often a lattice set
+    /// representation for a polytope, since there is at most one
+    /// interval per row).
+    ///
+    /// @param aSet any lattice set represented by one (closed)
+    /// interval per row, rows having a null coordinate along \a axis.
+    /// @param axis the row axis chosen for stacking the points in \a aSet.
+    FlatLatticeSetByIntervals( const LatticeSetByInterval& aSet, Dimension axis );
+
+    /// Constructor from a lattice set by intervals.
+    /// @param aSet any lattice set.
+    explicit FlatLatticeSetByIntervals( const LatticeSet& aSet );
+
+    /// Clears the data structure (memory is kept for further use).
+    void clear();
+
+    /// Swaps the content of this object with \a other.
+    /// @param other any other object.
+    void swap( Self& other );
+
+    /// Change the main axis of projection. If the object is not
+    /// empty, it empties the object.
+    ///
+    /// @param axis any valid integer between 0 and dimension
+    /// (excluded)
+    void setAxis( Dimension axis )
+    {
+      clear();
+      myAxis = axis;
+    }
+
+    /// @return the main axis of projection
+    Dimension axis() const
+    { return myAxis; }
+
+    /// @}
+
+    //------------------- conversion services -----------------------------
+  public:
+    /// @name conversion services
+    /// @{
+
+    /// @return the range of points stored in this lattice set, in
+    /// the same order as LatticeSetByIntervals::toPointRange.
+    PointRange toPointRange() const;
+
+    /// @return the same set represented as a LatticeSetByIntervals.
+    LatticeSet toLatticeSet() const;
+
+    /// @}
+
+    //------------------- capacity services -----------------------------
+  public:
+    /// @name capacity services
+    /// @{
+
+    /// @return 'true' iff this object represents the empty set.
+    bool empty() const
+    {
+      return myRows.empty();
+    }
+
+    /// @return the number of lattice points represented in this object.
+    ///
+    /// @warning The complexity is linear in the number of stored intervals.
+    Size size() const;
+
+    /// @return the number of (non empty) rows.
+    Size nbRows() const
+    {
+      return myRows.size();
+    }
+
+    /// @return the number of intervals.
+    Size nbIntervals() const
+    {
+      return myIntervals.size();
+    }
+
+    /// @return an evaluation of the memory usage of this data structure.
+    Size memory_usage() const noexcept
+    {
+      return sizeof( Self )
+        + sizeof( Point )    * myRows.capacity()
+        + sizeof( Size )     * myOffsets.capacity()
+        + sizeof( Interval ) * myIntervals.capacity();
+    }
+
+    /// @}
+
+    //------------------- row services -----------------------------
+  public:
+    /// @name row services
+    /// @{
+
+    /// @param i any row index in [0, nbRows()).
+    /// @return the row point (with a null coordinate along the axis).
+    const Point& row( Size i ) const
+    {
+      return myRows[ i ];
+    }
+
+    /// @param i any row index in [0, nbRows()).
+    /// @return a pointer to the first interval of row \a i.
+    const Interval* intervalsBegin( Size i ) const
+    {
+      return myIntervals.data() + myOffsets[ i ];
+    }
+
+    /// @param i any row index in [0, nbRows()).
+    /// @return a pointer after the last interval of row \a i.
+    const Interval* intervalsEnd( Size i ) const
+    {
+      return myIntervals.data() + myOffsets[ i + 1 ];
+    }
+
+    /// @param q any point (its coordinate along the axis is ignored).
+    /// @return the index of the row containing \a q, or 'nbRows()' if
+    /// there is none.
+    Size findRow( Point q ) const;
+
+    /// @param p any point.
+    /// @return the number of times \a p is in the set (either 0 or 1).
+    Size count( const Point& p ) const;
+
+    /// Appends a row after the last one.
+    ///
+    /// @param q the row point, with a null coordinate along the axis,
+    /// which must be greater than the last row.
+    /// @param itB,itE a range of sorted disjoint intervals (empty rows are ignored).
+    void appendRow( const Point& q, const Interval* itB, const Interval* itE );
+
+    /// Appends a row with one interval after the last one.
+    ///
+    /// @param q the row point, with a null coordinate along the axis,
+    /// which must be greater than the last row.
+    /// @param I any valid interval (I.first <= I.second).
+    void appendRow( const Point& q, const Interval& I )
+    {
+      appendRow( q, &I, &I + 1 );
+    }
+
+    /// @}
+
+    //------------------- set operations --------------------------------
+  public:
+    /// @name set operations
+    /// @{
+
+    /// Performs the union of set \a other with this object.
+    /// @param other any lattice set with the same axis.
+    /// @return a reference to this object
+    Self& add( const Self& other )
+    {
+      Self U = set_union( other );
+      swap( U );
+      return *this;
+    }
+
+    /// Subtract set \a other from this object.
+    /// @param other any lattice set with the same axis.
+    /// @return a reference to this object
+    Self& subtract( const Self& other )
+    {
+      Self D = set_difference( other );
+      swap( D );
+      return *this;
+    }
+
+    /// Performs the set union between this and other by a merge-join
+    /// of rows.
+    /// @param other any lattice set with the same axis.
+    /// @return the set union between this and other.
+    Self set_union( const Self& other ) const;
+
+    /// Performs the set intersection between this and other by a
+    /// merge-join of rows.
+    /// @param other any lattice set with the same axis.
+    /// @return the set intersection between this and other.
+    Self set_intersection( const Self& other ) const;
+
+    /// Performs the set difference between this and other by a
+    /// merge-join of rows.
+    /// @param other any lattice set with the same axis.
+    /// @return the set difference between this and other.
+    Self set_difference( const Self& other ) const;
+
+    /// @param other any lattice set with the same axis.
+    /// @return 'true' iff this lattice set includes the lattice set \a other.
+    bool includes( const Self& other ) const;
+
+    /// @param other any lattice set with the same axis.
+    /// @return 'true' iff this lattice set equals the lattice set \a other.
+    bool equals( const Self& other ) const;
+
+    /// @}
+
+    //------------------- topology operations --------------------------------
+  public:
+    /// @name topology operations
+    /// @{
+
+    /// Consider the set of integers as points, transform them into
+    /// pointels in Khalimsky coordinates and build their star (see
+    /// LatticeSetByIntervals::starOfPoints).
+    ///
+    /// @param policy the parallel policy used to process rows.
+    /// @return the star of this set of points transformed to
+    /// pointels, i.e. the smallest open cell complex containing it.
+    Self starOfPoints( const ParallelPolicy& policy = ParallelPolicy::sequential() ) const;
+
+    /// Consider the set of integers as cells represented by their
+    /// Khalimsky coordinates, and build their star (see
+    /// LatticeSetByIntervals::starOfCells).
+    ///
+    /// @param policy the parallel policy used to process rows.
+    /// @return the star of this set of cells, i.e. the smallest open
+    /// cell complex containing it.
+    Self starOfCells( const ParallelPolicy& policy = ParallelPolicy::sequential() ) const;
+
+    /// Consider the set of integers as cells represented by their
+    /// Khalimsky coordinates, and build their skeleton (see
+    /// LatticeSetByIntervals::skeletonOfCells).
+    ///
+    /// @param policy the parallel policy used to process rows.
+    /// @return the skeleton of this set of cells, i.e. the smallest
+    /// set of cells such that its star covers it.
+    Self skeletonOfCells( const ParallelPolicy& policy = ParallelPolicy::sequential() ) const;
+
+    /// @return the sorted range of points that contains the vertices
+    /// of all the cells stored in this set (see
+    /// LatticeSetByIntervals::extremaOfCells).
+    PointRange extremaOfCells() const;
+
+    /// @}
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if rows are sorted and not empty, and their
+     * intervals are sorted and disjoint.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// The axis along which data is stacked in intervals
+    Dimension myAxis;
+    /// The sorted rows (points with a null coordinate along the axis).
+    std::vector< Point > myRows;
+    /// The intervals of row i are myIntervals[ myOffsets[ i ] ... myOffsets[ i+1 ] ).
+    std::vector< Size > myOffsets;
+    /// The intervals of all rows.
+    std::vector< Interval > myIntervals;
+
+    // ------------------------- Internals ------------------------------------
+  protected:
+
+    /// Adds row \a q after the last one if intervals have been
+    /// appended since the last row, otherwise does nothing.
+    /// @param q the row point.
+    void closeRow( const Point& q )
+    {
+      if ( myIntervals.size() > myOffsets.back() )
+        {
+          myRows.push_back( q );
+          myOffsets.push_back( myIntervals.size() );
+        }
+    }
+
+    /// Splits the rows [0,nbRows()) in consecutive ranges, lets \a f
+    /// build the part of the output set corresponding to each range
+    /// (in parallel according to \a policy), and concatenates the
+    /// parts.
+    ///
+    /// @tparam RowsFunctor the type of functor, called as f( part, b,
+    /// e ), which appends to \a part the output rows associated to
+    /// the rows [b,e), in increasing order, and such that output rows
+    /// of consecutive ranges are increasing too.
+    ///
+    /// @param policy the parallel policy.
+    /// @param f the functor.
+    /// @return the concatenation of all parts.
+    template < typename RowsFunctor >
+    Self rowParallel( const ParallelPolicy& policy, const RowsFunctor& f ) const;
+
+    /// @return the star of this set along the axis dimension only.
+    Self starOfCellsAlongAxis( const ParallelPolicy& policy ) const;
+
+    /// @param k any dimension different from the axis.
+    /// @param policy the parallel policy used to process rows.
+    /// @return the union of this set and of its rows with even
+    /// coordinate \a k translated by -1 and +1 along dimension \a k.
+    Self dilateRows( Dimension k, const ParallelPolicy& policy ) const;
+
+    /// Appends an interval at the end of \a out, merging it with the
+    /// last interval if they overlap or touch and if the last one
+    /// belongs to the current row.
+    /// @param out the intervals
+    /// @param start the index of the first interval of the current row.
+    /// @param I any interval.
+    static void pushInterval( std::vector< Interval >& out, Size start,
+                              const Interval& I )
+    {
+      if ( out.size() > start && I.first <= out.back().second + 1 )
+        out.back().second = std::max( out.back().second, I.second );
+      else
+        out.push_back( I );
+    }
+
+    /// Appends the union of \a n ranges of sorted disjoint intervals
+    /// as a new row of \a out (without closing it).
+    /// @param b,e the arrays of \a n beginnings and ends of ranges.
+    /// @param n the number of ranges (at most 3).
+    /// @param out the intervals
+    /// @param start the index of the first interval of the current row.
+    static void unionOf( const Interval** b, const Interval** e, int n,
+                         std::vector< Interval >& out, Size start );
+
+    /// Appends the intersection of two ranges of sorted disjoint
+    /// intervals at the end of \a out.
+    static void intersectionOf( const Interval* a, const Interval* aE,
+                                const Interval* b, const Interval* bE,
+                                std::vector< Interval >& out );
+
+    /// Appends the difference of two ranges of sorted disjoint
+    /// intervals at the end of \a out.
+    static void differenceOf( const Interval* a, const Interval* aE,
+                              const Interval* b, const Interval* bE,
+                              std::vector< Interval >& out );
+
+    /// @return 'true' iff the range of sorted disjoint intervals [a,aE)
+    /// includes the range [b,bE).
+    static bool includes( const Interval* a, const Interval* aE,
+                          const Interval* b, const Interval* bE );
+
+  }; // end of class FlatLatticeSetByIntervals
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FlatLatticeSetByIntervals'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FlatLatticeSetByIntervals' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const FlatLatticeSetByIntervals<TSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/FlatLatticeSetByIntervals.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FlatLatticeSetByIntervals_h
+
+#undef FlatLatticeSetByIntervals_RECURSES
+#endif // else defined(FlatLatticeSetByIntervals_RECURSES)
@@ -157,6 +157,9 @@ namespace DGtal
     /// @return a reference to the container
     Container& data() { return myData; }
 
+    /// @return a const reference to the container
+    const Container& data() const { return myData; }
+
     /// @}
 
     //------------------- conversion services -----------------------------
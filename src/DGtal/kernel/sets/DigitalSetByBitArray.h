@@ -0,0 +1,520 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByBitArray.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module DigitalSetByBitArray.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByBitArray_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByBitArray.h
+#else // defined(DigitalSetByBitArray_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByBitArray_RECURSES
+
+#if !defined DigitalSetByBitArray_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByBitArray_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByBitArray
+  /**
+    Description of template class 'DigitalSetByBitArray' <p> \brief
+    Aim: Realizes the concept CDigitalSet by storing one bit per point
+    of a HyperRectDomain.
+
+    The bits are packed in 64-bit words, following the column-major
+    linearization of the domain (see Linearizer): the first coordinate
+    is the fastest one. The memory footprint is thus `domain.size()/8`
+    bytes whatever the number of points in the set, which is much
+    smaller than the 24--40 bytes per point of DigitalSetBySTLVector
+    or DigitalSetBySTLSet as soon as the set fills a noticeable part
+    of its domain (typically dense voxel objects).
+
+    Belonging tests, insertions and deletions are in constant time. The
+    set operations between two sets of the same domain (assignUnion,
+    assignIntersection, assignDifference, assignSymmetricDifference,
+    assignFromComplement) and the counting of points are computed word
+    by word with bitwise operations and popcount. Iteration skips the
+    empty words and enumerates the points in increasing linearized
+    order.
+
+    @code
+    typedef DigitalSetByBitArray<Z3i::Domain> BitSet;
+    BitSet A( domain ), B( domain );
+    ...
+    A.assignIntersection( B ); // 64 points per operation
+    for ( auto const& p : A ) ...
+    @endcode
+
+    Note that the iterators are constant since a point of a set cannot
+    be modified in place, hence Iterator and ConstIterator are the
+    same type.
+
+    @tparam TDomain a HyperRectDomain.
+    @see CDigitalSet, DigitalSetSelector
+   */
+  template <typename TDomain>
+  class DigitalSetByBitArray
+  {
+  public:
+    typedef TDomain Domain;
+    typedef DigitalSetByBitArray<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    /// The type of a packed word of bits.
+    typedef DGtal::uint64_t Word;
+    /// The container storing the words of bits.
+    typedef std::vector<Word> Container;
+    /// The linearization of the points of the domain.
+    typedef Linearizer<Domain, ColMajorStorage> Linearization;
+
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain, HyperRectDomain<Space> >::value ));
+
+    /// The number of bits in a word.
+    static const Size WordSize = 64;
+
+    /**
+       Constant iterator on the points of a DigitalSetByBitArray. It
+       scans the words of the set, skipping empty words, and visits the
+       set bits of a word in increasing order.
+    */
+    class ConstIterator
+      : public boost::iterator_facade< ConstIterator, Point const,
+                                       std::forward_iterator_tag >
+    {
+      friend class DigitalSetByBitArray<TDomain>;
+      friend class boost::iterator_core_access;
+
+    public:
+      /// Default constructor (singular iterator).
+      ConstIterator();
+
+      /// @return the linearized index of the pointed point.
+      Size index() const;
+
+    private:
+      /**
+         Constructor from a set and a starting position.
+         @param set the iterated set.
+         @param wordIndex the index of the current word.
+         @param bits the bits of the current word that are not yet visited.
+      */
+      ConstIterator( const Self* set, Size wordIndex, Word bits );
+
+      /// Moves to the first set bit of myBits, or to the next non-empty word.
+      void seek();
+
+      /// Iterator service for boost::iterator_facade.
+      void increment();
+      /// Iterator service for boost::iterator_facade.
+      bool equal( const ConstIterator & other ) const;
+      /// Iterator service for boost::iterator_facade.
+      Point const & dereference() const;
+
+      /// The iterated set.
+      const Self* mySet;
+      /// The index of the current word.
+      Size myWordIndex;
+      /// The bits of the current word that are not yet visited.
+      Word myBits;
+      /// The linearized index of the current point.
+      Size myIndex;
+      /// The current point.
+      Point myPoint;
+    };
+
+    typedef ConstIterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByBitArray() = default;
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByBitArray( Clone<Domain> d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByBitArray ( const DigitalSetByBitArray & other ) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * @pre the domain of this should include the domain of \a other.
+     */
+    DigitalSetByBitArray & operator= ( const DigitalSetByBitArray & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a copy-on-write pointer on the embedding domain.
+     */
+    CowPtr<Domain> domainPointer() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set (constant time).
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set if the point is not already in the
+     * set. It is the same as insert for this container.
+     *
+     * @param p any digital point.
+     *
+     * @pre p should belong to the associated domain.
+     * @pre p should not belong to this.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     *
+     * @pre all points should belong to the associated domain.
+     * @pre each point should not belong to this.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set. Other iterators,
+     * and in particular the following ones, remain valid.
+     *
+     * @param it an iterator on this set.
+     * @pre it should point on a valid element ( it != end() ).
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * Give access to the underlying container of words.
+     * @return a const reference to the stored words.
+     */
+    const Container & container() const;
+
+    /**
+     * set union to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitArray<Domain> & operator+=
+    ( const DigitalSetByBitArray<Domain> & aSet );
+
+    // ----------------------- Model of concepts::CPointPredicate -------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Word-parallel set operations -------------------
+  public:
+
+    /**
+     * Set union to left, computed word by word when both sets share
+     * the same domain, point by point otherwise (the points of \a aSet
+     * outside the domain of this set are then ignored).
+     *
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & assignUnion( const Self & aSet );
+
+    /**
+     * Set intersection to left, computed word by word when both sets
+     * share the same domain, point by point otherwise.
+     *
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & assignIntersection( const Self & aSet );
+
+    /**
+     * Set difference to left (this minus \a aSet), computed word by
+     * word when both sets share the same domain, point by point
+     * otherwise.
+     *
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & assignDifference( const Self & aSet );
+
+    /**
+     * Set symmetric difference to left, computed word by word when
+     * both sets share the same domain, point by point otherwise (the
+     * points of \a aSet outside the domain of this set are then
+     * ignored).
+     *
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & assignSymmetricDifference( const Self & aSet );
+
+    /**
+     * Counts the points of the set with popcount. The result is
+     * always equal to size(), which is maintained incrementally.
+     *
+     * @return the number of points of the set.
+     */
+    Size count() const;
+
+    /**
+     * @param aSet any other set with the same domain.
+     * @return the number of points of the intersection of this set
+     * and \a aSet, without building it.
+     */
+    Size countIntersection( const Self & aSet ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this. It is computed word by word when both sets share the same
+     * domain.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const DigitalSetByBitArray<Domain> & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain. The pointed domain may be changed but it
+     * remains valid during the lifetime of the set.
+     */
+    CowPtr<Domain> myDomain;
+
+    /// The extent of the domain.
+    Point myExtent;
+
+    /// The number of points of the domain, i.e. the number of valid bits.
+    Size myNbBits;
+
+    /// The words storing the bits, the last one is padded with zeros.
+    Container myWords;
+
+    /// The number of points of the set.
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByBitArray();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param aSet any other set.
+     * @return 'true' iff \a aSet has the same domain as this set, hence
+     * the same layout of bits.
+     */
+    bool sameLayout( const Self & aSet ) const;
+
+    /**
+     * @param p any point of the domain.
+     * @return the linearized index of \a p.
+     */
+    Size index( const Point & p ) const;
+
+    /**
+     * @return the mask of the valid bits of the last word.
+     */
+    Word lastWordMask() const;
+
+  }; // end of class DigitalSetByBitArray
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByBitArray'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByBitArray' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DigitalSetByBitArray<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByBitArray.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByBitArray_h
+
+#undef DigitalSetByBitArray_RECURSES
+#endif // else defined(DigitalSetByBitArray_RECURSES)
@@ -48,6 +48,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetByBitArray.h"
 
 #include "DGtal/kernel/PointHashFunctions.h"
 #include <unordered_set>
@@ -83,6 +84,9 @@ namespace DGtal
    SpecificSet set1( domain );
    *
    * @endcode
+   *
+   * A WHOLE_DS set of a HyperRectDomain, i.e. a set filling a large
+   * part of its domain, is represented by a DigitalSetByBitArray.
    */
   template <typename Domain, int Preferences >
   struct DigitalSetSelector
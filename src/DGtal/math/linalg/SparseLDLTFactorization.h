@@ -0,0 +1,280 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SparseLDLTFactorization.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module SparseLDLTFactorization.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SparseLDLTFactorization_RECURSES)
+#error Recursive header files inclusion detected in SparseLDLTFactorization.h
+#else // defined(SparseLDLTFactorization_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SparseLDLTFactorization_RECURSES
+
+#if !defined SparseLDLTFactorization_h
+/** Prevents repeated inclusion of headers. */
+#define SparseLDLTFactorization_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <cstdint>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SparseLDLTFactorization
+  /**
+     Description of template class 'SparseLDLTFactorization' <p> \brief Aim:
+     A prefactored symmetric definite sparse matrix \f$ A = P^{-1} L D
+     L^T P \f$, computed with the simplicial LDLT solver of the
+     backend, whose factors are kept explicitly so that they can be
+     saved to and reloaded from a stream.
+
+     solve() is const and does not modify the object: several threads
+     may solve with the same factorization concurrently. It accepts
+     vectors as well as dense matrices, whose columns are as many
+     right-hand sides, and gives the same results as the simplicial
+     LDLT solver of the backend.
+
+     \code
+     typedef SparseLDLTFactorization< EigenLinearAlgebraBackend > Factorization;
+     Factorization ldlt;
+     ldlt.compute( A ); // prefactorization
+     ASSERT( ldlt.info() == Eigen::Success );
+     std::ofstream out( "A.ldlt", std::ios::binary );
+     ldlt.save( out );
+     ...
+     Factorization ldlt2;
+     std::ifstream in( "A.ldlt", std::ios::binary );
+     ldlt2.load( in );
+     DenseMatrix X = ldlt2.solve( B ); // one solution per column of B
+     \endcode
+
+     @tparam TLinearAlgebraBackend linear algebra backend used (i.e. EigenLinearAlgebraBackend).
+  */
+  template < typename TLinearAlgebraBackend >
+  class SparseLDLTFactorization
+  {
+  public:
+    typedef TLinearAlgebraBackend LinearAlgebraBackend;
+
+    typedef typename LinearAlgebraBackend::DenseVector::Index  Index;
+    typedef typename LinearAlgebraBackend::DenseVector::Scalar Scalar;
+    typedef typename LinearAlgebraBackend::DenseVector         DenseVector;
+    typedef typename LinearAlgebraBackend::DenseMatrix         DenseMatrix;
+    typedef typename LinearAlgebraBackend::SparseMatrix        SparseMatrix;
+    typedef typename LinearAlgebraBackend::SolverSimplicialLDLT Solver;
+    typedef typename SparseMatrix::StorageIndex                StorageIndex;
+    typedef Eigen::PermutationMatrix< Eigen::Dynamic, Eigen::Dynamic, StorageIndex >
+                                                               Permutation;
+
+    /// Default constructor. The factorization is empty.
+    SparseLDLTFactorization() : myInfo( Eigen::InvalidInput ) {}
+
+    /// Prefactors the given matrix.
+    /// @param A a symmetric (semi-)definite sparse matrix.
+    /// @return a reference to this.
+    SparseLDLTFactorization& compute( const SparseMatrix& A )
+    {
+      Solver solver;
+      solver.compute( A );
+      myInfo = solver.info();
+      if ( myInfo != Eigen::Success ) return *this;
+      myL    = solver.matrixL().nestedExpression();
+      myD    = solver.vectorD();
+      myP    = solver.permutationP();
+      myPinv = solver.permutationPinv();
+      return *this;
+    }
+
+    /// @return Eigen::Success if the last compute() or load() was successful.
+    Eigen::ComputationInfo info() const
+    {
+      return myInfo;
+    }
+
+    /// @return the number of rows of the factored matrix.
+    Index rows() const
+    {
+      return myD.rows();
+    }
+
+    /// Solves \f$ A x = b \f$.
+    ///
+    /// @tparam TDense the type of right-hand side, a dense vector or matrix.
+    /// @param b the right-hand side, a vector or one right-hand side per column.
+    /// @return the solution, of the same size as @a b.
+    template < typename TDense >
+    TDense solve( const TDense& b ) const
+    {
+      ASSERT( myInfo == Eigen::Success );
+      ASSERT( b.rows() == rows() );
+      TDense x;
+      if ( myP.size() > 0 ) x = myP * b;
+      else                  x = b;
+      myL.template triangularView< Eigen::UnitLower >().solveInPlace( x );
+      x = myD.asDiagonal().inverse() * x;
+      myL.transpose().template triangularView< Eigen::UnitUpper >().solveInPlace( x );
+      if ( myP.size() > 0 ) x = myPinv * x;
+      return x;
+    }
+
+    /// Writes the factorization in binary form on an output stream.
+    /// @param out the output stream (opened in binary mode).
+    /// @return 'true' if the writing was successful.
+    bool save( std::ostream& out ) const
+    {
+      const std::int64_t info = myInfo;
+      writeValue( out, info );
+      writeSparseMatrix( out, myL );
+      writeVector( out, myD );
+      writeVector( out, myP.indices() );
+      writeVector( out, myPinv.indices() );
+      return out.good();
+    }
+
+    /// Reads a factorization written by save() from an input stream.
+    /// @param in the input stream (opened in binary mode).
+    /// @return 'true' if the reading was successful.
+    bool load( std::istream& in )
+    {
+      std::int64_t info = Eigen::InvalidInput;
+      bool ok = readValue( in, info )
+        && readSparseMatrix( in, myL )
+        && readVector( in, myD )
+        && readVector( in, myP.indices() )
+        && readVector( in, myPinv.indices() )
+        && myL.rows() == myD.rows()
+        && ( myP.size() == 0 || myP.size() == myD.rows() )
+        && myPinv.size() == myP.size();
+      myInfo = ok ? static_cast< Eigen::ComputationInfo >( info ) : Eigen::InvalidInput;
+      return ok;
+    }
+
+    // ---------------------- binary I/O helpers ------------------------------
+
+    /// Writes a trivially copyable value.
+    template < typename T >
+    static void writeValue( std::ostream& out, const T& value )
+    {
+      out.write( reinterpret_cast< const char* >( &value ), sizeof( T ) );
+    }
+
+    /// Reads a trivially copyable value.
+    template < typename T >
+    static bool readValue( std::istream& in, T& value )
+    {
+      in.read( reinterpret_cast< char* >( &value ), sizeof( T ) );
+      return in.good();
+    }
+
+    /// Writes a dense vector (size, then coefficients).
+    template < typename TVector >
+    static void writeVector( std::ostream& out, const TVector& v )
+    {
+      const std::int64_t n = v.size();
+      writeValue( out, n );
+      if ( n > 0 )
+        out.write( reinterpret_cast< const char* >( v.data() ),
+                   n * sizeof( typename TVector::Scalar ) );
+    }
+
+    /// Reads a dense vector written by writeVector.
+    template < typename TVector >
+    static bool readVector( std::istream& in, TVector& v )
+    {
+      std::int64_t n = -1;
+      if ( ! readValue( in, n ) || n < 0 ) return false;
+      v.resize( n );
+      if ( n > 0 )
+        in.read( reinterpret_cast< char* >( v.data() ),
+                 n * sizeof( typename TVector::Scalar ) );
+      return in.good();
+    }
+
+    /// Writes a sparse matrix in compressed form.
+    static void writeSparseMatrix( std::ostream& out, const SparseMatrix& A )
+    {
+      SparseMatrix M = A;
+      M.makeCompressed();
+      const std::int64_t dims[ 3 ] = { M.rows(), M.cols(), M.nonZeros() };
+      out.write( reinterpret_cast< const char* >( dims ), sizeof( dims ) );
+      out.write( reinterpret_cast< const char* >( M.outerIndexPtr() ),
+                 ( M.outerSize() + 1 ) * sizeof( StorageIndex ) );
+      out.write( reinterpret_cast< const char* >( M.innerIndexPtr() ),
+                 M.nonZeros() * sizeof( StorageIndex ) );
+      out.write( reinterpret_cast< const char* >( M.valuePtr() ),
+                 M.nonZeros() * sizeof( Scalar ) );
+    }
+
+    /// Reads a sparse matrix written by writeSparseMatrix.
+    static bool readSparseMatrix( std::istream& in, SparseMatrix& A )
+    {
+      std::int64_t dims[ 3 ] = { -1, -1, -1 };
+      in.read( reinterpret_cast< char* >( dims ), sizeof( dims ) );
+      if ( ! in.good() || dims[ 0 ] < 0 || dims[ 1 ] < 0 || dims[ 2 ] < 0 )
+        return false;
+      A.resize( dims[ 0 ], dims[ 1 ] );
+      A.resizeNonZeros( dims[ 2 ] );
+      in.read( reinterpret_cast< char* >( A.outerIndexPtr() ),
+               ( A.outerSize() + 1 ) * sizeof( StorageIndex ) );
+      in.read( reinterpret_cast< char* >( A.innerIndexPtr() ),
+               dims[ 2 ] * sizeof( StorageIndex ) );
+      in.read( reinterpret_cast< char* >( A.valuePtr() ),
+               dims[ 2 ] * sizeof( Scalar ) );
+      return in.good();
+    }
+
+    // ----------------------- Private --------------------------------------
+  private:
+    /// The strictly lower part of the unit lower triangular factor L.
+    SparseMatrix myL;
+    /// The diagonal D.
+    DenseVector myD;
+    /// The fill-reducing permutation P.
+    Permutation myP;
+    /// Its inverse.
+    Permutation myPinv;
+    /// The status of the factorization.
+    Eigen::ComputationInfo myInfo;
+  };
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SparseLDLTFactorization_h
+
+#undef SparseLDLTFactorization_RECURSES
+#endif // else defined(SparseLDLTFactorization_RECURSES)
@@ -32,8 +32,12 @@
 
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
+#include <atomic>
+#include <vector>
 #include "DGtal/helpers/StdDefs.h"
+#include "DGtal/base/Bits.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ParallelPolicy.h"
 #include "DGtal/shapes/Mesh.h"
 #include "DGtal/shapes/IntersectionTarget.h"
 #include "DGtal/kernel/SpaceND.h"
@@ -71,6 +75,22 @@ namespace DGtal
    @image html 6-sep.png "Template for 6-separating digitization"
    @image html 26-sep.png "Template for 26-separating digitization"
 
+   Meshes are voxelized in parallel according to a ParallelPolicy:
+   triangles are digitized by chunks into a dense array of bits
+   covering the bounding box of the mesh, which threads set with
+   atomic operations, then voxels are inserted into the output set.
+   voxelizeSolid() also fills the interior of a closed mesh: each
+   triangle flips, in each column of voxels (along z) whose center it
+   covers, the bit of the first voxel above it, and a prefix exclusive
+   or along columns gives the parity of crossings, i.e. the voxels
+   whose center is inside the mesh.
+
+   @code
+   MeshVoxelizer< Z3i::DigitalSet, 6 > voxelizer;
+   voxelizer.voxelize     ( surface, mesh, 10.0, ParallelPolicy::threads( 8 ) );
+   voxelizer.voxelizeSolid( solid,   mesh, 10.0, ParallelPolicy::threads( 8 ) );
+   @endcode
+
 
    @tparam TDigitalSet a DigitalSet (model of concepts::CDigitalSet)
    @tparam Separation strategy of the voxelization (6 or 26)
@@ -125,12 +145,42 @@ namespace DGtal
      * be casted to @e PointR3 points.
      * @param [in] scaleFactor the scale factor to apply to the mesh
      * (default=1.0)
+     * @param [in] policy the parallel policy (default: the OpenMP
+     * number of threads if DGtal is built with OpenMP, otherwise
+     * sequential).
      * @tparam MeshPoint the type of point of the mesh.
      */
     template<typename MeshPoint>
     void voxelize(DigitalSet &outputSet,
                   const Mesh<MeshPoint> &aMesh,
-                  const double scaleFactor = 1.0);
+                  const double scaleFactor = 1.0,
+                  const ParallelPolicy &policy = ParallelPolicy());
+
+    /**
+     * Voxelize the mesh and its interior into the digital set: the
+     * output is the voxelization of the surface (as voxelize()) and
+     * the voxels whose center is inside the mesh, determined by the
+     * parity of the crossings of the mesh by a ray along z. Rays
+     * through edges or vertices are counted once, so that the result
+     * is correct for closed (watertight) meshes, even when vertices
+     * have integer coordinates.
+     *
+     * If one voxel is outside the digtial set (@a outputSet) domain, the voxel
+     * is skipped.
+     *
+     * @param [out] outputSet the set that collects the voxels.
+     * @param [in] aMesh a closed mesh (vertex coordinates will
+     * be casted to @e PointR3 points.
+     * @param [in] scaleFactor the scale factor to apply to the mesh
+     * (default=1.0)
+     * @param [in] policy the parallel policy.
+     * @tparam MeshPoint the type of point of the mesh.
+     */
+    template<typename MeshPoint>
+    void voxelizeSolid(DigitalSet &outputSet,
+                       const Mesh<MeshPoint> &aMesh,
+                       const double scaleFactor = 1.0,
+                       const ParallelPolicy &policy = ParallelPolicy());
 
     /**
      * Voxelize a unique triangle (a,b,c) into the digital set.
@@ -209,12 +259,183 @@ namespace DGtal
                           const VectorR3& n,
                           const std::pair<PointZ3, PointZ3>& bbox);
 
+    /**
+     * Voxelize ABC, calling @a voxelFunctor on each voxel.
+     * @param voxelFunctor a functor called as `voxelFunctor( v )` for
+     * each voxel v of the digitization (possibly several times).
+     * @param A Point A
+     * @param B Point B
+     * @param C Point C
+     * @param n normal of ABC
+     * @param bbox bounding box of ABC
+     */
+    template <typename VoxelFunctor>
+    void voxelizeTriangle(VoxelFunctor &voxelFunctor,
+                          const PointR3& A,
+                          const PointR3& B,
+                          const PointR3& C,
+                          const VectorR3& n,
+                          const std::pair<PointZ3, PointZ3>& bbox);
+
+    /**
+     * A dense array of bits over a box of voxels, rows along x being
+     * packed in 64-bit words, which threads can set or flip
+     * concurrently.
+     */
+    struct VoxelBitBuffer
+    {
+      typedef DGtal::uint64_t Word;
+
+      /// Lowest voxel of the box.
+      PointZ3 lower;
+      /// Uppermost voxel of the box.
+      PointZ3 upper;
+      /// Number of rows along y.
+      std::size_t ny = 0;
+      /// Number of rows along z.
+      std::size_t nz = 0;
+      /// Number of words of a row.
+      std::size_t wordsPerRow = 0;
+      /// The words, row (y,z) starting at index ( z * ny + y ) * wordsPerRow.
+      std::vector< std::atomic< Word > > words;
+      /// When 'false', bits are changed without atomic read-modify-write
+      /// operations (a single thread uses the buffer).
+      bool concurrent = true;
+
+      /// Allocates the (zero) bits of box [l,u], empty if u < l in some axis.
+      void init( const PointZ3& l, const PointZ3& u )
+      {
+        lower = l; upper = u;
+        const bool empty = ! l.isLower( u );
+        ny          = empty ? 0 : u[ 1 ] - l[ 1 ] + 1;
+        nz          = empty ? 0 : u[ 2 ] - l[ 2 ] + 1;
+        wordsPerRow = empty ? 0 : ( u[ 0 ] - l[ 0 ] + 64 ) / 64;
+        words = std::vector< std::atomic< Word > >( ny * nz * wordsPerRow );
+      }
+
+      /// @return 'true' if @a v is in the box.
+      bool isInside( const PointZ3& v ) const
+      {
+        return nz > 0 && lower.isLower( v ) && v.isLower( upper );
+      }
+
+      /// @return the index of the first word of row (y,z).
+      std::size_t rowIndex( typename PointZ3::Component y,
+                            typename PointZ3::Component z ) const
+      {
+        return ( std::size_t( z - lower[ 2 ] ) * ny + std::size_t( y - lower[ 1 ] ) )
+          * wordsPerRow;
+      }
+
+      /// Sets the bit of voxel @a v (in the box).
+      void set( const PointZ3& v )
+      {
+        const std::size_t x = v[ 0 ] - lower[ 0 ];
+        auto& w = words[ rowIndex( v[ 1 ], v[ 2 ] ) + x / 64 ];
+        if ( concurrent )
+          w.fetch_or( Word( 1 ) << ( x % 64 ), std::memory_order_relaxed );
+        else
+          w.store( w.load( std::memory_order_relaxed ) | ( Word( 1 ) << ( x % 64 ) ),
+                   std::memory_order_relaxed );
+      }
+
+      /// Flips the bit of voxel @a v (in the box).
+      void flip( const PointZ3& v )
+      {
+        const std::size_t x = v[ 0 ] - lower[ 0 ];
+        auto& w = words[ rowIndex( v[ 1 ], v[ 2 ] ) + x / 64 ];
+        if ( concurrent )
+          w.fetch_xor( Word( 1 ) << ( x % 64 ), std::memory_order_relaxed );
+        else
+          w.store( w.load( std::memory_order_relaxed ) ^ ( Word( 1 ) << ( x % 64 ) ),
+                   std::memory_order_relaxed );
+      }
+    };
+
+    /**
+     * Flips, in each column of voxels along z of @a buffer whose
+     * center is covered by the projection of ABC onto the xy-plane,
+     * the bit of the first voxel above ABC (or the lowest voxel of
+     * the column if ABC is below the box). Points on edges are
+     * covered by exactly one of two consistently oriented triangles
+     * sharing this edge (top-left rule), edge functions being
+     * computed from the same endpoint in both triangles.
+     * @param buffer the bit buffer.
+     * @param A Point A
+     * @param B Point B
+     * @param C Point C
+     */
+    static
+    void flipCrossings(VoxelBitBuffer &buffer,
+                       const PointR3& A,
+                       const PointR3& B,
+                       const PointR3& C);
+
     // ----------------------- Members ------------------------------
 
   private:
 
     ///Intersection target
     IntersectionTarget myIntersectionTarget;
+
+    // ----------------------- Internals ------------------------------
+
+    /**
+     * Initializes @a buffer to the bounding box of the scaled mesh
+     * intersected with the domain of @a outputSet.
+     */
+    template<typename MeshPoint>
+    static
+    void initBuffer(VoxelBitBuffer &buffer,
+                    const DigitalSet &outputSet,
+                    const Mesh<MeshPoint> &aMesh,
+                    const double scaleFactor);
+
+    /**
+     * Calls @a triangleFunctor( A, B, C ) on the scaled triangles of
+     * the mesh (faces are triangulated as fans), by chunks of faces
+     * processed in parallel according to @a policy.
+     */
+    template<typename MeshPoint, typename TriangleFunctor>
+    static
+    void forEachTriangle(const Mesh<MeshPoint> &aMesh,
+                         const double scaleFactor,
+                         const ParallelPolicy &policy,
+                         TriangleFunctor triangleFunctor);
+
+    /**
+     * Voxelize ABC (already scaled), calling @a voxelFunctor on each
+     * voxel.
+     */
+    template <typename VoxelFunctor>
+    void voxelizeTriangle(VoxelFunctor &voxelFunctor,
+                          const PointR3& A,
+                          const PointR3& B,
+                          const PointR3& C);
+
+    /**
+     * Sets the bits of the voxelization of the mesh in @a buffer.
+     */
+    template<typename MeshPoint>
+    void voxelizeSurface(VoxelBitBuffer &buffer,
+                         const Mesh<MeshPoint> &aMesh,
+                         const double scaleFactor,
+                         const ParallelPolicy &policy);
+
+    /**
+     * Replaces each bit of @a buffer by the exclusive or of the bits
+     * below it in its column along z (itself included).
+     */
+    static
+    void fillByParity(VoxelBitBuffer &buffer,
+                      const ParallelPolicy &policy);
+
+    /**
+     * Inserts the voxels of the set bits of @a buffer into @a outputSet.
+     */
+    static
+    void insertVoxels(DigitalSet &outputSet,
+                      const VoxelBitBuffer &buffer);
   };
 }
 
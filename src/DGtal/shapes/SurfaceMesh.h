@@ -41,6 +41,9 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <algorithm>
+#include <map>
+#include <unordered_map>
 #include <sstream>
 #include <string>
 #include "DGtal/base/Common.h"
@@ -455,23 +458,28 @@ namespace DGtal
     /// @param checkClosed if true, we check that each vertex has exactly two adejcent edges.
     bool isBoundariesManifold( bool checkClosed = true ) const
     {
-      // computes unordered list of boundary vertices
-      std::map<Vertex,Vertices> adjacent;
+      // computes the sorted list of boundary vertices, one occurrence
+      // per adjacent boundary edge.
       auto MBE = this->computeManifoldBoundaryEdges();
       if ( MBE.size() == 0 ) return false;
-      
+      Vertices ends;
+      ends.reserve( 2 * MBE.size() );
       for (auto e : MBE)
       {
         auto ij = this->edgeVertices(e);
-        adjacent[ ij.first ].push_back( ij.second );
-        if ( adjacent[ ij.first ] .size() > 2 ) return false;
-        adjacent[ ij.second ].push_back( ij.first );
-        if ( adjacent[ ij.second ].size() > 2 )  return false;
+        ends.push_back( ij.first );
+        ends.push_back( ij.second );
+      }
+      std::sort( ends.begin(), ends.end() );
+      for ( Size k = 0; k < ends.size(); )
+      {
+        Size l = k;
+        while ( l < ends.size() && ends[ l ] == ends[ k ] ) ++l;
+        if ( l - k > 2 ) return false;
+        //we may check if all curves are closed.
+        if ( checkClosed && l - k != 2 ) return false;
+        k = l;
       }
-      //we may check if all curves are closed.
-      if ( checkClosed )
-        for ( const auto &adj : adjacent )
-          if ( adj.second.size() != 2 ) return false;
       return true;
     }
     
@@ -485,52 +493,76 @@ namespace DGtal
       std::vector<Vertices> boundaries;
       Vertices boundary;
       auto MBE = this->computeManifoldBoundaryEdges();
-      std::map<Vertex,bool> visited;
-      std::map<Vertex,Vertices> adjacent;
       
       ASSERT_MSG(MBE.size()>0,"The surface mesh must have boundary edges");
       ASSERT_MSG(this->isBoundariesManifold(), "The surface mesh mush have manifold boundaries");
       
-      //Coompute adjecency relationships
+      // Sorted boundary vertices, numbered by their rank.
+      Vertices bdry_vertices;
+      bdry_vertices.reserve( 2 * MBE.size() );
       for (auto e : MBE)
       {
         auto ij = this->edgeVertices(e);
-        visited[ij.first] = false;
-        visited[ij.second] = false;
-        adjacent[ij.first].push_back(ij.second);
-        adjacent[ij.second].push_back(ij.first);
+        bdry_vertices.push_back( ij.first );
+        bdry_vertices.push_back( ij.second );
       }
+      std::sort( bdry_vertices.begin(), bdry_vertices.end() );
+      bdry_vertices.erase( std::unique( bdry_vertices.begin(), bdry_vertices.end() ),
+                           bdry_vertices.end() );
+      const Size nbv = bdry_vertices.size();
+      auto rank = [&] ( Vertex v )
+      { return std::lower_bound( bdry_vertices.cbegin(), bdry_vertices.cend(), v )
+          - bdry_vertices.cbegin(); };
       
-      auto boundary_it = visited.begin();
+      //Compute adjacency relationships (CSR, in the order of edges)
+      std::vector<Index> start( nbv + 1, 0 );
+      for (auto e : MBE)
+      {
+        auto ij = this->edgeVertices(e);
+        start[ rank( ij.first  ) + 1 ]++;
+        start[ rank( ij.second ) + 1 ]++;
+      }
+      for ( Size k = 0; k < nbv; ++k ) start[ k + 1 ] += start[ k ];
+      std::vector<Index> adjacent( start[ nbv ] );
+      std::vector<Index> pos( start.cbegin(), start.cend() - 1 );
+      for (auto e : MBE)
+      {
+        auto ij = this->edgeVertices(e);
+        const Index ri = rank( ij.first  );
+        const Index rj = rank( ij.second );
+        adjacent[ pos[ ri ]++ ] = rj;
+        adjacent[ pos[ rj ]++ ] = ri;
+      }
       
-      while(boundary_it != visited.end() )
+      std::vector<bool> visited( nbv, false );
+      for ( Index first = 0; first < nbv; ++first )
       {
-        Vertex first = (*boundary_it).first;
+        if ( visited[ first ] ) continue;
         visited[first] = true;
         boundary.clear();
-        boundary.push_back(first);
+        boundary.push_back( bdry_vertices[ first ] );
         
-        Vertex current = first;
+        Index current = first;
         size_t nb_iter = 0;
         bool pushed=false;
         
         while ((!pushed) && (nb_iter < MBE.size()*2))
         {
           bool ok = false;
-          for (auto other : adjacent[current])
-            if (!visited[other])
+          for ( Index k = start[ current ]; k < start[ current + 1 ]; ++k )
+            if (!visited[ adjacent[ k ] ])
             {
-              boundary.push_back(other);
-              current = other;
-              visited[other] = true;
+              current = adjacent[ k ];
+              boundary.push_back( bdry_vertices[ current ] );
+              visited[current] = true;
               ok = true;
               break;
             }
           if (!ok)
           {
             //all neighboors are visited
-            for (auto other : adjacent[current])
-              if (other == first)
+            for ( Index k = start[ current ]; k < start[ current + 1 ]; ++k )
+              if ( adjacent[ k ] == first )
               {
                 boundaries.push_back(boundary);
                 pushed = true;
@@ -538,12 +570,10 @@ namespace DGtal
               }
             //if first vertex isn't found then this chain is not
             //homeomorphic to a circle, hence isn't added to boundaries
+            break;
           }
           nb_iter++;
         }
-        boundary_it = std::find_if(visited.begin(), visited.end(),
-                                   []
-                                   (std::pair<Vertex,bool> x){return !x.second;});
       }
       return boundaries;
     }
@@ -820,6 +850,80 @@ namespace DGtal
     /// @note a vertex is either included or not, so no weight is necessary.
     std::tuple< Vertices, WeightedEdges, WeightedFaces >
     computeCellsInclusionsInBall( Scalar r, Index f, RealPoint p ) const;
+
+    /// Reusable buffers for ball inclusion queries, so that repeated
+    /// queries do not allocate. Use one object per thread.
+    struct BallQueryBuffers
+    {
+      /// For each face, the number of the last query that marked it.
+      std::vector< Size > faceMarks;
+      /// For each vertex, the number of the last query that marked it.
+      std::vector< Size > vertexMarks;
+      /// The number of the current query.
+      Size stamp = 0;
+      /// The faces to visit.
+      Faces active;
+
+      /// Starts a new query on a mesh.
+      /// @param nb_vertices the number of vertices of the mesh.
+      /// @param nb_faces the number of faces of the mesh.
+      void next( Size nb_vertices, Size nb_faces )
+      {
+        if ( faceMarks.size()   < nb_faces    ) faceMarks.resize  ( nb_faces, 0 );
+        if ( vertexMarks.size() < nb_vertices ) vertexMarks.resize( nb_vertices, 0 );
+        stamp += 1;
+        active.clear();
+      }
+    };
+
+    /// Same as \ref computeFacesInclusionsInBall( Scalar, Index, RealPoint ) const
+    /// but uses the given buffers and output range, which avoids any
+    /// allocation once they have grown. Outputs the same faces in the
+    /// same order.
+    ///
+    /// @param r the radius of the ball.
+    /// @param f the face where the ball is centered.
+    /// @param p the position on the face where the ball is centered.
+    /// @param[inout] buffers the buffers of the calling thread.
+    /// @param[out] result the range of weighted faces (cleared before).
+    void computeFacesInclusionsInBall( Scalar r, Index f, RealPoint p,
+                                       BallQueryBuffers& buffers,
+                                       WeightedFaces& result ) const;
+
+    /// Same as \ref computeCellsInclusionsInBall( Scalar, Index, RealPoint ) const
+    /// but uses the given buffers and output ranges, which avoids any
+    /// allocation once they have grown. Outputs the same cells in the
+    /// same order.
+    ///
+    /// @param r the radius of the ball.
+    /// @param f the face where the ball is centered.
+    /// @param p the position on the face where the ball is centered.
+    /// @param[inout] buffers the buffers of the calling thread.
+    /// @param[out] result_v the sorted range of vertices (cleared before).
+    /// @param[out] result_e the range of weighted edges (cleared before).
+    /// @param[out] result_f the range of weighted faces (cleared before).
+    void computeCellsInclusionsInBall( Scalar r, Index f, RealPoint p,
+                                       BallQueryBuffers& buffers,
+                                       Vertices& result_v,
+                                       WeightedEdges& result_e,
+                                       WeightedFaces& result_f ) const;
+
+    /// Given the faces of a ball of radius \a r and center \a p, with
+    /// their inclusion ratios, outputs its vertices and weighted
+    /// edges as \ref computeCellsInclusionsInBall.
+    ///
+    /// @param r the radius of the ball.
+    /// @param p the center of the ball.
+    /// @param result_f the range of weighted faces of the ball.
+    /// @param[inout] buffers the buffers of the calling thread, whose
+    /// stamp is the one of the current query.
+    /// @param[out] result_v the sorted range of vertices (cleared before).
+    /// @param[out] result_e the range of weighted edges (cleared before).
+    void computeVerticesAndEdgesOfFacesInBall( Scalar r, RealPoint p,
+                                               const WeightedFaces& result_f,
+                                               BallQueryBuffers& buffers,
+                                               Vertices& result_v,
+                                               WeightedEdges& result_e ) const;
     
     /// Computes an approximation of the inclusion ratio of a given
     /// face \a f with a ball of radius \a r and center \a p.
@@ -918,8 +1022,8 @@ namespace DGtal
        index of the flipped edge (if you reflip it you get your
        former configuration).
       
-       @note Time complexity is O(log n), due to the updating of
-       surrounding edges information.
+       @note Time complexity is O(log n) (amortized), due to the
+       updating of surrounding edges information.
       
        @warning For performance reasons, The neighbor faces of each
        face are not recomputed. One should call \ref computeNeighbors
@@ -979,8 +1083,17 @@ namespace DGtal
     std::vector< Vertices >     myNeighborVertices;
     /// For each edge, its two vertices
     std::vector< VertexPair >   myEdgeVertices;
-    /// For each vertex pair, its edge index.
-    std::map< VertexPair,Edge > myVertexPairEdge;
+    /// The edge indices sorted by their vertex pairs
+    /// (lexicographically), for binary search in \ref makeEdge. Edges
+    /// flipped since the table was sorted keep their place, under
+    /// their former vertex pair.
+    Edges                       myEdgeTable;
+    /// The edges flipped since the edge table was sorted, indexed by
+    /// their current vertex pair.
+    std::map< VertexPair, Edge > myFlippedEdges;
+    /// For each edge flipped since the edge table was sorted, its
+    /// vertex pair in the edge table.
+    std::unordered_map< Edge, VertexPair > myFormerEdgeVertices;
     /// For each edge, its faces (one, two, or more if non manifold)
     std::vector< Faces >        myEdgeFaces;
     /// For each edge, its faces to its right  (zero if open, one, or more if
@@ -1041,6 +1154,39 @@ namespace DGtal
       std::cerr << std::endl;
     }
 
+    /// @param vp any vertex pair (i,j), i<j.
+    /// @return the position of the first edge of the sorted edge
+    /// table whose vertex pair is not less than \a vp.
+    Index edgeTablePosition( const VertexPair& vp ) const
+    {
+      return std::lower_bound( myEdgeTable.cbegin(), myEdgeTable.cend(), vp,
+                               [&] ( Edge e, const VertexPair& other )
+                               { return tableEdgeVertices( e ) < other; } )
+        - myEdgeTable.cbegin();
+    }
+
+    /// @param e any edge
+    /// @return the vertex pair under which \a e is stored in the
+    /// sorted edge table.
+    const VertexPair& tableEdgeVertices( Edge e ) const
+    {
+      if ( myFormerEdgeVertices.empty() ) return myEdgeVertices[ e ];
+      const auto it = myFormerEdgeVertices.find( e );
+      return it != myFormerEdgeVertices.end() ? it->second : myEdgeVertices[ e ];
+    }
+
+    /// Changes the vertex pair of edge \a e. The edge is recorded as
+    /// flipped and the edge table is sorted again once the number of
+    /// flipped edges exceeds an eighth of the number of edges, so
+    /// that the amortized time complexity is O(log n).
+    /// @param e any edge
+    /// @param vp its new vertex pair (i,j), i<j, which is not an edge.
+    void moveEdge( Edge e, const VertexPair& vp );
+
+    /// Sorts the edge table by current vertex pairs and forgets
+    /// flipped edges.
+    void sortEdgeTable();
+
     /// Adds the index \a i to the vector \a v.
     /// @param[inout] v a vector of indices
     /// @param[in] i an index
@@ -0,0 +1,247 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SurfaceMeshSpatialIndex.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module SurfaceMeshSpatialIndex.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SurfaceMeshSpatialIndex_RECURSES)
+#error Recursive header files inclusion detected in SurfaceMeshSpatialIndex.h
+#else // defined(SurfaceMeshSpatialIndex_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SurfaceMeshSpatialIndex_RECURSES
+
+#if !defined SurfaceMeshSpatialIndex_h
+/** Prevents repeated inclusion of headers. */
+#define SurfaceMeshSpatialIndex_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <array>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/shapes/SurfaceMesh.h"
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SurfaceMeshSpatialIndex
+  /**
+     Description of template class 'SurfaceMeshSpatialIndex' <p> \brief
+     Aim: A uniform grid over the faces of a SurfaceMesh, which finds
+     the cells of the mesh intersecting a ball without traversing the
+     mesh.
+
+     Each face is stored in the grid cell containing its centroid (in
+     compressed sparse row form), with a bounding sphere centered on
+     its centroid. A query visits the grid cells within the radius of
+     the ball plus the greatest radius of faces, and culls faces with
+     their bounding sphere before computing their inclusion ratio. The
+     grid does not depend on the radius of queries and can be reused
+     for any radius, as long as the mesh positions are not changed
+     (otherwise call init() again).
+
+     Contrary to SurfaceMesh::computeCellsInclusionsInBall, which
+     collects the cells connected to a given face through cells
+     intersecting the ball, queries return all the cells intersecting
+     the ball, faces being in the order of grid cells. Both coincide when the intersection of
+     the ball with the mesh is connected, e.g. for radii smaller than
+     the reach of a smooth surface.
+
+     \code
+     SurfaceMeshSpatialIndex< RealPoint, RealVector > index( smesh );
+     SurfMesh::BallQueryBuffers buffers;
+     SurfMesh::WeightedFaces    faces;
+     for ( auto r : { 0.5, 1.0, 2.0 } )
+       index.computeFacesInclusionsInBall( r, p, buffers, faces );
+     \endcode
+
+     @tparam TRealPoint an arbitrary model of 3D RealPoint.
+     @tparam TRealVector an arbitrary model of 3D RealVector.
+  */
+  template < typename TRealPoint, typename TRealVector >
+  class SurfaceMeshSpatialIndex
+  {
+  public:
+    typedef TRealPoint                                    RealPoint;
+    typedef TRealVector                                   RealVector;
+    typedef SurfaceMeshSpatialIndex< RealPoint, RealVector > Self;
+    typedef DGtal::SurfaceMesh< RealPoint, RealVector >   SurfaceMesh;
+    typedef typename SurfaceMesh::Scalar                  Scalar;
+    typedef typename SurfaceMesh::Size                    Size;
+    typedef typename SurfaceMesh::Index                   Index;
+    typedef typename SurfaceMesh::Face                    Face;
+    typedef typename SurfaceMesh::Faces                   Faces;
+    typedef typename SurfaceMesh::Vertices                Vertices;
+    typedef typename SurfaceMesh::WeightedEdges           WeightedEdges;
+    typedef typename SurfaceMesh::WeightedFaces           WeightedFaces;
+    typedef typename SurfaceMesh::BallQueryBuffers        BallQueryBuffers;
+    static const Dimension dimension = RealPoint::dimension;
+    BOOST_STATIC_ASSERT( ( dimension == 3 ) );
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Builds the grid of the given mesh.
+    ///
+    /// @param aMesh the mesh, which is referenced in this object.
+    /// @param cell_size the size of grid cells, or 0 to choose twice
+    /// the average edge length.
+    SurfaceMeshSpatialIndex( ConstAlias< SurfaceMesh > aMesh,
+                             Scalar cell_size = 0.0 );
+
+    /// (Re)builds the grid, e.g. after a change of the mesh.
+    ///
+    /// @param cell_size the size of grid cells, or 0 to choose twice
+    /// the average edge length. It is increased if the grid would
+    /// have more than four cells per face.
+    void init( Scalar cell_size = 0.0 );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return a pointer to the associated mesh.
+    const SurfaceMesh* meshPtr() const
+    {
+      return myMeshPtr;
+    }
+
+    /// @return the size of grid cells.
+    Scalar cellSize() const
+    {
+      return myCellSize;
+    }
+
+    /// @return the number of grid cells.
+    Size nbCells() const
+    {
+      return myCellStart.empty() ? 0 : myCellStart.size() - 1;
+    }
+
+    /// Outputs the faces having a non empty intersection with the
+    /// ball of center \a p and radius \a r, weighted by their
+    /// inclusion ratio (see SurfaceMesh::faceInclusionRatio).
+    ///
+    /// @param r the radius of the ball.
+    /// @param p the center of the ball.
+    /// @param[inout] buffers the buffers of the calling thread.
+    /// @param[out] result_f the range of weighted faces (cleared before).
+    void computeFacesInclusionsInBall( Scalar r, RealPoint p,
+                                       BallQueryBuffers& buffers,
+                                       WeightedFaces& result_f ) const;
+
+    /// Outputs the vertices, edges and faces having a non empty
+    /// intersection with the ball of center \a p and radius \a r,
+    /// edges and faces being weighted by their inclusion ratio (see
+    /// SurfaceMesh::computeCellsInclusionsInBall).
+    ///
+    /// @param r the radius of the ball.
+    /// @param p the center of the ball.
+    /// @param[inout] buffers the buffers of the calling thread.
+    /// @param[out] result_v the sorted range of vertices (cleared before).
+    /// @param[out] result_e the range of weighted edges (cleared before).
+    /// @param[out] result_f the range of weighted faces (cleared before).
+    void computeCellsInclusionsInBall( Scalar r, RealPoint p,
+                                       BallQueryBuffers& buffers,
+                                       Vertices& result_v,
+                                       WeightedEdges& result_e,
+                                       WeightedFaces& result_f ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// A pointer to the indexed mesh.
+    const SurfaceMesh*     myMeshPtr;
+    /// The lowest corner of the grid.
+    RealPoint              myLow;
+    /// The size of grid cells.
+    Scalar                 myCellSize;
+    /// The number of cells along each axis.
+    std::array< Size, 3 >  myExtent;
+    /// The range of faces of grid cell k is [ myCellStart[ k ], myCellStart[ k+1 ] ).
+    std::vector< Index >   myCellStart;
+    /// The faces of each grid cell.
+    Faces                  myCellFaces;
+    /// The centroid of each face.
+    std::vector< RealPoint > myFaceCentroids;
+    /// The radius of the bounding sphere of each face, centered on its centroid.
+    std::vector< Scalar >  myFaceRadii;
+    /// The greatest radius of faces.
+    Scalar                 myMaxFaceRadius;
+
+    // ------------------------- Internals ------------------------------------
+  protected:
+
+    /// @param x any coordinate.
+    /// @param k any axis.
+    /// @return the grid coordinate of \a x along axis \a k, clamped to the grid.
+    Size gridCoordinate( Scalar x, Dimension k ) const;
+
+    /// @param p any point.
+    /// @return the index of the grid cell containing \a p (clamped to the grid).
+    Size gridCell( const RealPoint& p ) const
+    {
+      return ( gridCoordinate( p[ 2 ], 2 ) * myExtent[ 1 ] + gridCoordinate( p[ 1 ], 1 ) )
+        * myExtent[ 0 ] + gridCoordinate( p[ 0 ], 0 );
+    }
+
+  }; // end of class SurfaceMeshSpatialIndex
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SurfaceMeshSpatialIndex'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SurfaceMeshSpatialIndex' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TRealPoint, typename TRealVector >
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const SurfaceMeshSpatialIndex<TRealPoint, TRealVector> & object );
+
+} // namespace DGtal
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "SurfaceMeshSpatialIndex.ih"
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SurfaceMeshSpatialIndex_h
+
+#undef SurfaceMeshSpatialIndex_RECURSES
+#endif // else defined(SurfaceMeshSpatialIndex_RECURSES)
@@ -0,0 +1,517 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CellContainerBySortedArray.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module CellContainerBySortedArray.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CellContainerBySortedArray_RECURSES)
+#error Recursive header files inclusion detected in CellContainerBySortedArray.h
+#else // defined(CellContainerBySortedArray_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CellContainerBySortedArray_RECURSES
+
+#if !defined CellContainerBySortedArray_h
+/** Prevents repeated inclusion of headers. */
+#define CellContainerBySortedArray_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ContainerTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CellContainerBySortedArray
+  /**
+   * Description of template class 'CellContainerBySortedArray' <p>
+   * \brief Aim: An associative container Cell -> Data that stores
+   * cells in a flat sorted array, with their data in a parallel
+   * array. It is meant to be used as cell container of a
+   * CubicalComplex, instead of a std::map or a std::unordered_map.
+   *
+   * Cells (i.e. their Khalimsky coordinates) are stored contiguously
+   * and sorted, so that lookups are binary searches on a compact
+   * array and traversals are linear scans, without any hashing or
+   * pointer chasing. Updates are lazy:
+   *
+   * - erasing a cell only marks it as erased (its slot is kept, so
+   *   that other iterators remain valid);
+   * - inserting a new cell appends it to a small unsorted pending
+   *   buffer, which is merged into the sorted array when it grows
+   *   too large (merging also drops erased cells);
+   * - range insertions (insert(first,last), insertCells) append all
+   *   the cells and merge them at once, in time O(n + k log k) for k
+   *   new cells.
+   *
+   * Like boost::container::flat_map, it is thus very efficient for
+   * complexes built by batches and then mostly queried (closure,
+   * star, collapse, ...), while inserting many new cells one by one
+   * is slower than with a std::map.
+   *
+   * Iterators are stable by erasure and by modification of the data
+   * of existing cells. Inserting a new cell may invalidate them. They
+   * visit the sorted array then the pending buffer, hence cells are
+   * sorted after flush(). Dereferencing an iterator gives a proxy
+   * with members \a first (the cell) and \a second (a reference to
+   * its data), like a std::pair.
+   *
+   * @code
+   * typedef CellContainerBySortedArray< KSpace::Cell, CubicalCellData > Container;
+   * typedef CubicalComplex< KSpace, Container > CC;
+   * CC complex( K );
+   * complex.construct( set );
+   * functions::collapse( complex, S.begin(), S.end(), P );
+   * @endcode
+   *
+   * @tparam TCell the type of cells (or any type with operator< and operator==).
+   * @tparam TData the type of data associated to each cell.
+   */
+  template <typename TCell, typename TData>
+  class CellContainerBySortedArray
+  {
+  public:
+    typedef CellContainerBySortedArray<TCell, TData> Self;
+    typedef TCell                                    Cell;
+    typedef TData                                    Data;
+    typedef TCell                                    key_type;
+    typedef TData                                    mapped_type;
+    typedef std::pair<const TCell, TData>            value_type;
+    typedef std::size_t                              size_type;
+    typedef std::ptrdiff_t                           difference_type;
+    typedef std::size_t                              Size;
+
+    /**
+     * The result of dereferencing an iterator: a cell and a
+     * reference to its data, with the same members as a std::pair.
+     * It is convertible to value_type.
+     * @tparam TDataRef either Data& or const Data&.
+     */
+    template <typename TDataRef>
+    struct PairReference
+    {
+      /// The cell.
+      const Cell & first;
+      /// The data of the cell.
+      TDataRef second;
+
+      PairReference( const Cell & aCell, TDataRef aData )
+        : first( aCell ), second( aData ) {}
+
+      /// @return a copy of the cell and its data.
+      operator value_type() const
+      {
+        return value_type( first, second );
+      }
+
+      /// Allows `it->first` and `it->second` on iterators.
+      const PairReference* operator->() const
+      {
+        return this;
+      }
+    };
+
+    /**
+     * Forward iterator on the cells that are not erased.
+     * @tparam TContainer either Self or const Self.
+     * @tparam TDataRef either Data& or const Data&.
+     */
+    template <typename TContainer, typename TDataRef>
+    class IteratorOnCells
+    {
+      template <typename C, typename R> friend class IteratorOnCells;
+      friend class CellContainerBySortedArray;
+
+    public:
+      typedef std::forward_iterator_tag        iterator_category;
+      typedef typename Self::value_type        value_type;
+      typedef typename Self::difference_type   difference_type;
+      typedef PairReference<TDataRef>          reference;
+      typedef PairReference<TDataRef>          pointer;
+
+      IteratorOnCells() : myContainer( 0 ), myPos( 0 ) {}
+
+      /// Conversion from iterator to const_iterator.
+      template <typename C, typename R>
+      IteratorOnCells( const IteratorOnCells<C, R> & other )
+        : myContainer( other.myContainer ), myPos( other.myPos ) {}
+
+      reference operator*() const
+      {
+        return reference( myContainer->myCells[ myPos ], myContainer->myData[ myPos ] );
+      }
+
+      pointer operator->() const
+      {
+        return **this;
+      }
+
+      IteratorOnCells & operator++()
+      {
+        ++myPos;
+        skipErased();
+        return *this;
+      }
+
+      IteratorOnCells operator++( int )
+      {
+        IteratorOnCells tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+
+      template <typename C, typename R>
+      bool operator==( const IteratorOnCells<C, R> & other ) const
+      {
+        return myPos == other.myPos;
+      }
+
+      template <typename C, typename R>
+      bool operator!=( const IteratorOnCells<C, R> & other ) const
+      {
+        return myPos != other.myPos;
+      }
+
+    private:
+      IteratorOnCells( TContainer* aContainer, Size aPos )
+        : myContainer( aContainer ), myPos( aPos )
+      {
+        skipErased();
+      }
+
+      void skipErased()
+      {
+        const Size n = myContainer->myAlive.size();
+        while ( myPos < n && ! myContainer->myAlive[ myPos ] ) ++myPos;
+      }
+
+      /// The container.
+      TContainer* myContainer;
+      /// The position of the cell in the arrays of the container.
+      Size myPos;
+    };
+
+    typedef IteratorOnCells<Self, Data&>             iterator;
+    typedef IteratorOnCells<const Self, const Data&> const_iterator;
+    typedef PairReference<Data&>                     reference;
+    typedef PairReference<const Data&>               const_reference;
+    typedef reference                                pointer;
+    typedef const_reference                          const_pointer;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor. The container is empty.
+    CellContainerBySortedArray();
+
+    /**
+     * Constructor from a range of values (pairs cell, data).
+     * @tparam InputIterator any input iterator on value_type.
+     * @param first an iterator on the first value.
+     * @param last an iterator after the last value.
+     */
+    template <typename InputIterator>
+    CellContainerBySortedArray( InputIterator first, InputIterator last );
+
+    // ----------------------- Container services -----------------------------
+  public:
+
+    /// @return an iterator on the first cell.
+    iterator begin()
+    {
+      return iterator( this, 0 );
+    }
+
+    /// @return an iterator after the last cell.
+    iterator end()
+    {
+      return iterator( this, myCells.size() );
+    }
+
+    /// @return a const iterator on the first cell.
+    const_iterator begin() const
+    {
+      return const_iterator( this, 0 );
+    }
+
+    /// @return a const iterator after the last cell.
+    const_iterator end() const
+    {
+      return const_iterator( this, myCells.size() );
+    }
+
+    /// @return the number of cells.
+    Size size() const
+    {
+      return mySize;
+    }
+
+    /// @return 'true' if there is no cell.
+    bool empty() const
+    {
+      return mySize == 0;
+    }
+
+    /// @return the maximal number of cells.
+    Size max_size() const
+    {
+      return myCells.max_size();
+    }
+
+    /// Removes all the cells.
+    void clear();
+
+    /**
+     * Swaps the content of two containers.
+     * @param other any container.
+     */
+    void swap( Self & other );
+
+    /**
+     * Reserves memory for the given number of cells.
+     * @param n a number of cells.
+     */
+    void reserve( Size n );
+
+    /**
+     * @param aCell any cell.
+     * @return an iterator on \a aCell or end() if it is not in the container.
+     */
+    iterator find( const Cell & aCell );
+
+    /**
+     * @param aCell any cell.
+     * @return an iterator on \a aCell or end() if it is not in the container.
+     */
+    const_iterator find( const Cell & aCell ) const;
+
+    /**
+     * @param aCell any cell.
+     * @return 1 if \a aCell is in the container, 0 otherwise.
+     */
+    Size count( const Cell & aCell ) const;
+
+    /**
+     * @param aCell any cell.
+     * @return the range of cells equal to \a aCell.
+     */
+    std::pair<iterator, iterator> equal_range( const Cell & aCell );
+
+    /**
+     * @param aCell any cell.
+     * @return the range of cells equal to \a aCell.
+     */
+    std::pair<const_iterator, const_iterator> equal_range( const Cell & aCell ) const;
+
+    /**
+     * Inserts a cell with its data, if the cell is not already in
+     * the container (the data of an existing cell is not changed).
+     *
+     * @param value a pair (cell, data).
+     * @return an iterator on the cell and 'true' if it has been inserted.
+     */
+    std::pair<iterator, bool> insert( const value_type & value );
+
+    /**
+     * Same as insert( value ), the hint is ignored.
+     * @param hint an iterator (unused).
+     * @param value a pair (cell, data).
+     * @return an iterator on the cell.
+     */
+    iterator insert( iterator hint, const value_type & value );
+
+    /**
+     * Inserts a range of cells with their data at once. As with
+     * std::map, cells already in the container keep their data, and
+     * the first occurrence of a cell in the range is inserted.
+     *
+     * @tparam InputIterator any input iterator on value_type.
+     * @param first an iterator on the first value.
+     * @param last an iterator after the last value.
+     */
+    template <typename InputIterator>
+    void insert( InputIterator first, InputIterator last );
+
+    /**
+     * Inserts a range of cells at once, all with the given data,
+     * which replaces the data of cells already in the container.
+     * It is equivalent to `(*this)[ c ] = data` for each cell c of
+     * the range.
+     *
+     * @tparam CellConstIterator any input iterator on Cell.
+     * @param first an iterator on the first cell.
+     * @param last an iterator after the last cell.
+     * @param data the data of the cells.
+     */
+    template <typename CellConstIterator>
+    void insertCells( CellConstIterator first, CellConstIterator last,
+                      const Data & data = Data() );
+
+    /**
+     * @param aCell any cell, inserted with a default data if it is
+     * not already in the container.
+     * @return a reference on the data of \a aCell.
+     */
+    Data & operator[]( const Cell & aCell );
+
+    /**
+     * Erases the cell pointed by an iterator. Other iterators remain valid.
+     * @param position a valid iterator (not end()).
+     */
+    void erase( iterator position );
+
+    /**
+     * Erases a cell.
+     * @param aCell any cell.
+     * @return 1 if \a aCell was in the container, 0 otherwise.
+     */
+    Size erase( const Cell & aCell );
+
+    /**
+     * Erases a range of cells.
+     * @param first an iterator on the first cell to erase.
+     * @param last an iterator after the last cell to erase.
+     */
+    void erase( iterator first, iterator last );
+
+    /**
+     * Merges the pending cells into the sorted array and removes the
+     * erased cells. Iterators are invalidated, and cells are then
+     * visited in increasing order.
+     */
+    void flush();
+
+    /// @return the number of cells that are not yet in the sorted array.
+    Size nbPending() const
+    {
+      return myCells.size() - mySorted;
+    }
+
+    /// @return the number of bytes used by the container (approximately).
+    Size memoryUsage() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The cells: sorted in [0,mySorted), pending after.
+    std::vector<Cell> myCells;
+    /// The data of each cell.
+    std::vector<Data> myData;
+    /// For each cell, 0 if it has been erased, 1 otherwise.
+    std::vector<unsigned char> myAlive;
+    /// The number of sorted cells, erased or not.
+    Size mySorted;
+    /// The number of cells that are not erased.
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /// @return the position of \a aCell in the arrays (erased or not),
+    /// or the size of the arrays if it is absent.
+    Size position( const Cell & aCell ) const;
+
+    /// @return the maximal number of pending cells before merging.
+    Size maxPending() const;
+
+    /**
+     * Merges the pending cells into the sorted array and removes the
+     * erased cells. Pending cells may contain duplicates, and cells
+     * that are also in the sorted array.
+     * @param overwrite when 'true', the data of the last occurrence
+     * of a cell wins, otherwise the data of its first occurrence.
+     */
+    void merge( bool overwrite );
+
+  }; // end of class CellContainerBySortedArray
+
+  /**
+   * Swaps two containers.
+   * @param c1 any container.
+   * @param c2 any container.
+   */
+  template <typename TCell, typename TData>
+  void swap( CellContainerBySortedArray<TCell, TData> & c1,
+             CellContainerBySortedArray<TCell, TData> & c2 )
+  {
+    c1.swap( c2 );
+  }
+
+  /**
+   * Specialization of ContainerTraits for CellContainerBySortedArray.
+   * Cells are not visited in order (pending cells come last), hence
+   * it is an unordered pair associative container.
+   */
+  template <typename TCell, typename TData>
+  struct ContainerTraits< CellContainerBySortedArray<TCell, TData> >
+  {
+    typedef UnorderedMapAssociativeCategory Category;
+  };
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CellContainerBySortedArray'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CellContainerBySortedArray' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TCell, typename TData>
+  std::ostream&
+  operator<< ( std::ostream & out, const CellContainerBySortedArray<TCell, TData> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/CellContainerBySortedArray.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CellContainerBySortedArray_h
+
+#undef CellContainerBySortedArray_RECURSES
+#endif // else defined(CellContainerBySortedArray_RECURSES)
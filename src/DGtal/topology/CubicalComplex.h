@@ -52,6 +52,7 @@
 #include "DGtal/base/ContainerTraits.h"
 #include "DGtal/base/CSTLAssociativeContainer.h"
 #include "DGtal/topology/CCellularGridSpaceND.h"
+#include "DGtal/topology/CellContainerBySortedArray.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -167,7 +168,11 @@ namespace DGtal
   * it. It could be for instance a std::map or a
   * std::unordered_map. Note that unfortunately, unordered_map are
   * (strangely) not models of boost::AssociativeContainer, hence we
-  * cannot check concepts here.
+  * cannot check concepts here. For large complexes that are built
+  * by batches then mostly queried or collapsed, a
+  * CellContainerBySortedArray avoids hashing and pointer chasing:
+  * construct, insertCells, closure and star insert their cells into
+  * it at once.
   *
   */
   template < typename TKSpace,
@@ -0,0 +1,348 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DenseVoxelThinning.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module DenseVoxelThinning.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DenseVoxelThinning_RECURSES)
+#error Recursive header files inclusion detected in DenseVoxelThinning.h
+#else // defined(DenseVoxelThinning_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DenseVoxelThinning_RECURSES
+
+#if !defined DenseVoxelThinning_h
+/** Prevents repeated inclusion of headers. */
+#define DenseVoxelThinning_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <cstdint>
+#include "boost/dynamic_bitset.hpp"
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/ParallelPolicy.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/topology/helpers/NeighborhoodConfigurationsHelper.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DenseVoxelThinning
+  /**
+   * Description of template class 'DenseVoxelThinning' <p>
+   * \brief Aim: Thinning (skeletonization) of 3D binary images stored
+   * with one bit per voxel, using the precomputed look-up tables of
+   * simplicity and isthmusicity of NeighborhoodConfigurations.
+   *
+   * The voxels are stored in rows of 64-bit words, with a background
+   * border of one voxel. The (26,6) neighborhood configuration of a
+   * voxel is the 26-bit code of functions::getSpelNeighborhoodConfigurationOccupancy
+   * (lexicographic order of the neighbors, x fastest): it is read from
+   * 3 bits in 9 rows, and is updated incrementally by sliding the
+   * 3x3x3 window along consecutive voxels of a row.
+   *
+   * Thinning proceeds by passes of six directional sub-iterations
+   * (y-, y+, x+, x-, z+, z-). In a sub-iteration:
+   * - the border voxels in the current direction (whose neighbor in
+   *   that direction is background) that are not anchored are visited.
+   *   Those satisfying the skeleton predicate (end voxel, or table
+   *   lookup, e.g. isthmusicity) are anchored and kept for ever; the
+   *   simple ones are candidates.
+   * - candidates are removed if they are still simple, in the order of
+   *   the 8 parity classes of their coordinates, then z, y, x.
+   *
+   * Two voxels of the same parity class are not 26-adjacent, hence
+   * their simplicity tests are independent: candidates of a class are
+   * processed concurrently, slice by slice, with the same result as a
+   * sequential processing. The skeleton thus does not depend on the
+   * number of threads. Topology is preserved since a voxel is removed
+   * only if it is simple at the time of its removal.
+   *
+   * The result is in general not the one of
+   * functions::asymetricThinningScheme (used by
+   * functions::thinningVoxelComplex with skelUltimate, skelEnd or
+   * skelWithTable). At each generation, the asymmetric scheme keeps
+   * one voxel, chosen by a select function, of each critical clique,
+   * removes all the other voxels at once, and tests the skeleton
+   * predicate on all the remaining voxels. Here, voxels are peeled
+   * from one side at a time and the skeleton predicate is only tested
+   * on the border voxels of the current direction. Hence:
+   * - both skeletons are homotopy equivalent to the input (same Euler
+   *   characteristic, connected components, tunnels and cavities),
+   *   and ultimate skeletons have no simple voxel in both cases;
+   * - the kept voxels differ in position (e.g. the voxel left from a
+   *   ball, or where a closed curve lies inside a tunnel), and with
+   *   SKEL_END or SKEL_TABLE the number of anchored voxels, hence the
+   *   branches of the skeleton, may differ as well;
+   * - they coincide when the input has no simple voxel.
+   *
+   * @code
+   * DenseVoxelThinning<Z3i::Domain> thinning( domain );
+   * thinning.construct( set );
+   * thinning.setSimplicityTable( functions::loadTable( simplicity::tableSimple26_6 ) );
+   * thinning.setSkelTable( functions::loadTable( isthmusicity::tableIsthmus ) );
+   * thinning.thin( ParallelPolicy::threads() );
+   * Z3i::DigitalSet skeleton( domain );
+   * thinning.dumpVoxels( skeleton );
+   * @endcode
+   *
+   * @tparam TDomain a 3D HyperRectDomain.
+   * @see VoxelComplexThinning.h for the asymmetric thinning scheme on VoxelComplex.
+   */
+  template <typename TDomain>
+  class DenseVoxelThinning
+  {
+    BOOST_STATIC_ASSERT(( TDomain::dimension == 3 ));
+
+  public:
+    typedef DenseVoxelThinning<TDomain> Self;
+    typedef TDomain                     Domain;
+    typedef typename Domain::Point      Point;
+    typedef std::size_t                 Size;
+    typedef std::uint64_t               Word;
+    typedef boost::dynamic_bitset<>     ConfigMap;
+
+    /// The voxels kept by the skeleton predicate.
+    enum SkelType {
+      SKEL_ULTIMATE, ///< no voxel is anchored (ultimate skeleton).
+      SKEL_END,      ///< voxels with exactly one neighbor are anchored.
+      SKEL_TABLE     ///< voxels whose configuration is true in the skel table are anchored.
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The image is empty, the skeleton is ultimate.
+     * @param domain the domain of the image.
+     */
+    DenseVoxelThinning( const Domain & domain );
+
+    /**
+     * Inserts the points of a digital set (or any range of points of
+     * the domain) as voxels.
+     *
+     * @tparam TDigitalSet any range of points.
+     * @param input_set the points to insert.
+     */
+    template <typename TDigitalSet>
+    void construct( const TDigitalSet & input_set );
+
+    /**
+     * Sets the look-up table of simplicity, indexed by (26,6)
+     * configurations, e.g. loaded from simplicity::tableSimple26_6.
+     * It is required by thin().
+     * @param input_table table[conf]->bool
+     */
+    void setSimplicityTable( CountedPtr<ConfigMap> input_table );
+
+    /**
+     * Sets the look-up table of the skeleton predicate, indexed by
+     * (26,6) configurations, e.g. loaded from isthmusicity::tableIsthmus.
+     * The skeleton type becomes SKEL_TABLE.
+     * @param input_table table[conf]->bool
+     */
+    void setSkelTable( CountedPtr<ConfigMap> input_table );
+
+    /**
+     * Sets the skeleton type. SKEL_TABLE requires a table given by
+     * setSkelTable.
+     * @param skel the skeleton type.
+     */
+    void setSkelType( SkelType skel );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return the domain of the image.
+    const Domain & domain() const
+    {
+      return myDomain;
+    }
+
+    /// @return the number of voxels.
+    Size size() const;
+
+    /**
+     * @param p any point.
+     * @return 'true' if @a p is a voxel of the image.
+     */
+    bool operator()( const Point & p ) const;
+
+    /**
+     * @param p any point.
+     * @return 'true' if @a p has been anchored by the skeleton predicate.
+     */
+    bool isAnchored( const Point & p ) const;
+
+    /**
+     * @param p any point of the domain.
+     * @return the (26,6) neighborhood configuration of @a p, with the
+     * bit order of functions::mapZeroPointNeighborhoodToConfigurationMask.
+     */
+    NeighborhoodConfiguration configuration( const Point & p ) const;
+
+    /**
+     * @param p any point of the domain.
+     * @return 'true' if @a p is simple (requires the simplicity table).
+     */
+    bool isSimple( const Point & p ) const;
+
+    /**
+     * Thins the image until stability.
+     *
+     * @param policy the parallel policy (sequential by default).
+     * @param verbose if 'true', traces the number of voxels removed by each pass.
+     * @return the number of remaining voxels.
+     */
+    Size thin( const ParallelPolicy & policy = ParallelPolicy::sequential(),
+               bool verbose = false );
+
+    /// @return the number of voxels removed by each pass of the last thin().
+    const std::vector<Size> & removedPerPass() const
+    {
+      return myRemovedPerPass;
+    }
+
+    /**
+     * Inserts the voxels into a digital set.
+     * @tparam TDigitalSet the type of digital set.
+     * @param in_out_set the digital set, which is not cleared.
+     */
+    template <typename TDigitalSet>
+    void dumpVoxels( TDigitalSet & in_out_set ) const;
+
+    /// @return the number of bytes used by the image (approximately).
+    Size memoryUsage() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The domain of the image.
+    Domain myDomain;
+    /// The number of voxels along each axis, border included.
+    Size myWidth, myHeight, myDepth;
+    /// The number of words per row (including a guard word).
+    Size myRowWords;
+    /// The voxels, row by row (x fastest).
+    std::vector<Word> myVoxels;
+    /// The anchored voxels, with the same layout.
+    std::vector<Word> myAnchors;
+    /// The simplicity table.
+    CountedPtr<ConfigMap> mySimplicityTable;
+    /// The skeleton table.
+    CountedPtr<ConfigMap> mySkelTable;
+    /// The skeleton type.
+    SkelType mySkelType;
+    /// The number of voxels removed by each pass.
+    std::vector<Size> myRemovedPerPass;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /// @return the index of the row (y,z) in padded coordinates.
+    Size row( Size y, Size z ) const
+    {
+      return ( z * myHeight + y ) * myRowWords;
+    }
+
+    /// @return the padded coordinates of a point, false if outside the domain.
+    bool padded( const Point & p, Size & x, Size & y, Size & z ) const;
+
+    /// @return the bit at position x of the row starting at word r.
+    bool bit( const std::vector<Word> & bits, Size r, Size x ) const
+    {
+      return ( bits[ r + ( x >> 6 ) ] >> ( x & 63 ) ) & 1;
+    }
+
+    /// @return the 3 bits at positions x-1, x, x+1 of the row starting at word r.
+    Word bits3( Size r, Size x ) const;
+
+    /// @return the 27-bit occupancy of the 3x3x3 window centered on (x,y,z).
+    Word window( Size x, Size y, Size z ) const;
+
+    /// @return the 26-bit configuration of a 27-bit window (center dropped).
+    static NeighborhoodConfiguration configurationOfWindow( Word w )
+    {
+      return static_cast<NeighborhoodConfiguration>
+        ( ( w & 0x1fff ) | ( ( w >> 14 ) << 13 ) );
+    }
+
+    /// @return 'true' if the skeleton predicate holds for a configuration.
+    bool isSkel( NeighborhoodConfiguration conf ) const;
+
+    /**
+     * Visits the border voxels of slice z in the given direction,
+     * anchors the skeleton voxels and collects the simple ones.
+     * @param z the padded slice.
+     * @param dirBit the bit of the neighbor in the direction, in 27-bit windows.
+     * @param[out] candidates the candidates, as padded (y, x) pairs.
+     */
+    void collectCandidates( Size z, unsigned int dirBit,
+                            std::vector< std::pair<Size,Size> > & candidates );
+
+  }; // end of class DenseVoxelThinning
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DenseVoxelThinning'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DenseVoxelThinning' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain>
+  std::ostream&
+  operator<< ( std::ostream & out, const DenseVoxelThinning<TDomain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/DenseVoxelThinning.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DenseVoxelThinning_h
+
+#undef DenseVoxelThinning_RECURSES
+#endif // else defined(DenseVoxelThinning_RECURSES)
@@ -49,6 +49,7 @@
 #include "DGtal/base/IntegerSequenceIterator.h"
 #include "DGtal/topology/HalfEdgeDataStructure.h"
 #include "DGtal/topology/CDigitalSurfaceContainer.h"
+#include "DGtal/topology/SCellIndexTable.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -79,6 +80,12 @@ namespace DGtal
    * Model of concepts::CUndirectedSimpleGraph: the vertices and edges of the
    * digital surface form indeed a graph structure.
    *
+   * The mappings from surfels, linels and pointels to indices are
+   * SCellIndexTable (flat sorted arrays with a perfect hash), and the
+   * adjacency of vertices and faces is also available as flat arrays
+   * (see `IndexedDigitalSurface::flatAdjacency`), which is convenient
+   * for estimators looping over millions of surfels.
+   *
    * @note Vertices, Arcs, and Faces are all integer ranging from 0 to
    * one less than the total number of the respective elements. You
    * may thus iterate on them by just looping on integers. The index
@@ -231,6 +238,22 @@ namespace DGtal
 
     typedef IndexedPropertyMap< RealPoint >          PositionsMap;
 
+    /// Compact adjacency of the surface as flat arrays, in compressed
+    /// row storage: the neighbors of vertex v are the elements of \a
+    /// vertexNeighbors in range [vertexOffsets[v],vertexOffsets[v+1]),
+    /// in the order of writeNeighbors, and the vertices of face f are
+    /// the elements of \a faceVertices in range
+    /// [faceOffsets[f],faceOffsets[f+1]), in the order of verticesAroundFace.
+    struct FlatAdjacency {
+      std::vector<Index>       vertexOffsets;
+      std::vector<VertexIndex> vertexNeighbors;
+      std::vector<Index>       faceOffsets;
+      std::vector<VertexIndex> faceVertices;
+    };
+
+    /// The mapping type cell -> index.
+    typedef SCellIndexTable<KSpace>                  CellIndexTable;
+
   protected:
     typedef HalfEdgeDataStructure::HalfEdge      HalfEdge;
 
@@ -286,6 +309,11 @@ namespace DGtal
     const HalfEdgeDataStructure& heds() const
     { return myHEDS; }
 
+    /// @return a const reference to the adjacency of vertices and
+    /// faces stored as flat arrays (built with the surface).
+    const FlatAdjacency& flatAdjacency() const
+    { return myFlatAdjacency; }
+
     // ------------------------- standard services ------------------------------
   public:
     /// @return the number of half edges in the structure.
@@ -417,8 +445,8 @@ namespace DGtal
     /// or INVALID_FACE if it does not exist.
     Vertex getVertex( const SCell& aSurfel ) const
     {
-      auto it = mySurfel2VertexIndex.find( aSurfel );
-      return it != mySurfel2VertexIndex.end() ? it->second : INVALID_FACE;
+      const Index i = mySurfel2VertexIndex( aSurfel );
+      return i != CellIndexTable::INVALID_INDEX ? i : INVALID_FACE;
     }
 
     /// @param[in] aLinel any linel that is a separator on the surface (orientation is important).
@@ -427,8 +455,8 @@ namespace DGtal
     /// or INVALID_FACE if it does not exist.
     Arc getArc( const SCell& aLinel ) const
     {
-      auto it = myLinel2Arc.find( aLinel );
-      return it != myLinel2Arc.end() ? it->second : INVALID_FACE;
+      const Index i = myLinel2Arc( aLinel );
+      return i != CellIndexTable::INVALID_INDEX ? i : INVALID_FACE;
     }
 
     /// @param[in] aPointel any pointel that is a pivot on the surface (orientation is positive).
@@ -437,8 +465,8 @@ namespace DGtal
     /// or INVALID_FACE if it does not exist.
     Face getFace( const SCell& aPointel ) const
     {
-      auto it = myPointel2FaceIndex.find( aPointel );
-      return it != myPointel2FaceIndex.end() ? it->second : INVALID_FACE;
+      const Index i = myPointel2FaceIndex( aPointel );
+      return i != CellIndexTable::INVALID_INDEX ? i : INVALID_FACE;
     }
     
     // ----------------------- Undirected simple graph services -------------------------
@@ -677,17 +705,19 @@ namespace DGtal
     /// Stores the polygonal faces.
     PolygonalFacesStorage myPolygonalFaces;
     /// Mapping Surfel ->  VertexIndex
-    std::map< SCell, VertexIndex > mySurfel2VertexIndex;
+    CellIndexTable        mySurfel2VertexIndex;
     /// Mapping Linel  -> Arc
-    std::map< SCell, Arc >         myLinel2Arc;
+    CellIndexTable        myLinel2Arc;
     /// Mapping Pointel -> FaceIndex
-    std::map< SCell, FaceIndex >   myPointel2FaceIndex;
+    CellIndexTable        myPointel2FaceIndex;
     /// Mapping VertexIndex -> Surfel
     SCellStorage          myVertexIndex2Surfel;
     /// Mapping Arc         -> Linel
     SCellStorage          myArc2Linel;
     /// Mapping FaceIndex   -> Pointel
     SCellStorage          myFaceIndex2Pointel;
+    /// Adjacency of vertices and faces as flat arrays.
+    FlatAdjacency         myFlatAdjacency;
 
     
     // ------------------------- Private Datas --------------------------------
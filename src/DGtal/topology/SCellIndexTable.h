@@ -0,0 +1,263 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SCellIndexTable.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module SCellIndexTable.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SCellIndexTable_RECURSES)
+#error Recursive header files inclusion detected in SCellIndexTable.h
+#else // defined(SCellIndexTable_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SCellIndexTable_RECURSES
+
+#if !defined SCellIndexTable_h
+/** Prevents repeated inclusion of headers. */
+#define SCellIndexTable_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <array>
+#include <vector>
+#include <cstdint>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SCellIndexTable
+  /**
+   * Description of template class 'SCellIndexTable' <p>
+   * \brief Aim: Static map from signed cells to indices, stored in
+   * flat arrays, for numbering the cells of large digital surfaces.
+   *
+   * The table is built once from a range of distinct cells, the i-th
+   * cell of the range getting index i. Each cell is packed into a
+   * 64-bit key made of its Khalimsky coordinates (relative to the
+   * smallest ones of the range) and its sign. Keys are sorted by a
+   * LSD radix sort, then a perfect hash function
+   * (hash-and-displace) is built over them: a lookup costs one hash
+   * evaluation, two array accesses and one key comparison, whatever
+   * the number of cells.
+   *
+   * If the coordinates of the cells span too large a range to be
+   * packed into 64 bits, the table falls back to a sorted array of
+   * cells with binary search.
+   *
+   * It replaces advantageously a `std::map<SCell,Index>` when the
+   * map is built once and queried many times, e.g. in
+   * IndexedDigitalSurface.
+   *
+   * @code
+   * SCellIndexTable<KSpace> table;
+   * table.build( K, surfels.begin(), surfels.end() );
+   * auto i = table( surfels[ 5 ] ); // i == 5
+   * auto j = table( K.sCell( Point( 1, 1, 1 ) ) ); // j == table.INVALID_INDEX if absent
+   * @endcode
+   *
+   * @tparam TKSpace any model of concepts::CCellularGridSpaceND.
+   */
+  template <typename TKSpace>
+  class SCellIndexTable
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< TKSpace > ));
+
+  public:
+    typedef SCellIndexTable<TKSpace> Self;
+    typedef TKSpace                  KSpace;
+    typedef typename KSpace::SCell   SCell;
+    typedef typename KSpace::Point   Point;
+    typedef std::size_t              Index;
+    typedef std::size_t              Size;
+    typedef std::uint64_t            Key;
+
+    /// The index returned for cells that are not in the table.
+    static constexpr Index INVALID_INDEX = static_cast<Index>( -1 );
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor. The table is empty.
+     */
+    SCellIndexTable();
+
+    /**
+     * Builds the table. The i-th cell of the range gets index i. If a
+     * cell appears several times, its last index is kept (like
+     * successive assignments in a std::map).
+     *
+     * @tparam SCellConstIterator any forward iterator on SCell.
+     * @param K the cellular grid space of the cells (aliased).
+     * @param itb an iterator on the first cell.
+     * @param ite an iterator after the last cell.
+     */
+    template <typename SCellConstIterator>
+    void build( ConstAlias<KSpace> K,
+                SCellConstIterator itb, SCellConstIterator ite );
+
+    /// Empties the table.
+    void clear();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @param c any signed cell.
+     * @return the index of @a c, or INVALID_INDEX if @a c is not in
+     * the table.
+     */
+    Index operator()( const SCell & c ) const;
+
+    /// @return the number of (distinct) cells in the table.
+    Size size() const
+    {
+      return mySize;
+    }
+
+    /// @return 'true' if the table is empty.
+    bool empty() const
+    {
+      return mySize == 0;
+    }
+
+    /// @return 'true' if cells are packed into keys with a perfect
+    /// hash function, 'false' for the sorted array fallback.
+    bool isPacked() const
+    {
+      return myIsPacked;
+    }
+
+    /// @return the number of bytes used by the table (approximately).
+    Size memoryUsage() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// A slot of the perfect hash function: a key and its index
+    /// (INVALID_INDEX for an empty slot).
+    struct Slot
+    {
+      Key   key;
+      Index index;
+    };
+
+    /// The cellular grid space.
+    const KSpace* mySpace;
+    /// The number of cells.
+    Size mySize;
+    /// True if the cells are packed into keys, false otherwise.
+    bool myIsPacked;
+    /// Smallest Khalimsky coordinates of the cells.
+    Point myLowerKCoords;
+    /// Bit shift of each Khalimsky coordinate in a key.
+    std::array<unsigned int, KSpace::dimension> myShifts;
+    /// Bit mask of each Khalimsky coordinate in a key.
+    std::array<Key, KSpace::dimension> myMasks;
+    /// The sorted cells (fallback mode).
+    std::vector<SCell> myCells;
+    /// The index of each sorted cell (fallback mode).
+    std::vector<Index> myIndices;
+    /// The displacement of each bucket of the perfect hash function,
+    /// already hashed (packed mode).
+    std::vector<std::uint32_t> myDisplacements;
+    /// The slots of the perfect hash function (packed mode).
+    std::vector<Slot> mySlots;
+    /// The seed of the perfect hash function.
+    Key mySeed;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * @param c any signed cell.
+     * @param[out] key the key of @a c, when it is packable.
+     * @return 'false' if @a c lies outside the range of packable cells.
+     */
+    bool pack( const SCell & c, Key & key ) const;
+
+    /// @return the hash value of a key.
+    Key hash( Key key ) const;
+
+    /// @return the bucket of a hash value.
+    Size bucket( Key h ) const;
+
+    /// @return the slot of a hash value for a given (hashed) displacement.
+    Size slot( Key h, std::uint32_t d ) const;
+
+    /// Sorts (keys, indices) pairs by increasing keys, with a stable
+    /// LSD radix sort on the given number of significant bits.
+    static void radixSort( std::vector<Key> & keys, std::vector<Index> & indices,
+                           unsigned int nbBits );
+
+    /// Builds the perfect hash function over distinct keys.
+    /// @return 'false' if no displacement has been found for some
+    /// bucket (the caller then changes the seed).
+    bool buildPerfectHash( const std::vector<Key> & keys,
+                           const std::vector<Index> & indices );
+
+  }; // end of class SCellIndexTable
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SCellIndexTable'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SCellIndexTable' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const SCellIndexTable<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/SCellIndexTable.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SCellIndexTable_h
+
+#undef SCellIndexTable_RECURSES
+#endif // else defined(SCellIndexTable_RECURSES)
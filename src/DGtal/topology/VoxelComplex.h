@@ -40,6 +40,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include "boost/dynamic_bitset.hpp"
+#include <DGtal/base/ParallelPolicy.h>
 #include <DGtal/kernel/sets/DigitalSetBySTLSet.h>
 #include <DGtal/topology/CubicalComplex.h>
 #include <DGtal/topology/DigitalTopology.h>
@@ -376,12 +377,14 @@ class VoxelComplex : public CubicalComplex<TKSpace, TCellContainer> {
      * It calls @ref criticalCliquesForD
      *
      * @param cubical target complex to get critical cliques.
+     * @param policy the threads used to compute the cliques.
      * @param verbose print messages
      *
      * @return All critical cliques arranged by dimension.
      */
     std::array<CliqueContainer, dimension + 1>
-    criticalCliques(const Parent &cubical, bool verbose = false) const {
+    criticalCliques(const Parent &cubical, const ParallelPolicy &policy,
+                    bool verbose = false) const {
         ASSERT((dimension + 1) == 4);
         std::array<CliqueContainer, dimension + 1> criticals;
         if (verbose) {
@@ -389,7 +392,7 @@ class VoxelComplex : public CubicalComplex<TKSpace, TCellContainer> {
             trace.info() << cubical << std::endl;
         }
         for (Dimension d = 0; d != dimension + 1; ++d)
-            criticals[d] = criticalCliquesForD(d, cubical, verbose);
+            criticals[d] = criticalCliquesForD(d, cubical, policy, verbose);
 
         if (verbose) {
             trace.info() << std::endl;
@@ -397,6 +400,22 @@ class VoxelComplex : public CubicalComplex<TKSpace, TCellContainer> {
         }
         return criticals;
     }
+
+    /**
+     * Return all critical cliques for \b cubical, using the parallel
+     * policy of this complex.
+     *
+     * @param cubical target complex to get critical cliques.
+     * @param verbose print messages
+     *
+     * @return All critical cliques arranged by dimension.
+     *
+     * @see setParallelPolicy
+     */
+    std::array<CliqueContainer, dimension + 1>
+    criticalCliques(const Parent &cubical, bool verbose = false) const {
+        return criticalCliques(cubical, myParallelPolicy, verbose);
+    }
     /**
      * Helper. Call @ref criticalCliques of this VoxelComplex.
      *
@@ -413,19 +432,62 @@ class VoxelComplex : public CubicalComplex<TKSpace, TCellContainer> {
      * Main method to iterate over cells of selected dimension in a complex,
      * returning critical cliques. Uses @ref criticalCliquePair.
      *
+     * The cells are split into contiguous chunks, a few per thread,
+     * scheduled by work stealing. Each chunk fills its own buffer and
+     * the buffers are concatenated in order, so that the cliques are
+     * the same and in the same order whatever the number of threads.
+     *
      * @param d dimension of cell.
      * @param cubical target complex to get critical cliques.
+     * @param policy the threads used to compute the cliques.
      * @param verbose print messages
      *
      * @return CliqueContainer with the computed cliques for the specified
      * dimension.
-     *
-     * @note it uses OpenMP if available.
      */
     CliqueContainer criticalCliquesForD(const Dimension d,
                                         const Parent &cubical,
+                                        const ParallelPolicy &policy,
                                         bool verbose = false) const;
 
+    /**
+     * Calls @ref criticalCliquesForD with the parallel policy of this
+     * complex.
+     *
+     * @param d dimension of cell.
+     * @param cubical target complex to get critical cliques.
+     * @param verbose print messages
+     *
+     * @return CliqueContainer with the computed cliques for the specified
+     * dimension.
+     *
+     * @see setParallelPolicy
+     */
+    CliqueContainer criticalCliquesForD(const Dimension d,
+                                        const Parent &cubical,
+                                        bool verbose = false) const {
+        return criticalCliquesForD(d, cubical, myParallelPolicy, verbose);
+    }
+
+    /**
+     * Sets the threads used by the methods computing critical cliques
+     * without explicit policy (e.g. in the thinning schemes of
+     * VoxelComplexFunctions.h). It is copied with the complex.
+     *
+     * @param policy the parallel policy.
+     */
+    void setParallelPolicy(const ParallelPolicy &policy) {
+        myParallelPolicy = policy;
+    }
+
+    /**
+     * @return the parallel policy of this complex (by default, the
+     * default ParallelPolicy).
+     */
+    const ParallelPolicy &parallelPolicy() const {
+        return myParallelPolicy;
+    }
+
     /**
      * Compute the criticality of the surfel between A,B voxels and
      * returns the associated 2-clique.
@@ -523,6 +585,8 @@ class VoxelComplex : public CubicalComplex<TKSpace, TCellContainer> {
     /** ConfigurationMask (LUT table). */
     CountedPtrOrPtr<PointToMaskMap> myPointToMaskPtr;
     bool myIsTableLoaded{false}; ///< Flag if using a LUT for simplicity.
+    /** Threads used to compute critical cliques. */
+    ParallelPolicy myParallelPolicy;
 
     /*------------- Internal Methods --------------*/
     /**
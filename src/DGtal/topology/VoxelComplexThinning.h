@@ -34,6 +34,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/topology/VoxelComplex.h"
 #include "DGtal/topology/VoxelComplexFunctions.h"
+#include "DGtal/topology/DenseVoxelThinning.h"
 #include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -248,5 +249,100 @@ TComplex thinningVoxelComplex(
   return vc_new;
 }
 
+/*
+Get a thinned voxel complex with the dense thinning engine
+DenseVoxelThinning: the voxels are copied into a bit-packed image,
+thinned by directional sub-iterations (border voxels processed in
+parallel), then copied back into a new complex.
+
+Parameters:
+----------
+complex: TComplex
+    input complex to thin
+
+skel_type_str: str
+    Voxels to keep in the skeletonization process.
+
+    [end, ultimate, isthmus, isthmus1]
+    - end: keep end voxels.
+    - ultimate: don't keep extra voxels, ultimate skeleton.
+    - isthmus: keep voxels that are isthmuses (isthmusicity table).
+    - isthmus1: keep voxels that are 1-isthmuses (isthmusicityOne table).
+
+tables_folder: str
+    Location of the DGtal look-up-tables for simplicity and isthmusicity,
+    for example simplicity_table26_6.zlib.
+
+policy: ParallelPolicy
+    threads used by the thinning (sequential by default). The result
+    does not depend on the number of threads.
+
+profile: bool
+    time the algorithm
+
+verbose: bool
+    extra information displayed during the algorithm, e.g. the number
+    of voxels removed by each pass.
+
+Return
+------
+A new thinned voxel complex.
+*/
+template<typename TComplex>
+TComplex denseThinningVoxelComplex(
+  TComplex & vc,
+  const std::string & skel_type_str,
+  const std::string & tables_folder,
+  const ParallelPolicy & policy = ParallelPolicy::sequential(),
+  const bool profile = false,
+  const bool verbose = false)
+{
+  using Complex = TComplex;
+  using Domain = HyperRectDomain<typename Complex::Space>;
+  using Thinning = DenseVoxelThinning<Domain>;
+
+  const auto &sk = skel_type_str;
+  const bool skel_type_str_is_valid =
+    sk == "ultimate" || sk == "end" || sk == "isthmus" ||
+    sk == "1isthmus" || sk == "isthmus1";
+  if(!skel_type_str_is_valid) {
+    throw std::runtime_error("skel_type_str is not valid: \"" + skel_type_str + "\"");
+  }
+
+  auto start = std::chrono::system_clock::now();
+  const Domain domain(vc.space().lowerBound(), vc.space().upperBound());
+  DigitalSetByAssociativeContainer<Domain,
+    std::unordered_set<typename Domain::Point>> voxels(domain);
+  vc.dumpVoxels(voxels);
+
+  Thinning thinning(domain);
+  thinning.construct(voxels);
+  thinning.setSimplicityTable(
+      DGtal::functions::loadTable(tables_folder + "/simplicity_table26_6.zlib"));
+  if(sk == "end") {
+    thinning.setSkelType(Thinning::SKEL_END);
+  } else if(sk == "isthmus") {
+    thinning.setSkelTable(
+        DGtal::functions::loadTable(tables_folder + "/isthmusicity_table26_6.zlib"));
+  } else if(sk == "isthmus1" || sk == "1isthmus") {
+    thinning.setSkelTable(
+        DGtal::functions::loadTable(tables_folder + "/isthmusicityOne_table26_6.zlib"));
+  }
+  thinning.thin(policy, verbose);
+
+  voxels.clear();
+  thinning.dumpVoxels(voxels);
+  Complex vc_new(vc.space());
+  vc_new.construct(voxels);
+  vc_new.copySimplicityTable(vc);
+
+  auto end = std::chrono::system_clock::now();
+  auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(end - start);
+  if(profile) {
+    std::cout << "Time elapsed: " << elapsed.count() << std::endl;
+  }
+  return vc_new;
+}
+
 } // namespace functions
 } // namespace DGtal
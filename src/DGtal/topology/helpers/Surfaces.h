@@ -41,8 +41,10 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Exceptions.h"
+#include "DGtal/base/ParallelPolicy.h"
 #include "DGtal/topology/SurfelAdjacency.h"
 #include "DGtal/topology/SurfelNeighborhood.h"
 
@@ -623,6 +625,49 @@ namespace DGtal
       const PointPredicate & pp,
       bool forceOrientCellExterior=false );
 
+    /**
+       Parallel version of extractAllConnectedSCell. The boundary
+       surfels are extracted by slabs (see sMakeBoundary), then each
+       thread links every surfel of its chunk to its adjacent surfels
+       in a concurrent (lock-free) union-find structure, whose roots
+       are always the smallest surfels of their components.
+
+       The result is the same as the sequential version: components
+       are ordered by their smallest surfel, and the surfels of each
+       component are sorted in increasing order. The first surfel of
+       each component may thus be used as its representative (e.g. to
+       build a LightImplicitDigitalSurface).
+
+       @tparam PointPredicate a model of concepts::CPointPredicate describing
+       the inside of a digital shape. It is called concurrently, hence
+       must be safe to evaluate from several threads (like images).
+
+       @param aVectConnectedSCell (modified) a vector containing for
+       each connected components a vector of its SCells.
+
+       @param aKSpace any space.
+
+       @param aSurfelAdj the surfel adjacency chosen for the tracking.
+
+       @param pp an instance of a model of concepts::CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape.
+
+       @param forceOrientCellExterior if 'true', used to change the
+       default cell orientation in order to get the direction of shape
+       exterior (see orientSCellExterior).
+
+       @param policy the parallel policy.
+    */
+    template <typename PointPredicate >
+    static
+    void extractAllConnectedSCell
+    ( std::vector< std::vector<SCell> > & aVectConnectedSCell,
+      const KSpace & aKSpace,
+      const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+      const PointPredicate & pp,
+      bool forceOrientCellExterior,
+      const ParallelPolicy & policy );
+
     
     
 
@@ -717,6 +762,39 @@ namespace DGtal
                         const Point & aLowerBound, 
                         const Point & aUpperBound  );
 
+    /**
+       Parallel version of sMakeBoundary. The box [aLowerBound,
+       aUpperBound] is cut into slabs along the last axis, which are
+       scanned concurrently, then the surfels of the slabs are merged.
+       The output is the same set of surfels as the sequential
+       version, as a vector sorted in increasing order (i.e. the order
+       of a std::set<SCell>).
+
+       @tparam PointPredicate a model of concepts::CPointPredicate describing
+       the inside of a digital shape. It is called concurrently, hence
+       must be safe to evaluate from several threads (like images).
+
+       @param aBoundary (modified) the sorted vector of surfels of the
+       boundary of the shape.
+
+       @param aKSpace any space.
+       @param pp an instance of a model of concepts::CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape.
+
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+
+       @param policy the parallel policy.
+    */
+    template <typename PointPredicate >
+    static
+    void sMakeBoundary( std::vector<SCell> & aBoundary,
+                        const KSpace & aKSpace,
+                        const PointPredicate & pp,
+                        const Point & aLowerBound,
+                        const Point & aUpperBound,
+                        const ParallelPolicy & policy );
+
     /**
        Writes on the output iterator @a out_it the unsigned surfels
        whose elements represents all the boundary elements of a
@@ -0,0 +1,108 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testParallelPolicy.cpp
+ * @ingroup Tests
+ * @date 2026/10/17
+ *
+ * Functions for testing classes ParallelPolicy and WorkStealingScheduler.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <atomic>
+#include <stdexcept>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelPolicy.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ParallelPolicy.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing ParallelPolicy" )
+{
+  SECTION( "Policies" )
+    {
+      REQUIRE( ParallelPolicy::sequential().isSequential() );
+      REQUIRE( ParallelPolicy::sequential().nbThreads() == 1 );
+      REQUIRE( ParallelPolicy::threads( 6 ).nbThreads() == 6 );
+      REQUIRE( ParallelPolicy::threads().nbThreads() >= 1 );
+      REQUIRE( ParallelPolicy().isValid() );
+    }
+}
+
+TEST_CASE( "Testing WorkStealingScheduler" )
+{
+  SECTION( "Each task is run exactly once" )
+    {
+      for ( unsigned int n : { 1u, 2u, 7u, 32u } )
+        for ( std::size_t nbTasks : { std::size_t( 0 ), std::size_t( 1 ), std::size_t( 5 ), std::size_t( 1000 ) } )
+          {
+            WorkStealingScheduler scheduler( ParallelPolicy::threads( n ) );
+            std::vector< std::atomic<int> > counts( nbTasks );
+            for ( auto & c : counts ) c = 0;
+            std::atomic<bool> validThreads( true );
+            scheduler.run( nbTasks, [&] ( std::size_t i, unsigned int t )
+              {
+                ++counts[ i ];
+                if ( t >= scheduler.nbThreads() ) validThreads = false;
+              } );
+            bool once = true;
+            for ( auto const & c : counts ) once = once && ( c == 1 );
+            REQUIRE( once );
+            REQUIRE( validThreads );
+          }
+    }
+
+  SECTION( "Unbalanced tasks are stolen" )
+    {
+      // All the costly tasks are at the beginning of the first range.
+      WorkStealingScheduler scheduler( ParallelPolicy::threads( 4 ) );
+      std::vector<double> values( 400, 0.0 );
+      scheduler.run( values.size(), [&] ( std::size_t i, unsigned int )
+        {
+          const int loops = ( i < 100 ) ? 20000 : 10;
+          double v = 0.0;
+          for ( int k = 0; k < loops; ++k ) v += 1.0 / ( 1.0 + k + i );
+          values[ i ] = v;
+        } );
+      bool computed = true;
+      for ( auto v : values ) computed = computed && ( v > 0.0 );
+      REQUIRE( computed );
+      trace.info() << scheduler << std::endl;
+    }
+
+  SECTION( "Exceptions are forwarded" )
+    {
+      WorkStealingScheduler scheduler( ParallelPolicy::threads( 3 ) );
+      REQUIRE_THROWS_AS( scheduler.run( 100, [] ( std::size_t i, unsigned int )
+        {
+          if ( i == 42 ) throw std::runtime_error( "task 42" );
+        } ), std::runtime_error );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
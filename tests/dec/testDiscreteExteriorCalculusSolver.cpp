@@ -0,0 +1,141 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class DiscreteExteriorCalculusSolver.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z2i;
+
+typedef DiscreteExteriorCalculus<2, 2, EigenLinearAlgebraBackend> Calculus;
+typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DiscreteExteriorCalculusSolver.
+///////////////////////////////////////////////////////////////////////////////
+
+/// The symmetric definite operator c Id + d0^T d0, whose pattern does
+/// not depend on c > 0.
+Calculus::PrimalIdentity0 makeOperator( const Calculus & calculus, double c )
+{
+  const Calculus::PrimalDerivative0 d0 = calculus.derivative<0, PRIMAL>();
+  return c * calculus.identity<0, PRIMAL>() + d0.transpose() * d0;
+}
+
+TEST_CASE( "Testing DiscreteExteriorCalculusSolver" )
+{
+  const Domain domain( Point( 0, 0 ), Point( 19, 14 ) );
+  DigitalSet set( domain );
+  for ( auto const & p : domain )
+    if ( ( p - Point( 9, 7 ) ).squaredNorm() <= 42 ) set.insertNew( p );
+  const Calculus calculus = CalculusFactory::createFromDigitalSet( set );
+  Calculus::PrimalForm0 input( calculus );
+  for ( Calculus::Index i = 0; i < input.length(); ++i )
+    input.myContainer( i ) = ( i % 7 == 0 ) ? 1.0 : 0.0;
+
+  SECTION( "Reuse of the symbolic analysis with a direct solver" )
+    {
+      typedef DiscreteExteriorCalculusSolver<Calculus, EigenLinearAlgebraBackend::SolverSimplicialLDLT,
+                                             0, PRIMAL, 0, PRIMAL> Solver;
+      Solver solver;
+      for ( int iter = 0; iter < 4; ++iter )
+        {
+          const double c = 0.5 + iter;
+          const Calculus::PrimalIdentity0 ope = makeOperator( calculus, c );
+          solver.compute( ope );
+          REQUIRE( solver.isValid() );
+          const Calculus::PrimalForm0 x = solver.solve( input );
+          Solver fresh;
+          fresh.compute( ope );
+          REQUIRE( ( x.myContainer - fresh.solve( input ).myContainer ).norm() < 1e-12 );
+          REQUIRE( ( ope.myContainer * x.myContainer - input.myContainer ).norm() < 1e-10 );
+        }
+      REQUIRE( solver.timings().size() == 4 );
+      REQUIRE( ! solver.timings()[ 0 ].patternReused );
+      for ( int iter = 1; iter < 4; ++iter )
+        {
+          REQUIRE( solver.timings()[ iter ].patternReused );
+          REQUIRE( solver.timings()[ iter ].analyze == 0.0 );
+          REQUIRE( solver.timings()[ iter ].nbSolves == 1 );
+        }
+      // A different pattern is detected.
+      const Calculus::PrimalIdentity0 id = calculus.identity<0, PRIMAL>();
+      solver.compute( id );
+      REQUIRE( ! solver.timings().back().patternReused );
+      REQUIRE( ( solver.solve( input ).myContainer - input.myContainer ).norm() < 1e-12 );
+      // Explicit hint.
+      const Calculus::PrimalIdentity0 id2 = 2.0 * id;
+      solver.compute( id2, true );
+      REQUIRE( solver.timings().back().patternReused );
+      REQUIRE( ( 2.0 * solver.solve( input ).myContainer - input.myContainer ).norm() < 1e-12 );
+      solver.clearTimings();
+      REQUIRE( solver.timings().empty() );
+    }
+
+  SECTION( "Warm start of an iterative solver" )
+    {
+      typedef DiscreteExteriorCalculusSolver<Calculus, EigenLinearAlgebraBackend::SolverConjugateGradient,
+                                             0, PRIMAL, 0, PRIMAL> Solver;
+      Solver cold, warm;
+      warm.setWarmStart( true );
+      REQUIRE( warm.warmStart() );
+      Eigen::Index coldIterations = 0, warmIterations = 0;
+      // Iterative solvers keep a reference to the operator.
+      Calculus::PrimalIdentity0 ope = makeOperator( calculus, 0.2 );
+      for ( int iter = 0; iter < 5; ++iter )
+        {
+          const double c = 0.2 + 0.01 * iter;
+          ope = makeOperator( calculus, c );
+          cold.compute( ope );
+          warm.compute( ope );
+          const Calculus::PrimalForm0 xc = cold.solve( input );
+          coldIterations += cold.myLinearAlgebraSolver.iterations();
+          const Calculus::PrimalForm0 xw = warm.solve( input );
+          if ( iter > 0 ) warmIterations += warm.myLinearAlgebraSolver.iterations();
+          else            coldIterations -= cold.myLinearAlgebraSolver.iterations();
+          REQUIRE( ( xc.myContainer - xw.myContainer ).norm() < 1e-6 * xc.myContainer.norm() );
+        }
+      REQUIRE( warmIterations < coldIterations );
+      // An explicit initial guess close to the solution needs fewer iterations.
+      const Calculus::PrimalForm0 x = cold.solve( input );
+      const auto iterations = cold.myLinearAlgebraSolver.iterations();
+      cold.solve( input, x );
+      REQUIRE( cold.myLinearAlgebraSolver.iterations() < iterations );
+      REQUIRE( cold.timings().back().nbSolves == 3 );
+    }
+}
+
+/** @ingroup Tests **/
@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <sstream>
 #include "DGtal/base/Common.h"
 #include "ConfigTest.h"
 #include "DGtalCatch.h"
@@ -88,5 +89,45 @@ TEST_CASE( "Testing GeodesicsInHeat" )
     auto sources = heat.source();
     REQUIRE(sources.sum() == 0);
   }
+
+  SECTION("Batch computations and saved factorizations")
+  {
+    typedef GeodesicsInHeat<PolygonalCalculus<RealPoint,RealVector>> Heat;
+    const std::vector< std::vector< Heat::Vertex > > sourceSets
+      = { { 0 }, { 3 }, { 7, 0 }, { 9 }, { 2, 5, 8 } };
+    for ( bool boundary : { false, true } )
+      {
+        CAPTURE( boundary );
+        Heat heat(boxCalculus);
+        heat.init( 0.1, 1.0, boundary );
+        Heat::DenseMatrix expected( positions.size(), sourceSets.size() );
+        for ( std::size_t i = 0; i < sourceSets.size(); ++i )
+          {
+            heat.clearSource();
+            for ( auto v : sourceSets[ i ] ) heat.addSource( v );
+            expected.col( i ) = heat.compute();
+          }
+        for ( unsigned int nbThreads : { 1u, 3u } )
+          {
+            const Heat::DenseMatrix d = heat.computeBatch
+              ( sourceSets, nbThreads == 1 ? ParallelPolicy::sequential()
+                                           : ParallelPolicy::threads( nbThreads ) );
+            REQUIRE( d.cols() == expected.cols() );
+            REQUIRE( ( d - expected ).cwiseAbs().maxCoeff() < 1e-10 );
+          }
+        std::stringstream buffer;
+        REQUIRE( heat.saveFactorizations( buffer ) );
+        Heat heat2(boxCalculus);
+        REQUIRE( heat2.loadFactorizations( buffer ) );
+        REQUIRE( heat2.isValid() );
+        heat2.addSource( 7 );
+        heat2.addSource( 0 );
+        REQUIRE( ( heat2.compute() - expected.col( 2 ) ).cwiseAbs().maxCoeff() < 1e-10 );
+        REQUIRE( ( heat2.computeBatch( sourceSets ) - expected ).cwiseAbs().maxCoeff() < 1e-10 );
+        std::stringstream garbage( "not a factorization" );
+        REQUIRE( ! heat2.loadFactorizations( garbage ) );
+        REQUIRE( ! heat2.isValid() );
+      }
+  }
 }
 /** @ingroup Tests **/
@@ -370,4 +370,80 @@ TEST_CASE( "Testing PolygonalCalculus and DirichletConditions" )
     }
 };
 
+TEST_CASE( "Testing PolygonalCalculus parallel assembly" )
+{
+  typedef Shortcuts< KSpace >                SH3;
+  typedef SurfaceMesh< RealPoint,RealPoint > Mesh;
+  typedef Mesh::Index                        Index;
+  typedef PolygonalCalculus< RealPoint,RealVector > PolyDEC;
+
+  auto params = SH3::defaultParameters();
+  params( "polynomial", "goursat" )( "gridstep", 0.5 );
+  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto binary_image    = SH3::makeBinaryImage( digitized_shape, params );
+  auto surface         = SH3::makeDigitalSurface( binary_image, K, params );
+  auto primalSurface   = SH3::makePrimalSurfaceMesh(surface);
+
+  // Quads, and a mix of triangles and quads (one quad out of two is split).
+  std::vector<RealPoint> positions = primalSurface->positions();
+  std::vector<std::vector< Index > > quads, mixed;
+  for( Index face = 0 ; face < primalSurface->nbFaces(); ++face )
+    {
+      const auto & v = primalSurface->incidentVertices( face );
+      quads.push_back( v );
+      if ( face % 2 == 0 || v.size() != 4 ) mixed.push_back( v );
+      else
+        {
+          mixed.push_back( { v[ 0 ], v[ 1 ], v[ 2 ] } );
+          mixed.push_back( { v[ 0 ], v[ 2 ], v[ 3 ] } );
+        }
+    }
+  // Smooth the positions a little, so that faces are not planar.
+  for ( auto & p : positions )
+    p += 0.1 * RealPoint( sin( p[ 1 ] ), cos( p[ 2 ] ), sin( p[ 0 ] ) );
+
+  auto relDiff = [] ( const PolyDEC::SparseMatrix & A, const PolyDEC::SparseMatrix & B )
+  {
+    return ( A - B ).norm() / B.norm();
+  };
+
+  for ( auto faces : { quads, mixed } )
+    {
+      Mesh surfmesh( positions.begin(), positions.end(), faces.begin(), faces.end() );
+      PolyDEC calculus( surfmesh );
+      PolyDEC calculusCached( surfmesh, true );
+      const PolyDEC::SparseMatrix L  = calculus.globalLaplaceBeltrami( 0.8 );
+      const PolyDEC::SparseMatrix CL = calculus.globalConnectionLaplace( 0.8 );
+      const PolyDEC::SparseMatrix M  = calculus.globalLumpedMassMatrix();
+      const PolyDEC::SparseMatrix M2 = calculus.doubledGlobalLumpedMassMatrix();
+      const auto pattern  = calculus.makeAssemblyPattern();
+      const auto pattern2 = calculus.makeAssemblyPattern( 2 );
+      REQUIRE( pattern.matrix.nonZeros() >= L.nonZeros() );
+      REQUIRE( pattern2.matrix.nonZeros() >= CL.nonZeros() );
+      for ( unsigned int nbThreads : { 1u, 3u } )
+        {
+          CAPTURE( nbThreads );
+          const ParallelPolicy policy = nbThreads == 1 ? ParallelPolicy::sequential()
+                                                       : ParallelPolicy::threads( nbThreads );
+          REQUIRE( relDiff( calculus.globalLaplaceBeltrami( 0.8, policy ), L ) < 1e-12 );
+          REQUIRE( relDiff( calculus.globalLaplaceBeltrami( pattern, 0.8, policy ), L ) < 1e-12 );
+          REQUIRE( relDiff( calculusCached.globalLaplaceBeltrami( pattern, 0.8, policy ), L ) < 1e-12 );
+          REQUIRE( relDiff( calculus.globalConnectionLaplace( pattern2, 0.8, policy ), CL ) < 1e-12 );
+          REQUIRE( ( calculus.globalLumpedMassMatrix( policy ) - M ).norm() == 0.0 );
+          REQUIRE( ( calculus.doubledGlobalLumpedMassMatrix( policy ) - M2 ).norm() == 0.0 );
+        }
+      // Fixed-size local operators are stored in the internal cache.
+      for ( PolyDEC::Face f : { 0, 1 } )
+        REQUIRE( ( calculusCached.laplaceBeltrami( f, 0.8 )
+                   - calculus.laplaceBeltrami( f, 0.8 ) ).norm() < 1e-12 );
+      // The pattern is reused when positions change.
+      for ( Index v = 0; v < surfmesh.nbVertices(); ++v )
+        surfmesh.position( v ) *= 1.5;
+      REQUIRE( relDiff( calculus.globalLaplaceBeltrami( pattern, 0.8, ParallelPolicy::threads( 2 ) ),
+                        calculus.globalLaplaceBeltrami( 0.8 ) ) < 1e-12 );
+    }
+}
+
 /** @ingroup Tests **/
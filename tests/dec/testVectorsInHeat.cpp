@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <sstream>
 #include "DGtal/base/Common.h"
 #include "ConfigTest.h"
 #include "DGtalCatch.h"
@@ -89,5 +90,53 @@ TEST_CASE( "Testing VectorsInHeat" )
     VectorsInHeat<PolygonalCalculus<RealPoint,RealVector>>::Vector sources=heat.vectorSource();
     REQUIRE( sources.sum() == 0);
   }
+
+  SECTION("Batch computations and saved factorizations")
+  {
+    typedef VectorsInHeat<PolygonalCalculus<RealPoint,RealVector>> Heat;
+    const std::vector< std::vector< Heat::Source > > sourceSets
+      = { { { 0, Eigen::Vector3d( 0.1, 0.2, 0.3 ) } },
+          { { 3, Eigen::Vector3d( 1.0, 0.0, 0.0 ) } },
+          { { 7, Eigen::Vector3d( 0.0, 1.0, 0.5 ) }, { 0, Eigen::Vector3d( 0.3, 0.0, 1.0 ) } },
+          { { 9, Eigen::Vector3d( -1.0, 0.5, 0.0 ) } } };
+    auto maxDiff = [] ( const std::vector<Heat::Vector> & a, const std::vector<Heat::Vector> & b )
+    {
+      double m = ( a.size() == b.size() ) ? 0.0 : 1.0;
+      for ( std::size_t i = 0; i < std::min( a.size(), b.size() ); ++i )
+        m = std::max( m, ( a[ i ] - b[ i ] ).cwiseAbs().maxCoeff() );
+      return m;
+    };
+    for ( bool boundary : { false, true } )
+      {
+        CAPTURE( boundary );
+        Heat heat(boxCalculus);
+        heat.init( 0.1, 1.0, boundary );
+        std::vector< std::vector<Heat::Vector> > expected;
+        for ( const auto & sources : sourceSets )
+          {
+            heat.clearSource();
+            for ( const auto & s : sources ) heat.addSource( s.first, s.second );
+            expected.push_back( heat.compute() );
+          }
+        for ( unsigned int nbThreads : { 1u, 3u } )
+          {
+            const auto d = heat.computeBatch
+              ( sourceSets, nbThreads == 1 ? ParallelPolicy::sequential()
+                                           : ParallelPolicy::threads( nbThreads ) );
+            REQUIRE( d.size() == expected.size() );
+            double m = 0.0;
+            for ( std::size_t i = 0; i < d.size(); ++i )
+              m = std::max( m, maxDiff( d[ i ], expected[ i ] ) );
+            REQUIRE( m < 1e-10 );
+          }
+        std::stringstream buffer;
+        REQUIRE( heat.saveFactorizations( buffer ) );
+        Heat heat2(boxCalculus);
+        REQUIRE( heat2.loadFactorizations( buffer ) );
+        REQUIRE( heat2.isValid() );
+        heat2.addSource( 3, Eigen::Vector3d( 1.0, 0.0, 0.0 ) );
+        REQUIRE( maxDiff( heat2.compute(), expected[ 1 ] ) < 1e-10 );
+      }
+  }
 }
 /** @ingroup Tests **/
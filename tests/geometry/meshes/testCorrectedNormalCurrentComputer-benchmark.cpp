@@ -0,0 +1,173 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCorrectedNormalCurrentComputer-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmarks the interpolated corrected curvature measures of all the
+ * faces of a triangulated torus, computed face by face with
+ * CorrectedNormalCurrentFormula (scalar path) and by
+ * CorrectedNormalCurrentComputer (batches of triangles, sequential and
+ * parallel).
+ *
+ * Usage: testCorrectedNormalCurrentComputer-benchmark [m [n [threads]]]
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/base/ParallelPolicy.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/SurfaceMesh.h"
+#include "DGtal/shapes/SurfaceMeshHelper.h"
+#include "DGtal/geometry/meshes/CorrectedNormalCurrentComputer.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Z3i::RealPoint                                     RealPoint;
+typedef Z3i::RealVector                                    RealVector;
+typedef SurfaceMesh< RealPoint, RealVector >               SM;
+typedef SurfaceMeshHelper< RealPoint, RealVector >         SMH;
+typedef CorrectedNormalCurrentComputer< RealPoint, RealVector > CNCComputer;
+typedef CNCComputer::Formula                               Formula;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class CorrectedNormalCurrentComputer.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return the sum of the face measures mu0, mu1, mu2 and muXY(0,1).
+double checksum( const SM& mesh,
+                 const CNCComputer::ScalarMeasure& mu0, const CNCComputer::ScalarMeasure& mu1,
+                 const CNCComputer::ScalarMeasure& mu2, const CNCComputer::TensorMeasure& muXY )
+{
+  double sum = 0.0;
+  for ( SM::Face f = 0; f < mesh.nbFaces(); ++f )
+    {
+      sum += mu0 .kMeasures( 2 )[ f ];
+      sum += mu1 .kMeasures( 2 )[ f ];
+      sum += mu2 .kMeasures( 2 )[ f ];
+      sum += muXY.kMeasures( 2 )[ f ]( 0, 1 );
+    }
+  return sum;
+}
+
+/// Computes a measure face by face with the given formula, as
+/// CorrectedNormalCurrentComputer did before batches.
+template < typename Value, typename FaceFormula >
+void scalarFaceMeasures( const SM& mesh, std::vector< Value >& face_mu,
+                         FaceFormula face_formula )
+{
+  face_mu.resize( mesh.nbFaces() );
+  SM::Face idx_f = 0;
+  for ( const auto& f : mesh.allIncidentVertices() )
+    {
+      std::vector< RealPoint >  p( f.size() );
+      std::vector< RealVector > u( f.size() );
+      for ( std::size_t i = 0; i < f.size(); ++i )
+        {
+          p[ i ] = mesh.positions()    [ f[ i ] ];
+          u[ i ] = mesh.vertexNormals()[ f[ i ] ];
+        }
+      face_mu[ idx_f++ ] = face_formula( p, u );
+    }
+}
+
+/// Computes mu0, mu1, mu2 and muXY with the scalar path.
+/// @return a checksum of the measures.
+double scalarMeasures( const SM& mesh )
+{
+  typedef std::vector< RealPoint >  Points;
+  typedef std::vector< RealVector > Vectors;
+  const CNCComputer::RealTensor zeroT { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+  CNCComputer::ScalarMeasure mu0( &mesh, 0.0 ), mu1( &mesh, 0.0 ), mu2( &mesh, 0.0 );
+  CNCComputer::TensorMeasure muXY( &mesh, zeroT );
+  scalarFaceMeasures( mesh, mu0.kMeasures( 2 ), [] ( const Points& p, const Vectors& u )
+                      { return Formula::mu0InterpolatedU( p, u ); } );
+  scalarFaceMeasures( mesh, mu1.kMeasures( 2 ), [] ( const Points& p, const Vectors& u )
+                      { return Formula::mu1InterpolatedU( p, u ); } );
+  scalarFaceMeasures( mesh, mu2.kMeasures( 2 ), [] ( const Points& p, const Vectors& u )
+                      { return Formula::mu2InterpolatedU( p, u ); } );
+  scalarFaceMeasures( mesh, muXY.kMeasures( 2 ), [] ( const Points& p, const Vectors& u )
+                      { return Formula::muXYInterpolatedU( p, u ); } );
+  return checksum( mesh, mu0, mu1, mu2, muXY );
+}
+
+/// Computes mu0, mu1, mu2 and muXY with CorrectedNormalCurrentComputer.
+/// @return a checksum of the measures.
+double batchMeasures( const SM& mesh, const ParallelPolicy& policy )
+{
+  CNCComputer computer( mesh );
+  const auto mu0  = computer.computeMu0 ( policy );
+  const auto mu1  = computer.computeMu1 ( policy );
+  const auto mu2  = computer.computeMu2 ( policy );
+  const auto muXY = computer.computeMuXY( policy );
+  return checksum( mesh, mu0, mu1, mu2, muXY );
+}
+
+bool benchmarkCorrectedNormalCurrentComputer( std::size_t m, std::size_t n,
+                                              unsigned int nb_threads )
+{
+  const auto mesh = SMH::makeTorus( 3.0, 1.0, RealPoint::zero, m, n, 1,
+                                    SMH::NormalsType::VERTEX_NORMALS );
+  trace.beginBlock( "Curvature measures of " + std::to_string( mesh.nbFaces() )
+                    + " triangles" );
+  Clock c;
+  c.startClock();
+  const double s_scalar = scalarMeasures( mesh );
+  const double t_scalar = c.stopClock();
+  trace.info() << "scalar path: " << t_scalar << " ms" << std::endl;
+  c.startClock();
+  const double s_batch = batchMeasures( mesh, ParallelPolicy::sequential() );
+  const double t_batch = c.stopClock();
+  trace.info() << "batches, sequential: " << t_batch << " ms"
+               << " (x" << t_scalar / t_batch << ")" << std::endl;
+  const auto policy = ParallelPolicy::threads( nb_threads );
+  c.startClock();
+  const double s_par = batchMeasures( mesh, policy );
+  const double t_par = c.stopClock();
+  trace.info() << "batches, " << policy.nbThreads() << " threads: " << t_par << " ms"
+               << " (x" << t_scalar / t_par << ")" << std::endl;
+  trace.endBlock();
+  return s_scalar == s_batch && s_batch == s_par;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class CorrectedNormalCurrentComputer" );
+  std::vector< std::size_t > sizes = { 200, 1000 };
+  if ( argc > 1 ) sizes = { (std::size_t) atoi( argv[ 1 ] ) };
+  const std::size_t  n = argc > 2 ? atoi( argv[ 2 ] ) : 0;
+  const unsigned int t = argc > 3 ? atoi( argv[ 3 ] ) : 0;
+  bool res = true;
+  for ( auto m : sizes )
+    res = benchmarkCorrectedNormalCurrentComputer( m, n > 0 ? n : m, t ) && res;
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
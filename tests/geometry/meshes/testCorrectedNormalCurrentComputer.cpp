@@ -32,9 +32,11 @@
 #include <vector>
 #include <algorithm>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelPolicy.h"
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/shapes/SurfaceMesh.h"
 #include "DGtal/shapes/SurfaceMeshHelper.h"
+#include "DGtal/shapes/SurfaceMeshSpatialIndex.h"
 #include "DGtal/geometry/meshes/CorrectedNormalCurrentComputer.h"
 #include "DGtalCatch.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -326,5 +328,147 @@ SCENARIO( "CorrectedNormalCurrentComputer CCNC convergence tests", "[ccnc][conve
   }
 }
 
+SCENARIO( "CorrectedNormalCurrentComputer batched measures tests", "[icnc][batch]" )
+{
+  using namespace Z3i;
+  typedef SurfaceMesh< RealPoint, RealVector >       SM;
+  typedef SurfaceMeshHelper< RealPoint, RealVector > SMH;
+  typedef CorrectedNormalCurrentComputer< RealPoint, RealVector > CNCComputer;
+  typedef SurfaceMeshMeasure< RealPoint, RealVector, double > ScalarMeasure;
+  typedef SurfaceMeshSpatialIndex< RealPoint, RealVector > SpatialIndex;
+
+  SM torus = SMH::makeTorus( 3.0, 1.0, RealPoint { 0.0, 0.0, 0.0 }, 30, 20, 0,
+                             SMH::NormalsType::VERTEX_NORMALS );
+  CNCComputer cnc_computer( torus, false );
+  auto mu1 = cnc_computer.computeMu1();
+  // A measure on all cells, which counts the cells in balls.
+  ScalarMeasure count( torus, 0.0 );
+  count.kMeasures( 0 ).assign( torus.nbVertices(), 1.0 );
+  count.kMeasures( 1 ).assign( torus.nbEdges(),    1.0 );
+  count.kMeasures( 2 ).assign( torus.nbFaces(),    1.0 );
+  const SpatialIndex index( torus );
+  GIVEN( "A torus with 30x20x2 triangles and balls of radius 0.5" ) {
+    const double r = 0.5;
+    std::vector< double > ref_f_mu1, ref_f_count, ref_v_mu1, ref_v_count;
+    for ( SM::Face f = 0; f < torus.nbFaces(); ++f )
+      {
+        const auto b = torus.faceCentroid( f );
+        ref_f_mu1  .push_back( mu1  .measure( b, r, f ) );
+        ref_f_count.push_back( count.measure( b, r, f ) );
+      }
+    for ( SM::Vertex v = 0; v < torus.nbVertices(); ++v )
+      {
+        const auto x = torus.position( v );
+        const auto f = torus.incidentFaces( v ).front();
+        ref_v_mu1  .push_back( mu1  .measure( x, r, f ) );
+        ref_v_count.push_back( count.measure( x, r, f ) );
+      }
+    THEN( "Batched measures are the same as ball measures, whatever the number of threads" ) {
+      for ( auto policy : { ParallelPolicy::sequential(), ParallelPolicy::threads( 3 ) } )
+        {
+          REQUIRE( mu1  .faceMeasures  ( r, policy ) == ref_f_mu1   );
+          REQUIRE( count.faceMeasures  ( r, policy ) == ref_f_count );
+          REQUIRE( mu1  .vertexMeasures( r, policy ) == ref_v_mu1   );
+          REQUIRE( count.vertexMeasures( r, policy ) == ref_v_count );
+        }
+    }
+    THEN( "Batched measures with a spatial index are the same up to rounding" ) {
+      REQUIRE( index.isValid() );
+      const auto f_mu1   = mu1  .faceMeasures  ( r, ParallelPolicy::threads( 2 ), &index );
+      const auto f_count = count.faceMeasures  ( r, ParallelPolicy::threads( 2 ), &index );
+      const auto v_mu1   = mu1  .vertexMeasures( r, ParallelPolicy::sequential(), &index );
+      const auto v_count = count.vertexMeasures( r, ParallelPolicy::sequential(), &index );
+      std::size_t nb_bad = 0;
+      for ( SM::Face f = 0; f < torus.nbFaces(); ++f )
+        {
+          nb_bad += ( f_mu1  [ f ] == Approx( ref_f_mu1  [ f ] ) ) ? 0 : 1;
+          nb_bad += ( f_count[ f ] == Approx( ref_f_count[ f ] ) ) ? 0 : 1;
+        }
+      for ( SM::Vertex v = 0; v < torus.nbVertices(); ++v )
+        {
+          nb_bad += ( v_mu1  [ v ] == Approx( ref_v_mu1  [ v ] ) ) ? 0 : 1;
+          nb_bad += ( v_count[ v ] == Approx( ref_v_count[ v ] ) ) ? 0 : 1;
+        }
+      REQUIRE( nb_bad == 0 );
+    }
+    THEN( "The spatial index can be reused for other radii" ) {
+      for ( double r2 : { 0.0, 0.2, 1.0 } )
+        {
+          const auto f_mu1 = mu1.faceMeasures( r2, ParallelPolicy::sequential(), &index );
+          const auto ref   = mu1.faceMeasures( r2 );
+          std::size_t nb_bad = 0;
+          for ( SM::Face f = 0; f < torus.nbFaces(); ++f )
+            nb_bad += ( f_mu1[ f ] == Approx( ref[ f ] ) ) ? 0 : 1;
+          REQUIRE( nb_bad == 0 );
+        }
+    }
+  }
+}
+
+
+SCENARIO( "CorrectedNormalCurrentComputer triangle batch tests", "[icnc][batch]" )
+{
+  using namespace Z3i;
+  typedef SurfaceMesh< RealPoint, RealVector >       SM;
+  typedef SurfaceMeshHelper< RealPoint, RealVector > SMH;
+  typedef CorrectedNormalCurrentComputer< RealPoint, RealVector > CNCComputer;
+  typedef CNCComputer::Formula                       Formula;
+  typedef CNCComputer::RealTensor                    RealTensor;
+
+  // A torus made of triangles, with one quad added, and noisy normals.
+  SM torus = SMH::makeTorus( 3.0, 1.0, RealPoint { 0.0, 0.0, 0.0 }, 40, 30, 1,
+                             SMH::NormalsType::VERTEX_NORMALS );
+  std::vector< RealPoint >  X = torus.positions();
+  std::vector< SM::Vertices > faces = torus.allIncidentVertices();
+  X.push_back( RealPoint( 5.0, 0.0, 0.0 ) ); X.push_back( RealPoint( 6.0, 0.0, 0.0 ) );
+  X.push_back( RealPoint( 6.0, 1.0, 0.2 ) ); X.push_back( RealPoint( 5.0, 1.0, 0.0 ) );
+  const SM::Vertex q = torus.nbVertices();
+  faces.push_back( { q, q+1, q+2, q+3 } );
+  SM mesh( X.cbegin(), X.cend(), faces.cbegin(), faces.cend() );
+  std::vector< RealVector > U = torus.vertexNormals();
+  for ( int i = 0; i < 4; ++i ) U.push_back( RealVector( 0.0, 0.1 * i, 1.0 ).getNormalized() );
+  for ( std::size_t i = 0; i < U.size(); ++i )
+    U[ i ] = ( U[ i ] + 0.1 * RealVector( cos( 7.0 * i ), sin( 3.0 * i ), 0.0 ) ).getNormalized();
+  mesh.setVertexNormals( U.cbegin(), U.cend() );
+  GIVEN( "A mesh with 40x30x2 triangles and one quad" ) {
+    for ( bool unit_u : { false, true } )
+      {
+        // Per face formulas.
+        std::vector< double > ref_mu0, ref_mu1, ref_mu2;
+        std::vector< RealTensor > ref_muXY;
+        for ( SM::Face f = 0; f < mesh.nbFaces(); ++f )
+          {
+            std::vector< RealPoint >  p;
+            std::vector< RealVector > u;
+            for ( auto v : mesh.incidentVertices( f ) )
+              {
+                p.push_back( X[ v ] );
+                u.push_back( U[ v ] );
+              }
+            ref_mu0 .push_back( Formula::mu0InterpolatedU ( p, u, unit_u ) );
+            ref_mu1 .push_back( Formula::mu1InterpolatedU ( p, u, unit_u ) );
+            ref_mu2 .push_back( Formula::mu2InterpolatedU ( p, u, unit_u ) );
+            ref_muXY.push_back( Formula::muXYInterpolatedU( p, u, unit_u ) );
+          }
+        CNCComputer cnc_computer( mesh, unit_u );
+        THEN( "Batched measures are the same as per face measures, whatever the number of threads (unit_u="
+              + std::to_string( unit_u ) + ")" ) {
+          for ( auto policy : { ParallelPolicy::sequential(), ParallelPolicy::threads( 3 ) } )
+            {
+              REQUIRE( cnc_computer.computeMu0( policy ).kMeasures( 2 ) == ref_mu0 );
+              REQUIRE( cnc_computer.computeMu1( policy ).kMeasures( 2 ) == ref_mu1 );
+              REQUIRE( cnc_computer.computeMu2( policy ).kMeasures( 2 ) == ref_mu2 );
+              const auto muXY = cnc_computer.computeMuXY( policy ).kMeasures( 2 );
+              REQUIRE( muXY.size() == ref_muXY.size() );
+              std::size_t nb_bad = 0;
+              for ( SM::Face f = 0; f < mesh.nbFaces(); ++f )
+                nb_bad += muXY[ f ] == ref_muXY[ f ] ? 0 : 1;
+              REQUIRE( nb_bad == 0 );
+            }
+        }
+      }
+  }
+}
+
 //                                                                           //
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,136 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalSurfaceFFTConvolver-benchmark.cpp
+ * @ingroup Tests
+ * @date 2026/10/17
+ *
+ * Benchmark of the integral invariant estimators on all the surfels of
+ * a shape, with the incremental convolutions of DigitalSurfaceConvolver
+ * and the Fast Fourier Transforms of DigitalSurfaceFFTConvolver:
+ * timings and differences of the results.
+ *
+ * Usage: testDigitalSurfaceFFTConvolver-benchmark [gridstep] [radius...]
+ * (default gridstep 0.25, digital radii 4 8 16).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantVolumeEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantCovarianceEstimator.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Shortcuts<Z3i::KSpace> SH3;
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Evaluates an estimator on all surfels with the given method.
+ * @return the time in ms.
+ */
+template < typename TEstimator, typename TSurfels >
+double evalWith( TEstimator & estimator, const TSurfels & surfels, IIConvolutionMethod method,
+                 std::vector<typename TEstimator::Quantity> & results )
+{
+  results.clear();
+  estimator.setConvolutionMethod( method );
+  trace.beginBlock( method == IIConvolutionMethod::FFT ? "FFT convolutions" : "Incremental convolutions" );
+  estimator.eval( surfels.begin(), surfels.end(), std::back_inserter( results ) );
+  return trace.endBlock();
+}
+
+int main( int argc, char** argv )
+{
+  typedef functors::IIMeanCurvature3DFunctor<Z3i::Space> MeanFunctor;
+  typedef functors::IIPrincipalCurvatures3DFunctor<Z3i::Space> PrincipalFunctor;
+  typedef IntegralInvariantVolumeEstimator<Z3i::KSpace, SH3::BinaryImage, MeanFunctor> MeanEstimator;
+  typedef IntegralInvariantCovarianceEstimator<Z3i::KSpace, SH3::BinaryImage, PrincipalFunctor> PrincipalEstimator;
+
+  trace.beginBlock ( "Benchmarking FFT integral invariant convolutions" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const double h = ( argc > 1 ) ? std::stod( argv[ 1 ] ) : 0.25;
+  std::vector<double> radii;
+  for ( int i = 2; i < argc; ++i )
+    radii.push_back( std::stod( argv[ i ] ) );
+  if ( radii.empty() )
+    radii = { 4.0, 8.0, 16.0 };
+
+  auto params = SH3::defaultParameters();
+  params( "polynomial", "goursat" )( "gridstep", h )( "verbose", 0 );
+  auto implicit_shape  = SH3::makeImplicitShape3D( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeLightDigitalSurface( binary_image, K, params );
+  auto surfels         = SH3::getSurfelRange( surface, params );
+  trace.info() << "Nb surfels= " << surfels.size() << std::endl;
+
+  for ( double r : radii )
+    {
+      trace.beginBlock( "Digital radius " + std::to_string( r ) );
+
+      MeanEstimator meanEstimator;
+      meanEstimator.attach( K, *binary_image );
+      meanEstimator.setParams( r );
+      meanEstimator.init( h, surfels.begin(), surfels.end() );
+      std::vector<double> H, Hfft;
+      const double tH = evalWith( meanEstimator, surfels, IIConvolutionMethod::INCREMENTAL, H );
+      const double tHfft = evalWith( meanEstimator, surfels, IIConvolutionMethod::FFT, Hfft );
+      double maxDiffH = 0.0;
+      for ( std::size_t i = 0; i < H.size(); ++i )
+        maxDiffH = std::max( maxDiffH, std::abs( H[ i ] - Hfft[ i ] ) );
+
+      PrincipalEstimator principalEstimator;
+      principalEstimator.attach( K, *binary_image );
+      principalEstimator.setParams( r );
+      principalEstimator.init( h, surfels.begin(), surfels.end() );
+      std::vector<PrincipalFunctor::Quantity> k, kfft;
+      const double tk = evalWith( principalEstimator, surfels, IIConvolutionMethod::INCREMENTAL, k );
+      const double tkfft = evalWith( principalEstimator, surfels, IIConvolutionMethod::FFT, kfft );
+      double maxDiffk = 0.0;
+      for ( std::size_t i = 0; i < k.size(); ++i )
+        maxDiffk = std::max( { maxDiffk, std::abs( k[ i ].first - kfft[ i ].first ),
+                               std::abs( k[ i ].second - kfft[ i ].second ) } );
+
+      trace.info() << "r=" << r << " mean curvature: incremental " << tH << " ms, FFT " << tHfft
+                   << " ms (speedup " << tH / tHfft << "), max difference " << maxDiffH << std::endl;
+      trace.info() << "r=" << r << " principal curvatures: incremental " << tk << " ms, FFT " << tkfft
+                   << " ms (speedup " << tk / tkfft << "), max difference " << maxDiffk << std::endl;
+      trace.endBlock();
+    }
+
+  trace.endBlock();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
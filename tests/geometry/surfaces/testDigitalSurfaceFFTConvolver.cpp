@@ -0,0 +1,213 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class DigitalSurfaceFFTConvolver, through the
+ * integral invariant estimators.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/topology/LightImplicitDigitalSurface.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantVolumeEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantCovarianceEstimator.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Shortcuts<Z3i::KSpace> SH3;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DigitalSurfaceFFTConvolver.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Returns the volume itself.
+struct VolumeIdentity
+{
+  typedef double Argument;
+  typedef double Quantity;
+  void init( double, double ) {}
+  Quantity operator()( const Argument & v ) const { return v; }
+};
+
+/// Returns the covariance matrix itself.
+template < Dimension dim >
+struct CovarianceIdentity
+{
+  typedef SimpleMatrix<double, dim, dim> Argument;
+  typedef Argument Quantity;
+  void init( double, double ) {}
+  Quantity operator()( const Argument & m ) const { return m; }
+};
+
+/**
+ * Evaluates an estimator on a range of surfels with both convolution
+ * methods.
+ */
+template < typename TEstimator, typename TSurfelIterator >
+std::pair< std::vector<typename TEstimator::Quantity>, std::vector<typename TEstimator::Quantity> >
+evalBothMethods( TEstimator & estimator, TSurfelIterator itb, TSurfelIterator ite )
+{
+  std::vector<typename TEstimator::Quantity> incremental, fft;
+  estimator.setConvolutionMethod( IIConvolutionMethod::INCREMENTAL );
+  estimator.eval( itb, ite, std::back_inserter( incremental ) );
+  estimator.setConvolutionMethod( IIConvolutionMethod::FFT );
+  estimator.eval( itb, ite, std::back_inserter( fft ) );
+  return std::make_pair( incremental, fft );
+}
+
+template < typename TMatrix >
+double maxDifference( const std::vector<TMatrix> & a, const std::vector<TMatrix> & b )
+{
+  double diff = 0.0;
+  for ( std::size_t i = 0; i < a.size(); ++i )
+    for ( DGtal::Dimension r = 0; r < TMatrix::M; ++r )
+      for ( DGtal::Dimension c = 0; c < TMatrix::N; ++c )
+        diff = std::max( diff, std::abs( a[ i ]( r, c ) - b[ i ]( r, c ) ) );
+  return diff;
+}
+
+TEST_CASE( "Testing DigitalSurfaceFFTConvolver in 3D" )
+{
+  auto params = SH3::defaultParameters();
+  params( "polynomial", "goursat" )( "gridstep", 0.5 )( "verbose", 0 );
+  auto implicit_shape  = SH3::makeImplicitShape3D( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeLightDigitalSurface( binary_image, K, params );
+  auto surfels         = SH3::getSurfelRange( surface, params );
+  typedef SH3::BinaryImage Shape;
+
+  SECTION( "Same volumes as DigitalSurfaceConvolver" )
+    {
+      for ( double r : { 3.0, 5.5 } )
+        {
+          IntegralInvariantVolumeEstimator<Z3i::KSpace, Shape, VolumeIdentity> estimator;
+          estimator.attach( K, *binary_image );
+          estimator.setParams( r );
+          estimator.init( 0.5, surfels.begin(), surfels.end() );
+          auto results = evalBothMethods( estimator, surfels.begin(), surfels.end() );
+          CAPTURE( r );
+          REQUIRE( results.first.size() == surfels.size() );
+          REQUIRE( results.first == results.second );
+        }
+    }
+
+  SECTION( "Same volumes on a part of the surface" )
+    {
+      IntegralInvariantVolumeEstimator<Z3i::KSpace, Shape, VolumeIdentity> estimator;
+      estimator.attach( K, *binary_image );
+      estimator.setParams( 4.0 );
+      estimator.init( 0.5, surfels.begin(), surfels.end() );
+      auto results = evalBothMethods( estimator, surfels.begin() + 10, surfels.begin() + 110 );
+      REQUIRE( results.second.size() == 100 );
+      REQUIRE( results.first == results.second );
+    }
+
+  SECTION( "FFT method selected before init" )
+    {
+      IntegralInvariantVolumeEstimator<Z3i::KSpace, Shape, VolumeIdentity> estimator;
+      estimator.attach( K, *binary_image );
+      estimator.setParams( 4.0 );
+      estimator.setConvolutionMethod( IIConvolutionMethod::FFT );
+      estimator.init( 0.5, surfels.begin(), surfels.end() );
+      std::vector<double> fft;
+      estimator.eval( surfels.begin(), surfels.end(), std::back_inserter( fft ) );
+      auto results = evalBothMethods( estimator, surfels.begin(), surfels.end() );
+      REQUIRE( results.first == fft );
+    }
+
+  SECTION( "Same covariance matrices as DigitalSurfaceConvolver" )
+    {
+      IntegralInvariantCovarianceEstimator<Z3i::KSpace, Shape, CovarianceIdentity<3> > estimator;
+      estimator.attach( K, *binary_image );
+      estimator.setParams( 4.0 );
+      estimator.init( 0.5, surfels.begin(), surfels.end() );
+      auto results = evalBothMethods( estimator, surfels.begin(), surfels.end() );
+      REQUIRE( results.second.size() == surfels.size() );
+      REQUIRE( maxDifference( results.first, results.second ) < 1e-6 );
+    }
+
+  SECTION( "Same curvatures as DigitalSurfaceConvolver" )
+    {
+      typedef functors::IIGaussianCurvature3DFunctor<Z3i::Space> Functor;
+      Functor functor;
+      IntegralInvariantCovarianceEstimator<Z3i::KSpace, Shape, Functor> estimator( functor );
+      estimator.attach( K, *binary_image );
+      estimator.setParams( 4.0 );
+      estimator.init( 0.5, surfels.begin(), surfels.end() );
+      auto results = evalBothMethods( estimator, surfels.begin(), surfels.end() );
+      REQUIRE( estimator.convolutionMethod() == IIConvolutionMethod::FFT );
+      for ( std::size_t i = 0; i < surfels.size(); ++i )
+        REQUIRE( results.second[ i ] == Approx( results.first[ i ] ).margin( 1e-8 ) );
+    }
+}
+
+TEST_CASE( "Testing DigitalSurfaceFFTConvolver in 2D" )
+{
+  typedef ImplicitBall<Z2i::Space> ImplicitShape;
+  typedef GaussDigitizer<Z2i::Space, ImplicitShape> DigitalShape;
+  typedef LightImplicitDigitalSurface<Z2i::KSpace, DigitalShape> Boundary;
+  typedef DigitalSurface<Boundary> MyDigitalSurface;
+
+  const double h = 0.25;
+  ImplicitShape ishape( Z2i::RealPoint( 0.3, -0.2 ), 8.0 );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( Z2i::RealPoint( -10.0, -10.0 ), Z2i::RealPoint( 10.0, 10.0 ), h );
+  Z2i::KSpace K;
+  REQUIRE( K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) );
+  Z2i::KSpace::Surfel bel = Surfaces<Z2i::KSpace>::findABel( K, dshape, 10000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<Z2i::KSpace::dimension>( true ), bel );
+  MyDigitalSurface surface( boundary );
+  std::vector<Z2i::SCell> surfels( surface.begin(), surface.end() );
+
+  IntegralInvariantVolumeEstimator<Z2i::KSpace, DigitalShape, VolumeIdentity> volumeEstimator;
+  volumeEstimator.attach( K, dshape );
+  volumeEstimator.setParams( 10.0 );
+  volumeEstimator.init( h, surfels.begin(), surfels.end() );
+  auto volumes = evalBothMethods( volumeEstimator, surfels.begin(), surfels.end() );
+  REQUIRE( volumes.first == volumes.second );
+
+  IntegralInvariantCovarianceEstimator<Z2i::KSpace, DigitalShape, CovarianceIdentity<2> > covarianceEstimator;
+  covarianceEstimator.attach( K, dshape );
+  covarianceEstimator.setParams( 10.0 );
+  covarianceEstimator.init( h, surfels.begin(), surfels.end() );
+  auto matrices = evalBothMethods( covarianceEstimator, surfels.begin(), surfels.end() );
+  REQUIRE( maxDifference( matrices.first, matrices.second ) < 1e-6 );
+}
+
+/** @ingroup Tests **/
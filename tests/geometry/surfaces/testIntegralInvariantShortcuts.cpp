@@ -86,4 +86,39 @@ TEST_CASE( "Testing IntegralInvariant Shortcuts API" )
   }
 }
 
+TEST_CASE( "Testing multithreaded IntegralInvariant Shortcuts" )
+{
+  auto params = SH3::defaultParameters() | SHG3::defaultParameters() |  SHG3::parametersGeometryEstimation();
+  params( "polynomial", "goursat" )( "gridstep", 1. )( "verbose", 0 )( "r-radius", 3.0 );
+  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeLightDigitalSurface( binary_image, K, params );
+  auto surfels         = SH3::getSurfelRange( surface, params );
+
+  params( "threads", 1 );
+  auto N1 = SHG3::getIINormalVectors( binary_image, surfels, params );
+  auto H1 = SHG3::getIIMeanCurvatures( binary_image, surfels, params );
+  auto G1 = SHG3::getIIGaussianCurvatures( binary_image, surfels, params );
+  auto T1 = SHG3::getIIPrincipalCurvaturesAndDirections( binary_image, surfels, params );
+
+  SECTION( "Same estimations, in the same order, with several threads" )
+    {
+      for ( int threads : { 3, 0 } )
+        {
+          params( "threads", threads );
+          CAPTURE( threads );
+          auto N = SHG3::getIINormalVectors( binary_image, surfels, params );
+          auto H = SHG3::getIIMeanCurvatures( binary_image, surfels, params );
+          auto G = SHG3::getIIGaussianCurvatures( binary_image, surfels, params );
+          auto T = SHG3::getIIPrincipalCurvaturesAndDirections( binary_image, surfels, params );
+          REQUIRE( N == N1 );
+          REQUIRE( H == H1 );
+          REQUIRE( G == G1 );
+          REQUIRE( T == T1 );
+        }
+    }
+}
+
 /** @ingroup Tests **/
@@ -29,6 +29,7 @@
 #include <iostream>
 #include <cstdlib>
 #include <ctime>
+#include <vector>
 
 #include "DGtal/base/Common.h"
 
@@ -43,6 +44,7 @@
 #include "DGtal/geometry/tools/determinant/COrientationFunctor2.h"
 #include "DGtal/geometry/tools/determinant/InHalfPlaneBy2x2DetComputer.h"
 #include "DGtal/geometry/tools/determinant/InHalfPlaneBySimple3x3Matrix.h"
+#include "DGtal/geometry/tools/determinant/FilteredBatchPredicates2D.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -912,6 +914,208 @@ bool randomTest62All()
   return true; 
 }
 
+/**
+ * @return a range of @a n points (P and Q excepted), which are
+ * random, collinear with P=(0,0) and Q (@a kind = 1), or
+ * quasi-collinear with P and Q (@a kind = 2), and whose coordinates
+ * are chosen by @a gen.
+ * @param P,Q (returns) the two points of the orientation tests
+ * @param gen a generator providing random numbers
+ * @param kind the kind of points
+ * @param n the number of points
+ */
+template<typename Point, typename RandomFunctor>
+std::vector<Point> rangeOfPoints(Point& P, Point& Q, RandomFunctor gen, int kind,
+                                 const DGtal::int32_t n = 1000000)
+{
+  std::vector<Point> R( n );
+  P = Point(0,0);
+  Q = Point( gen(), gen() );
+  const Point u( gen(), gen() );
+  if ( kind != 0 ) Q = u * gen();
+  for (DGtal::int32_t i = 0; (i < n); ++i)
+    {
+      if ( kind == 0 )
+        R[ i ] = Point( gen(), gen() );
+      else
+        R[ i ] = u * gen();
+      if ( kind == 2 )
+        R[ i ] += Point( (rand()%5)-2, (rand()%5)-2 );
+    }
+  return R;
+}
+
+/**
+ * Function that traces to the standard output the running time of a
+ * given orientation functor @a f computing the orientation of each
+ * point of @a R wrt @a P and @a Q, one point at a time.
+ * @param f a functor to run
+ * @param P,Q the two first points of the orientation tests
+ * @param R the range of third points
+ * @tparam OrientationFunctor a model of COrientationFunctor2
+ */
+template<typename OrientationFunctor, typename Point>
+bool rangeTest(OrientationFunctor f, const Point& P, const Point& Q,
+               const std::vector<Point>& R)
+{
+  BOOST_CONCEPT_ASSERT((  DGtal::concepts::COrientationFunctor2<OrientationFunctor> )); 
+
+  std::vector<typename OrientationFunctor::Value> signs( R.size() );
+
+  clock_t timeBegin, timeEnd;
+  timeBegin = clock();
+
+  f.init(P, Q);
+  for (std::size_t i = 0; (i < R.size()); ++i)
+    signs[ i ] = f( R[ i ] );
+
+  timeEnd = clock();
+  long double time, CPUTime;
+  time = ((double)timeEnd-(double)timeBegin); 
+  CPUTime = time/((double)CLOCKS_PER_SEC);  
+  std::cout << CPUTime << " "; 
+
+  return true; 
+}
+
+/**
+ * Function that traces to the standard output the running time of
+ * FilteredBatchPredicates2D::orientations for the orientation of
+ * the whole range @a R wrt @a P and @a Q.
+ * @param f a batch predicate to run
+ * @param P,Q the two first points of the orientation tests
+ * @param R the range of third points
+ * @tparam BatchPredicates an instance of FilteredBatchPredicates2D
+ */
+template<typename BatchPredicates, typename Point>
+bool batchTest(BatchPredicates f, const Point& P, const Point& Q,
+               const std::vector<Point>& R)
+{
+  std::vector<typename BatchPredicates::Value> signs( R.size() );
+
+  clock_t timeBegin, timeEnd;
+  timeBegin = clock();
+
+  f.init(P, Q);
+  f.orientations( R.cbegin(), R.cend(), signs.begin() );
+
+  timeEnd = clock();
+  long double time, CPUTime;
+  time = ((double)timeEnd-(double)timeBegin); 
+  CPUTime = time/((double)CLOCKS_PER_SEC);  
+  std::cout << CPUTime << " (" << ( 100.0 * f.nbExact() / R.size() ) << "% exact) "; 
+
+  return true; 
+}
+
+/**
+ * Function that traces to the standard output the running time of
+ * in-circle tests of the points of @a D wrt a circle, one point at a
+ * time (with exact integers or filtered) and by ranges.
+ * @param D the range of tested points
+ * @tparam Integer the type of integers for exact computations
+ */
+template<typename Integer, typename Point>
+bool inCircleTest(const std::vector<Point>& D)
+{
+  typedef FilteredBatchPredicates2D<Point, Integer> F; 
+  const Point A( D[0] ), B( D[1] ), C( D[2] );
+  std::vector<typename F::Value> signs( D.size() );
+  clock_t timeBegin;
+  long double CPUTime;
+
+  timeBegin = clock();
+  for (std::size_t i = 0; (i < D.size()); ++i)
+    {
+      const Integer adx = Integer( A[0] ) - Integer( D[i][0] );
+      const Integer ady = Integer( A[1] ) - Integer( D[i][1] );
+      const Integer bdx = Integer( B[0] ) - Integer( D[i][0] );
+      const Integer bdy = Integer( B[1] ) - Integer( D[i][1] );
+      const Integer cdx = Integer( C[0] ) - Integer( D[i][0] );
+      const Integer cdy = Integer( C[1] ) - Integer( D[i][1] );
+      const Integer det = ( adx * adx + ady * ady ) * ( bdx * cdy - cdx * bdy )
+        + ( bdx * bdx + bdy * bdy ) * ( cdx * ady - adx * cdy )
+        + ( cdx * cdx + cdy * cdy ) * ( adx * bdy - bdx * ady );
+      signs[ i ] = det > 0 ? 1 : ( det < 0 ? -1 : 0 );
+    }
+  CPUTime = ((double)clock()-(double)timeBegin)/((double)CLOCKS_PER_SEC);  
+  std::cout << CPUTime << " "; 
+
+  F f;
+  f.initCircle( A, B, C );
+  timeBegin = clock();
+  for (std::size_t i = 0; (i < D.size()); ++i)
+    signs[ i ] = f.inCircle( D[ i ] );
+  CPUTime = ((double)clock()-(double)timeBegin)/((double)CLOCKS_PER_SEC);  
+  std::cout << CPUTime << " "; 
+
+  f.resetStatistics();
+  timeBegin = clock();
+  f.inCircles( D.cbegin(), D.cend(), signs.begin() );
+  CPUTime = ((double)clock()-(double)timeBegin)/((double)CLOCKS_PER_SEC);  
+  std::cout << CPUTime << " (" << ( 100.0 * f.nbExact() / D.size() ) << "% exact) "; 
+
+  return true; 
+}
+
+/**
+ * Function that traces to the standard output the running time of
+ * orientation and in-circle tests evaluated one at a time or by
+ * ranges with FilteredBatchPredicates2D.
+ */
+bool batchTestAll()
+{
+  typedef PointVector<2, DGtal::int64_t> Point; 
+  std::cout << "# ranges of 1 million points, running times in s." << std::endl; 
+  std::cout << "# orientation: random integers within [-2^30 ; 2^30[, " 
+            << "(quasi-)collinear ones within [-2^15 ; 2^15[ " << std::endl; 
+  std::cout << "# columns: random, null, quasi-null " << std::endl; 
+
+  long seed = time(NULL); 
+  srand(seed); 
+  std::vector<Point> P( 3 ), Q( 3 );
+  const std::vector< std::vector<Point> > R = 
+    { rangeOfPoints( P[0], Q[0], signedRandomInt30, 0 ),
+      rangeOfPoints( P[1], Q[1], signedRandomInt15, 1 ),
+      rangeOfPoints( P[2], Q[2], signedRandomInt15, 2 ) };
+
+  std::cout << "3x3-int64-int64 "; 
+  for ( int k = 0; k < 3; ++k )
+    rangeTest( InHalfPlaneBySimple3x3Matrix<Point, DGtal::int64_t>(), P[k], Q[k], R[k] );
+  std::cout << std::endl; 
+  std::cout << "2x2-avnaim++-int64-double "; 
+  typedef AvnaimEtAl2x2DetSignComputer<double> DetComputer; 
+  typedef Filtered2x2DetComputer<DetComputer> FDetComputer; 
+  for ( int k = 0; k < 3; ++k )
+    rangeTest( InHalfPlaneBy2x2DetComputer<Point, FDetComputer>(), P[k], Q[k], R[k] );
+  std::cout << std::endl; 
+  typedef FilteredBatchPredicates2D<Point, DGtal::int64_t> F; 
+  std::cout << "filtered-int64 "; 
+  for ( int k = 0; k < 3; ++k )
+    rangeTest( F(), P[k], Q[k], R[k] );
+  std::cout << std::endl; 
+  std::cout << "filtered-batch-int64 "; 
+  for ( int k = 0; k < 3; ++k )
+    batchTest( F(), P[k], Q[k], R[k] );
+  std::cout << std::endl; 
+
+  std::cout << "# in-circle: random integers within [-2^15 ; 2^15[ " << std::endl; 
+  std::cout << "# columns: exact, filtered, filtered-batch " << std::endl; 
+  std::vector<Point> D( 1000000 );
+  for ( auto& p : D ) p = Point( signedRandomInt15() / 4, signedRandomInt15() / 4 );
+  std::cout << "in-circle-int64 "; 
+  inCircleTest<DGtal::int64_t>( D );
+  std::cout << std::endl; 
+#ifdef WITH_BIGINTEGER
+  for ( auto& p : D ) p = Point( signedRandomInt30(), signedRandomInt30() );
+  std::cout << "in-circle-BigInt (within [-2^30 ; 2^30[) "; 
+  inCircleTest<DGtal::BigInteger>( D );
+  std::cout << std::endl; 
+#endif
+
+  return true; 
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -927,6 +1131,7 @@ int main( int argc, char** argv )
   randomTest30All(); 
   randomTest52All(); 
   randomTest62All(); 
+  batchTestAll(); 
 
   bool res = true; 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -40,6 +40,8 @@
 #include "DGtal/geometry/tools/determinant/InHalfPlaneBySimple3x3Matrix.h"
 
 #include "DGtal/geometry/tools/determinant/InGeneralizedDiskOfGivenRadius.h"
+#include "DGtal/geometry/tools/determinant/FilteredBatchPredicates2D.h"
+#include "DGtal/geometry/tools/MelkmanConvexHull.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -264,6 +266,106 @@ bool testInGeneralizedDiskOfGivenRadius()
   
   return nbok == nb;
 }
+/**
+ * Checks the orientation and in-circle tests of
+ * FilteredBatchPredicates2D, one at a time and by ranges, against
+ * direct computations with 64 bits integers, on random, collinear and
+ * cocircular points.
+ */
+bool testFilteredBatchPredicates2D()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing FilteredBatchPredicates2D ..." );
+  typedef PointVector<2, DGtal::int64_t> Point;
+  typedef FilteredBatchPredicates2D<Point, DGtal::int64_t> Predicates;
+  typedef Predicates::Value Value;
+  const auto sign = [] ( DGtal::int64_t v ) -> Value
+    { return v > 0 ? 1 : ( v < 0 ? -1 : 0 ); };
+  const auto orient = [&] ( const Point& p, const Point& q, const Point& r )
+    { return sign( ( q[0]-p[0] ) * ( r[1]-p[1] ) - ( q[1]-p[1] ) * ( r[0]-p[0] ) ); };
+  const auto incircle = [&] ( const Point& a, const Point& b, const Point& c, const Point& d )
+    {
+      const Point A = a - d, B = b - d, C = c - d;
+      return sign( A.squaredNorm() * ( B[0]*C[1] - C[0]*B[1] )
+                   + B.squaredNorm() * ( C[0]*A[1] - A[0]*C[1] )
+                   + C.squaredNorm() * ( A[0]*B[1] - B[0]*A[1] ) );
+    };
+  // Random points, points on the line of P,Q and points on a circle.
+  const DGtal::int64_t K = 1 << 12;
+  std::vector<Point> R;
+  for ( int i = 0; i < 1000; ++i )
+    R.push_back( Point( rand() % ( 2*K ) - K, rand() % ( 2*K ) - K ) );
+  const Point P( -3, 1 ), Q( 7, 6 );
+  for ( int i = -100; i <= 100; ++i )
+    R.push_back( P + ( Q - P ) * i );
+  for ( DGtal::int64_t x = -65; x <= 65; ++x )
+    for ( DGtal::int64_t y = -65; y <= 65; ++y )
+      if ( x*x + y*y == 65*65 ) R.push_back( Point( x, y ) );
+
+  Predicates predicates;
+  predicates.init( P, Q );
+  std::vector<Value> signs;
+  predicates.orientations( R.cbegin(), R.cend(), std::back_inserter( signs ) );
+  bool ok_orientation = signs.size() == R.size();
+  for ( std::size_t i = 0; ok_orientation && i < R.size(); ++i )
+    ok_orientation = signs[ i ] == orient( P, Q, R[ i ] )
+      && predicates( R[ i ] ) == signs[ i ];
+  nbok += ok_orientation ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") orientations " << predicates << endl;
+
+  const Point A( 65, 0 ), B( 0, 65 ), C( -63, -16 );
+  predicates.initCircle( A, B, C );
+  signs.clear();
+  predicates.inCircles( R.cbegin(), R.cend(), std::back_inserter( signs ) );
+  bool ok_incircle = signs.size() == R.size();
+  for ( std::size_t i = 0; ok_incircle && i < R.size(); ++i )
+    ok_incircle = signs[ i ] == incircle( A, B, C, R[ i ] )
+      && predicates.inCircle( R[ i ] ) == signs[ i ];
+  nbok += ok_incircle ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") in-circles " << predicates << endl;
+
+  // Coordinates are small enough for the filter to decide even
+  // collinear and cocircular points.
+  nbok += ( predicates.nbFiltered() == 4 * R.size() && predicates.nbExact() == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") statistics" << endl;
+
+  // Quasi-collinear points with big coordinates require exact computations.
+  predicates.resetStatistics();
+  const Point U( 1 << 25, ( 1 << 25 ) - 1 );
+  predicates.init( Point( 0, 0 ), U * 3 );
+  const Point S[] = { U * 5, U * 7 + Point( 0, 1 ), U * 11 - Point( 0, 1 ) };
+  signs.clear();
+  predicates.orientations( S, S + 3, std::back_inserter( signs ) );
+  if ( signs == std::vector<Value>{ 0, 1, -1 } && predicates.nbExact() > 0 )
+    nbok++;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") quasi-collinear " << predicates << endl;
+
+  // Melkman convex hull of a simple polyline.
+  typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int64_t> RefFunctor;
+  MelkmanConvexHull<Point, Predicates> hull;
+  MelkmanConvexHull<Point, RefFunctor> ref_hull;
+  for ( int i = 0; i < 100; ++i )
+    {
+      const Point p( i, ( i * i ) % 37 );
+      hull.add( p );
+      ref_hull.add( p );
+    }
+  if ( std::equal( hull.begin(), hull.end(), ref_hull.begin(), ref_hull.end() ) )
+    nbok++;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") Melkman convex hull" << endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 int main( int argc, char** argv )
@@ -285,7 +387,11 @@ int main( int argc, char** argv )
   typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int32_t> Functor2; 
   res = res && testInHalfPlane( Functor2() );
 
+  typedef FilteredBatchPredicates2D<Point, DGtal::int32_t> Functor3; 
+  res = res && testInHalfPlane( Functor3() );
+
   res = res && testInGeneralizedDiskOfGivenRadius(); 
+  res = res && testFilteredBatchPredicates2D(); 
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
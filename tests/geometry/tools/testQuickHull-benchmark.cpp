@@ -0,0 +1,271 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testQuickHull-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmarks QuickHull on random lattice points in balls and in thin
+ * spherical shells, sequentially and with several threads, with
+ * native and (if available) BigInteger internal integers, as well as
+ * ConvexityHelper::computeLatticePolytope. It also measures the
+ * culling of interior points on dense lattice balls, and its
+ * end-to-end speedup on DigitalConvexity::makePolytope.
+ *
+ * Usage: testQuickHull-benchmark [nb_points [radius [nb_threads]]]
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/geometry/tools/QuickHull.h"
+#include "DGtal/geometry/volumes/ConvexityHelper.h"
+#include "DGtal/geometry/volumes/DigitalConvexity.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class QuickHull.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return \a nb random lattice points at distance between \a r and
+ * \a R from the origin.
+ */
+template <typename Point>
+std::vector< Point >
+randomPointsInShell( std::size_t nb, double r, double R )
+{
+  std::vector< Point > V;
+  const int iR = int( R );
+  while ( V.size() < nb )
+    {
+      Point p;
+      double n2 = 0.0;
+      for ( Dimension k = 0; k < Point::dimension; ++k )
+        {
+          p[ k ] = rand() % ( 2 * iR + 1 ) - iR;
+          n2    += double( p[ k ] ) * double( p[ k ] );
+        }
+      if ( r * r <= n2 && n2 <= R * R ) V.push_back( p );
+    }
+  return V;
+}
+
+/**
+ * Computes the convex hull of \a V sequentially and with \a
+ * nb_threads threads, and checks that the outputs are the same.
+ */
+template <typename Kernel, typename Point>
+bool benchmarkQuickHull( const std::string& name, const std::vector< Point >& V,
+                         unsigned int nb_threads )
+{
+  typedef QuickHull< Kernel > QHull;
+  typedef typename QHull::HalfSpace HalfSpace;
+  bool ok = true;
+  std::vector< HalfSpace > H_ref;
+  for ( auto policy : { ParallelPolicy::sequential(), ParallelPolicy::threads( nb_threads ) } )
+    {
+      QHull hull;
+      Clock c;
+      c.startClock();
+      srand( 0 );
+      hull.setInput( V, false );
+      hull.computeConvexHull( QHull::Status::VerticesCompleted, policy );
+      const double t = c.stopClock();
+      std::vector< HalfSpace > H;
+      hull.getFacetHalfSpaces( H );
+      trace.info() << name << " (" << policy.nbThreads() << " threads): " << t << " ms"
+                   << " #V=" << hull.nbVertices() << " #F=" << hull.nbFacets()
+                   << " [simplex " << hull.timings[ 1 ]
+                   << " facets " << hull.timings[ 2 ] << "]" << std::endl;
+      if ( H_ref.empty() ) H_ref = H;
+      else
+        {
+          bool same = H.size() == H_ref.size();
+          for ( std::size_t i = 0; same && i < H.size(); i++ )
+            same = hull.kernel.equal( H[ i ], H_ref[ i ] );
+          ok = ok && same;
+        }
+    }
+  return ok;
+}
+
+/**
+ * Benchmarks QuickHull on balls and shells of \a nb points in 3D and 4D.
+ */
+bool benchmarkQuickHulls( std::size_t nb, double R, unsigned int nb_threads )
+{
+  typedef SpaceND< 3, DGtal::int64_t > Space3;
+  typedef SpaceND< 4, DGtal::int64_t > Space4;
+  typedef Space3::Point Point3;
+  typedef Space4::Point Point4;
+  bool ok = true;
+  trace.beginBlock( "QuickHull of " + std::to_string( nb ) + " points" );
+  const auto B3 = randomPointsInShell< Point3 >( nb, 0.0, R );
+  const auto S3 = randomPointsInShell< Point3 >( nb, 0.95 * R, R );
+  const auto B4 = randomPointsInShell< Point4 >( nb / 4, 0.0, R / 4 );
+  ok = benchmarkQuickHull< ConvexHullIntegralKernel< 3 > >( "3D ball ", B3, nb_threads ) && ok;
+  ok = benchmarkQuickHull< ConvexHullIntegralKernel< 3 > >( "3D shell", S3, nb_threads ) && ok;
+  ok = benchmarkQuickHull< ConvexHullIntegralKernel< 4 > >( "4D ball ", B4, nb_threads ) && ok;
+#ifdef WITH_BIGINTEGER
+  typedef ConvexHullIntegralKernel< 3, DGtal::int64_t, BigInteger > BigKernel3;
+  const std::vector< Point3 > b3( B3.cbegin(), B3.cbegin() + B3.size() / 4 );
+  const std::vector< Point3 > s3( S3.cbegin(), S3.cbegin() + S3.size() / 4 );
+  ok = benchmarkQuickHull< BigKernel3 >( "3D ball  BigInteger", b3, nb_threads ) && ok;
+  ok = benchmarkQuickHull< BigKernel3 >( "3D shell BigInteger", s3, nb_threads ) && ok;
+#endif
+  trace.endBlock();
+  return ok;
+}
+
+/**
+ * Benchmarks ConvexityHelper::computeLatticePolytope on a ball of \a nb points.
+ */
+bool benchmarkLatticePolytope( std::size_t nb, double R, unsigned int nb_threads )
+{
+  typedef ConvexityHelper< 3, DGtal::int64_t > Helper;
+  typedef Helper::Point Point;
+  trace.beginBlock( "ConvexityHelper::computeLatticePolytope of " + std::to_string( nb ) + " points" );
+  const auto B = randomPointsInShell< Point >( nb, 0.0, R );
+  std::vector< std::size_t > nb_facets;
+  for ( auto policy : { ParallelPolicy::sequential(), ParallelPolicy::threads( nb_threads ) } )
+    {
+      Clock c;
+      c.startClock();
+      const auto P = Helper::computeLatticePolytope( B, false, false, true, policy );
+      const double t = c.stopClock();
+      trace.info() << "computeLatticePolytope (" << policy.nbThreads() << " threads): "
+                   << t << " ms #F=" << P.nbHalfSpaces() << std::endl;
+      nb_facets.push_back( P.nbHalfSpaces() );
+    }
+  trace.endBlock();
+  return nb_facets.front() == nb_facets.back();
+}
+
+/**
+ * @return all the lattice points at distance at most \a R from the origin.
+ */
+template <typename Point>
+std::vector< Point >
+latticeBall( double R )
+{
+  std::vector< Point > V;
+  const int iR = int( R );
+  Point p;
+  for ( p[ 0 ] = -iR; p[ 0 ] <= iR; p[ 0 ]++ )
+    for ( p[ 1 ] = -iR; p[ 1 ] <= iR; p[ 1 ]++ )
+      for ( p[ 2 ] = -iR; p[ 2 ] <= iR; p[ 2 ]++ )
+        if ( p.squaredNorm() <= R * R ) V.push_back( p );
+  return V;
+}
+
+/**
+ * Measures the culling of interior points on dense lattice balls and
+ * on random points, then the end-to-end speedup it gives to
+ * DigitalConvexity::makePolytope, for about \a nb points.
+ */
+bool benchmarkCulling( std::size_t nb, double R )
+{
+  typedef KhalimskySpaceND< 3, DGtal::int64_t > KSpace;
+  typedef KSpace::Point                         Point;
+  typedef ConvexityHelper< 3, DGtal::int64_t >  Helper;
+  typedef QuickHull< ConvexHullIntegralKernel< 3 > > QHull;
+  bool ok = true;
+  trace.beginBlock( "Culling of interior points" );
+  const double r = std::cbrt( 3.0 * double( nb ) / ( 4.0 * M_PI ) );
+  const std::vector< std::pair< std::string, std::vector< Point > > > inputs =
+    { { "dense ball   ", latticeBall< Point >( r ) },
+      { "random ball  ", randomPointsInShell< Point >( nb, 0.0, R ) },
+      { "random shell ", randomPointsInShell< Point >( nb, 0.95 * R, R ) } };
+  for ( const auto& input : inputs )
+    {
+      const auto& V = input.second;
+      std::vector< double > t( 2 );
+      std::vector< std::size_t > nb_facets( 2 );
+      for ( int cull = 0; cull < 2; cull++ )
+        {
+          QHull hull;
+          Clock c;
+          c.startClock();
+          hull.setInput( V, false );
+          if ( cull ) hull.cullInteriorPoints();
+          hull.computeConvexHull();
+          t[ cull ]         = c.stopClock();
+          nb_facets[ cull ] = hull.nbFacets();
+          if ( cull )
+            {
+              const auto& S = hull.culling_statistics;
+              trace.info() << input.first << "#P=" << S.nb_input_points
+                           << " culled=" << S.nbCulled()
+                           << " (rows " << S.nb_row_culled
+                           << " octahedron " << S.nb_octahedron_culled << ")"
+                           << " in " << S.time << " ms" << std::endl;
+            }
+        }
+      trace.info() << input.first << "QuickHull: " << t[ 0 ] << " ms, with culling "
+                   << t[ 1 ] << " ms, speedup x" << ( t[ 0 ] / t[ 1 ] ) << std::endl;
+      ok = ok && nb_facets[ 0 ] == nb_facets[ 1 ];
+    }
+  // DigitalConvexity::makePolytope culls interior points by default.
+  DigitalConvexity< KSpace > dconv( Point::diagonal( -R-1 ), Point::diagonal( R+1 ) );
+  for ( const auto& input : inputs )
+    {
+      const auto& X = input.second;
+      Clock c;
+      c.startClock();
+      const auto P0 = Helper::computeLatticePolytope( X, false, true, false );
+      const double t0 = c.stopClock();
+      c.startClock();
+      const auto P1 = dconv.makePolytope( X, true );
+      const double t1 = c.stopClock();
+      trace.info() << input.first << "makePolytope: " << t1 << " ms, without culling "
+                   << t0 << " ms, speedup x" << ( t0 / t1 ) << std::endl;
+      ok = ok && P0.nbHalfSpaces() == P1.nbHalfSpaces();
+    }
+  trace.endBlock();
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class QuickHull" );
+  const std::size_t  nb         = argc > 1 ? atol( argv[ 1 ] ) : 1000000;
+  const double       R          = argc > 2 ? atof( argv[ 2 ] ) : 1000.0;
+  const unsigned int nb_threads = argc > 3 ? atoi( argv[ 3 ] ) : 4;
+  bool res = benchmarkQuickHulls( nb, R, nb_threads );
+  res = benchmarkLatticePolytope( nb, R, nb_threads ) && res;
+  res = benchmarkCulling( nb, R ) && res;
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
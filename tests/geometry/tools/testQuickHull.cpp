@@ -187,6 +187,263 @@ SCENARIO( "QuickHull< ConvexHullIntegralKernel< 3 > > unit tests", "[quickhull][
   }
 }
 
+SCENARIO( "QuickHull< ConvexHullIntegralKernel< 3 > > parallel tests", "[quickhull][integral_kernel][3d][parallel]" )
+{
+  typedef ConvexHullIntegralKernel< 3 >    QHKernel;
+  typedef QuickHull< QHKernel >            QHull;
+  typedef SpaceND< 3, int >                Space;      
+  typedef Space::Point                     Point;
+  typedef QHull::HalfSpace                 HalfSpace;
+
+  const auto threads = ParallelPolicy::threads( 3 );
+  GIVEN( "Given 50000 random point in a ball of radius 100 " ) {
+    std::vector<Point> V = randomPointsInBall< Point >( 50000, 100 );
+    QHull hull1, hull3;
+    hull1.setInput( V, false );
+    hull3.setInput( V, false );
+    srand( 0 );
+    hull1.computeConvexHull( QHull::Status::VerticesCompleted, ParallelPolicy::sequential() );
+    srand( 0 );
+    hull3.computeConvexHull( QHull::Status::VerticesCompleted, threads );
+    std::vector< Point > P1, P3;
+    hull1.getVertexPositions( P1 );
+    hull3.getVertexPositions( P3 );
+    std::vector< HalfSpace > H1, H3;
+    hull1.getFacetHalfSpaces( H1 );
+    hull3.getFacetHalfSpaces( H3 );
+    THEN( "The convex hulls are valid and contain every point" ) {
+      REQUIRE( hull1.check() );
+      REQUIRE( hull3.check() );
+    }
+    THEN( "The sequential and parallel convex hulls are the same" ) {
+      REQUIRE( hull1.nbVertices() == hull3.nbVertices() );
+      REQUIRE( hull1.nbFacets()   == hull3.nbFacets() );
+      REQUIRE( P1 == P3 );
+      bool same_facets = H1.size() == H3.size();
+      for ( std::size_t i = 0; same_facets && i < H1.size(); i++ )
+        same_facets = hull1.kernel.equal( H1[ i ], H3[ i ] );
+      REQUIRE( same_facets );
+    }
+  }
+  GIVEN( "Given the 27000 lattice points of a cube" ) {
+    std::vector<Point> V;
+    for ( int x = 0; x < 30; x++ )
+      for ( int y = 0; y < 30; y++ )
+        for ( int z = 0; z < 30; z++ )
+          V.push_back( Point( x, y, z ) );
+    QHull hull;
+    hull.setInput( V, false );
+    hull.computeConvexHull( QHull::Status::VerticesCompleted, threads );
+    THEN( "The convex hull is valid and contains every point" ) {
+      REQUIRE( hull.check() );
+    }
+    THEN( "Its convex hull has 8 vertices and 6 facets" ) {
+      REQUIRE( hull.nbVertices() == 8 );
+      REQUIRE( hull.nbFacets()   == 6 );
+    }
+  }
+}
+
+SCENARIO( "QuickHull< ConvexHullIntegralKernel< 3 > > culling tests", "[quickhull][integral_kernel][3d][culling]" )
+{
+  typedef ConvexHullIntegralKernel< 3 >    QHKernel;
+  typedef QuickHull< QHKernel >            QHull;
+  typedef SpaceND< 3, int >                Space;
+  typedef Space::Point                     Point;
+  typedef QHull::HalfSpace                 HalfSpace;
+
+  // Normals of facets may differ by a positive factor.
+  const auto sameHalfSpace = [] ( const HalfSpace& H1, const HalfSpace& H2 )
+  {
+    const auto& N1 = H1.internalNormal();
+    const auto& N2 = H2.internalNormal();
+    bool same = N1.dot( N2 ) > 0;
+    for ( Dimension k = 0; same && k < 3; k++ )
+      same = H1.internalIntercept() * N2[ k ] == H2.internalIntercept() * N1[ k ]
+        && N1[ k ] * N2[ (k+1)%3 ] == N1[ (k+1)%3 ] * N2[ k ];
+    return same;
+  };
+  const auto compareHulls = [&] ( const std::vector< Point >& V, QHull& hull1, QHull& hull2 )
+  {
+    hull1.setInput( V, false );
+    hull2.setInput( V, false );
+    hull2.cullInteriorPoints();
+    hull1.computeConvexHull( QHull::Status::VerticesCompleted );
+    hull2.computeConvexHull( QHull::Status::VerticesCompleted );
+    std::vector< Point > P1, P2;
+    hull1.getVertexPositions( P1 );
+    hull2.getVertexPositions( P2 );
+    std::sort( P1.begin(), P1.end() );
+    std::sort( P2.begin(), P2.end() );
+    std::vector< HalfSpace > H1, H2;
+    hull1.getFacetHalfSpaces( H1 );
+    hull2.getFacetHalfSpaces( H2 );
+    bool same_facets = H1.size() == H2.size();
+    for ( std::size_t i = 0; same_facets && i < H1.size(); i++ )
+      same_facets = std::any_of( H2.cbegin(), H2.cend(), [&] ( const HalfSpace& H )
+                                 { return sameHalfSpace( H1[ i ], H ); } );
+    return same_facets && P1 == P2;
+  };
+  const auto nbUnassigned = [] ( const QHull& hull )
+  {
+    return std::count( hull.input2comp.cbegin(), hull.input2comp.cend(),
+                       QHull::Index( QHull::UNASSIGNED ) );
+  };
+  GIVEN( "Given the lattice points of a ball of radius 20" ) {
+    std::vector<Point> V;
+    for ( int x = -20; x <= 20; x++ )
+      for ( int y = -20; y <= 20; y++ )
+        for ( int z = -20; z <= 20; z++ )
+          if ( x*x + y*y + z*z <= 400 ) V.push_back( Point( x, y, z ) );
+    QHull hull1, hull2;
+    const bool same = compareHulls( V, hull1, hull2 );
+    const auto& S = hull2.culling_statistics;
+    THEN( "Most points are culled, first as interior to their rows" ) {
+      REQUIRE( S.nb_input_points == V.size() );
+      REQUIRE( S.nb_row_culled > 0 );
+      REQUIRE( 10 * hull2.points.size() < V.size() );
+      REQUIRE( S.nbCulled() + hull2.points.size() == V.size() );
+      REQUIRE( std::size_t( nbUnassigned( hull2 ) ) == S.nbCulled() );
+    }
+    THEN( "The convex hulls with and without culling are valid and the same" ) {
+      REQUIRE( hull1.check() );
+      REQUIRE( hull2.check() );
+      REQUIRE( same );
+    }
+  }
+  GIVEN( "Given 10000 random point in a ball of radius 100" ) {
+    std::vector<Point> V = randomPointsInBall< Point >( 10000, 100 );
+    QHull hull1, hull2;
+    const bool same = compareHulls( V, hull1, hull2 );
+    const auto& S = hull2.culling_statistics;
+    THEN( "Points are too sparse for row culling, but many are interior to the octahedron" ) {
+      REQUIRE( S.nb_row_culled == 0 );
+      REQUIRE( S.nb_octahedron_culled > 0 );
+      REQUIRE( std::size_t( nbUnassigned( hull2 ) ) == S.nbCulled() );
+    }
+    THEN( "The convex hulls with and without culling are valid and the same" ) {
+      REQUIRE( hull1.check() );
+      REQUIRE( hull2.check() );
+      REQUIRE( same );
+    }
+  }
+  GIVEN( "Given the lattice points of a flat rectangle" ) {
+    std::vector<Point> V;
+    for ( int x = 0; x < 20; x++ )
+      for ( int y = 0; y < 10; y++ )
+        V.push_back( Point( x, y, 3 ) );
+    QHull hull;
+    hull.setInput( V, false );
+    hull.cullInteriorPoints();
+    THEN( "Only row extremities are kept and it is not full dimensional" ) {
+      REQUIRE( hull.culling_statistics.nb_octahedron_culled == 0 );
+      REQUIRE( hull.points.size() == 20 );
+      REQUIRE( ! hull.computeConvexHull() );
+      REQUIRE( hull.status() == QHull::Status::NotFullDimensional );
+    }
+  }
+}
+
+#ifdef WITH_GMP
+SCENARIO( "QuickHull< ConvexHullIntegralKernel< 3, int64_t, BigInteger > > filtered heights tests", "[quickhull][integral_kernel][3d][filtered]" )
+{
+  typedef ConvexHullIntegralKernel< 3, DGtal::int64_t, DGtal::int64_t >     QHKernel;
+  typedef ConvexHullIntegralKernel< 3, DGtal::int64_t, DGtal::BigInteger >  QHBigKernel;
+  typedef QuickHull< QHKernel >            QHull;
+  typedef QuickHull< QHBigKernel >         QHBigHull;
+  typedef QHKernel::CoordinatePoint        Point;
+  typedef QHull::HalfSpace                 HalfSpace;
+  typedef QHBigHull::HalfSpace             BigHalfSpace;
+
+  // Compares the hulls computed with exact int64 heights and with
+  // filtered BigInteger heights.
+  const auto compareHulls = [] ( const std::vector< Point >& V, QHull& hull, QHBigHull& bighull )
+  {
+    hull.setInput( V, false );
+    bighull.setInput( V, false );
+    srand( 0 );
+    hull.computeConvexHull( QHull::Status::VerticesCompleted );
+    srand( 0 );
+    bighull.computeConvexHull( QHBigHull::Status::VerticesCompleted );
+    std::vector< Point > P, BigP;
+    hull.getVertexPositions( P );
+    bighull.getVertexPositions( BigP );
+    std::vector< HalfSpace > H;
+    std::vector< BigHalfSpace > BigH;
+    hull.getFacetHalfSpaces( H );
+    bighull.getFacetHalfSpaces( BigH );
+    bool same_facets = H.size() == BigH.size();
+    for ( std::size_t i = 0; same_facets && i < H.size(); i++ )
+      {
+        same_facets = BigInteger( H[ i ].internalIntercept() )
+          == BigH[ i ].internalIntercept();
+        for ( Dimension k = 0; same_facets && k < 3; k++ )
+          same_facets = BigInteger( H[ i ].internalNormal()[ k ] )
+            == BigH[ i ].internalNormal()[ k ];
+      }
+    return same_facets && P == BigP;
+  };
+  THEN( "Heights are filtered only with BigInteger internal computations" ) {
+    REQUIRE( ! QHull::filtered_heights );
+    REQUIRE( QHBigHull::filtered_heights );
+  }
+  // Coordinates are below 2^19, so that int64 heights do not overflow
+  // while approximated heights have rounding errors.
+  GIVEN( "Given 2000 random point in a ball of radius 2^18" ) {
+    std::vector<Point> V = randomPointsInBall< Point >( 2000, 1 << 18 );
+    QHull hull;
+    QHBigHull bighull;
+    const bool same = compareHulls( V, hull, bighull );
+    THEN( "The convex hulls are valid and the same" ) {
+      REQUIRE( hull.check() );
+      REQUIRE( bighull.check() );
+      REQUIRE( same );
+    }
+  }
+  GIVEN( "Given a pyramid with a large base and points just below the base" ) {
+    // The base has a primitive normal N = u x w with components about
+    // 2^33, so that the error bound of approximated heights is about
+    // 10, while e is a lattice vector with N.e = 1.
+    const Point u( 119560, -65116, 751 );
+    const Point w( -13003, 96096, -104643 );
+    const Point e( -40221, 5811, 18653 );
+    const Point A( 0, 0, 100000 );
+    const Point N = u.crossProduct( w );
+    std::vector<Point> V = { A, A + u, A + w, A + u + w,
+                             A + Point( -16722, -116510, -163946 ) };
+    // Points at heights -1, ..., -10 wrt the base, whose projections
+    // lie inside the base.
+    const double uu = u.dot( u ), uw = u.dot( w ), ww = w.dot( w );
+    for ( int m = 1; m <= 10; m++ )
+      {
+        Point v = -m * e;
+        const double vu = v.dot( u ), vw = v.dot( w );
+        const double a  = ( vu * ww - vw * uw ) / ( uu * ww - uw * uw );
+        const double b  = ( vw * uu - vu * uw ) / ( uu * ww - uw * uw );
+        v -= (DGtal::int64_t) std::floor( a ) * u
+          +  (DGtal::int64_t) std::floor( b ) * w;
+        V.push_back( A + v );
+      }
+    QHull hull;
+    QHBigHull bighull;
+    const bool same = compareHulls( V, hull, bighull );
+    THEN( "The points below the base are at small heights" ) {
+      REQUIRE( N.dot( e ) == 1 );
+      for ( std::size_t i = 5; i < V.size(); i++ )
+        REQUIRE( N.dot( V[ i ] - A ) == 4 - (DGtal::int64_t) i );
+    }
+    THEN( "The convex hulls are valid and the same" ) {
+      REQUIRE( hull.check() );
+      REQUIRE( bighull.check() );
+      REQUIRE( same );
+    }
+    THEN( "Its convex hull is the pyramid" ) {
+      REQUIRE( bighull.nbVertices() == 5 );
+      REQUIRE( bighull.nbFacets()   == 5 );
+    }
+  }
+}
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 // Functions for testing class QuickHull in 4D.
@@ -0,0 +1,125 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDynamicVoronoiMap-benchmark.cpp
+ * @ingroup Tests
+ * @date 2026/10/17
+ *
+ * Benchmark of the updates of DynamicVoronoiMap with respect to the
+ * size of the modification, compared to a full VoronoiMap computation.
+ *
+ * Usage: testDynamicVoronoiMap-benchmark [N] (the domain is [0,N]^3, default 128).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+#include "DGtal/geometry/volumes/distance/DynamicVoronoiMap.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  typedef VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> Voro;
+  typedef DynamicVoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> DynamicVoro;
+
+  trace.beginBlock ( "Benchmarking DynamicVoronoiMap updates" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int N = ( argc > 1 ) ? std::stoi( argv[ 1 ] ) : 128;
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( N ) );
+  const auto randomPoint = [N] ()
+    {
+      return Z3i::Point( rand() % ( N + 1 ), rand() % ( N + 1 ), rand() % ( N + 1 ) );
+    };
+
+  // The object is the set of non-site points (a ball with sparse random sites).
+  Z3i::DigitalSet object( domain );
+  for ( auto const & p : domain )
+    if ( ( p - Z3i::Point::diagonal( N / 2 ) ).norm() < N / 2 )
+      object.insert( p );
+  for ( int i = 0; i < N * N; ++i )
+    object.erase( randomPoint() );
+
+  L2Metric l2;
+  trace.beginBlock( "Full VoronoiMap computation" );
+  Voro full( domain, object, l2 );
+  const double fullTime = trace.endBlock();
+
+  trace.beginBlock( "DynamicVoronoiMap construction" );
+  DynamicVoro dynamicMap( domain, object, l2 );
+  trace.endBlock();
+
+  bool same = true;
+  for ( int batchSize = 1; batchSize <= N * N; batchSize *= 10 )
+    {
+      std::vector<Z3i::Point> inserted, removed;
+      for ( int i = 0; i < batchSize; ++i )
+        {
+          const Z3i::Point p = randomPoint();
+          if ( std::find( inserted.begin(), inserted.end(), p ) != inserted.end()
+               || std::find( removed.begin(), removed.end(), p ) != removed.end() )
+            continue;
+          if ( object( p ) )
+            {
+              inserted.push_back( p );
+              object.erase( p );
+            }
+          else
+            {
+              removed.push_back( p );
+              object.insert( p );
+            }
+        }
+
+      trace.beginBlock( "Update of " + std::to_string( batchSize ) + " points" );
+      dynamicMap.update( inserted, removed );
+      const double updateTime = trace.endBlock();
+      trace.info() << dynamicMap.nbRecomputedLines()[ 0 ] << " / "
+                   << dynamicMap.nbRecomputedLines()[ 1 ] << " / "
+                   << dynamicMap.nbRecomputedLines()[ 2 ] << " recomputed lines, "
+                   << dynamicMap.nbChangedPoints() << " changed points, "
+                   << "speedup w.r.t. full computation: " << fullTime / updateTime << endl;
+
+      const Voro reference( domain, object, l2 );
+      same = same && std::equal( reference.constRange().begin(), reference.constRange().end(),
+                                 dynamicMap.constRange().begin() );
+    }
+  trace.info() << "Same Voronoi maps: " << same << std::endl;
+
+  trace.emphase() << ( same ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return same ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,201 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class DynamicVoronoiMap.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+#include "DGtal/geometry/volumes/distance/DynamicVoronoiMap.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DynamicVoronoiMap.
+///////////////////////////////////////////////////////////////////////////////
+
+template < typename TDomain >
+typename TDomain::Point randomPoint( const TDomain & domain )
+{
+  typename TDomain::Point p = domain.lowerBound();
+  for ( DGtal::Dimension k = 0; k < TDomain::Point::dimension; ++k )
+    p[ k ] += rand() % ( domain.upperBound()[ k ] - domain.lowerBound()[ k ] + 1 );
+  return p;
+}
+
+/**
+ * Applies random batches of updates to a dynamic map and compares
+ * it with a VoronoiMap computed from scratch after each batch.
+ * The object (predicate) is the set of non-site points.
+ */
+template < typename TDynamicMap, typename TMap, typename TDigitalSet >
+bool checkRandomUpdates( TDynamicMap & dynamicMap, TDigitalSet & object,
+                         const typename TDynamicMap::SeparableMetric & metric,
+                         unsigned int nbBatches, unsigned int batchSize,
+                         const typename TDynamicMap::PeriodicitySpec & periodicity )
+{
+  typedef typename TDynamicMap::Point Point;
+  const auto & domain = object.domain();
+  for ( unsigned int b = 0; b < nbBatches; ++b )
+    {
+      std::vector<Point> inserted, removed;
+      for ( unsigned int i = 0; i < batchSize; ++i )
+        {
+          const Point p = randomPoint( domain );
+          if ( std::find( inserted.begin(), inserted.end(), p ) != inserted.end()
+               || std::find( removed.begin(), removed.end(), p ) != removed.end() )
+            continue;
+          if ( object( p ) )
+            {
+              inserted.push_back( p );
+              object.erase( p );
+            }
+          else
+            {
+              removed.push_back( p );
+              object.insert( p );
+            }
+        }
+      dynamicMap.update( inserted, removed );
+
+      for ( auto const & p : domain )
+        if ( dynamicMap.isSite( p ) == object( p ) )
+          return false;
+
+      const TMap reference( domain, object, metric, periodicity, ParallelPolicy::sequential() );
+      if ( ! std::equal( reference.constRange().begin(), reference.constRange().end(),
+                         dynamicMap.constRange().begin() ) )
+        return false;
+    }
+  return true;
+}
+
+TEST_CASE( "Testing DynamicVoronoiMap" )
+{
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 1> L1Metric;
+
+  srand( 0 );
+  const Z3i::Domain domain( Z3i::Point( -2, 0, 1 ), Z3i::Point( 17, 12, 15 ) );
+  Z3i::DigitalSet object( domain );
+  object.assignFromComplement( Z3i::DigitalSet( domain ) );
+  for ( unsigned int i = 0; i < 30; ++i )
+    object.erase( randomPoint( domain ) );
+
+  SECTION( "Initial map, l2 metric" )
+    {
+      L2Metric l2;
+      DynamicVoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> dynamicMap( domain, object, l2 );
+      const VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> reference( domain, object, l2 );
+      REQUIRE( std::equal( reference.constRange().begin(), reference.constRange().end(),
+                           dynamicMap.constRange().begin() ) );
+      REQUIRE( dynamicMap.nbRecomputedLines()[ 0 ] == 13 * 15 );
+      REQUIRE( dynamicMap.nbRecomputedLines()[ 2 ] == 20 * 13 );
+    }
+
+  SECTION( "Batches of insertions and removals, l2 metric" )
+    {
+      L2Metric l2;
+      DynamicVoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> dynamicMap( domain, object, l2 );
+      REQUIRE( ( checkRandomUpdates< decltype( dynamicMap ), VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> >
+                 ( dynamicMap, object, l2, 10, 5, { { false, false, false } } ) ) );
+      REQUIRE( ( checkRandomUpdates< decltype( dynamicMap ), VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> >
+                 ( dynamicMap, object, l2, 3, 200, { { false, false, false } } ) ) );
+    }
+
+  SECTION( "Batches of insertions and removals, l1 metric, several threads" )
+    {
+      L1Metric l1;
+      DynamicVoronoiMap<Z3i::Space, Z3i::DigitalSet, L1Metric> dynamicMap( domain, object, l1,
+                                                                         ParallelPolicy::threads( 3 ) );
+      REQUIRE( ( checkRandomUpdates< decltype( dynamicMap ), VoronoiMap<Z3i::Space, Z3i::DigitalSet, L1Metric> >
+                 ( dynamicMap, object, l1, 10, 10, { { false, false, false } } ) ) );
+    }
+
+  SECTION( "Periodic domain" )
+    {
+      L2Metric l2;
+      const typename VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric>::PeriodicitySpec periodicity = { { true, false, true } };
+      DynamicVoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> dynamicMap( domain, object, l2, periodicity );
+      REQUIRE( ( checkRandomUpdates< decltype( dynamicMap ), VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> >
+                 ( dynamicMap, object, l2, 10, 5, periodicity ) ) );
+    }
+
+  SECTION( "Updates without effect and local repair" )
+    {
+      L2Metric l2;
+      DynamicVoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> dynamicMap( domain, object, l2 );
+
+      // Inserting an existing site or removing a non-site point does nothing.
+      Z3i::Point site = domain.lowerBound();
+      while ( object( site ) ) site = randomPoint( domain );
+      Z3i::Point nonSite = domain.lowerBound();
+      while ( ! object( nonSite ) ) nonSite = randomPoint( domain );
+      dynamicMap.update( { site }, { nonSite } );
+      REQUIRE( dynamicMap.nbChangedPoints() == 0 );
+      REQUIRE( dynamicMap.nbRecomputedLines()[ 0 ] == 0 );
+
+      // A new site in a plane of sites only changes a few lines.
+      Z3i::DigitalSet dense( domain );
+      for ( auto const & p : domain )
+        if ( ( p[ 0 ] % 3 ) != 0 || ( p[ 1 ] % 3 ) != 0 || ( p[ 2 ] % 3 ) != 0 )
+          dense.insert( p );
+      DynamicVoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> denseMap( domain, dense, l2 );
+      denseMap.update( { Z3i::Point( 7, 6, 6 ) }, {} );
+      dense.erase( Z3i::Point( 7, 6, 6 ) );
+      const VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> reference( domain, dense, l2 );
+      REQUIRE( std::equal( reference.constRange().begin(), reference.constRange().end(),
+                           denseMap.constRange().begin() ) );
+      REQUIRE( denseMap.nbRecomputedLines()[ 0 ] == 1 );
+      REQUIRE( denseMap.nbRecomputedLines()[ 2 ] < 20 );
+      REQUIRE( denseMap.nbChangedPoints() < 20 );
+    }
+}
+
+TEST_CASE( "Testing DynamicVoronoiMap in 2D" )
+{
+  typedef ExactPredicateLpSeparableMetric<Z2i::Space, 2> L2Metric;
+  srand( 2 );
+  const Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 40, 31 ) );
+  Z2i::DigitalSet object( domain );
+  object.assignFromComplement( Z2i::DigitalSet( domain ) );
+  for ( unsigned int i = 0; i < 5; ++i )
+    object.erase( randomPoint( domain ) );
+
+  L2Metric l2;
+  DynamicVoronoiMap<Z2i::Space, Z2i::DigitalSet, L2Metric> dynamicMap( domain, object, l2 );
+  REQUIRE( ( checkRandomUpdates< decltype( dynamicMap ), VoronoiMap<Z2i::Space, Z2i::DigitalSet, L2Metric> >
+             ( dynamicMap, object, l2, 20, 3, { { false, false } } ) ) );
+}
+
+/** @ingroup Tests **/
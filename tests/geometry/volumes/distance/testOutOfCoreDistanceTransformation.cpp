@@ -0,0 +1,265 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class OutOfCoreDistanceTransformation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <limits>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/images/TiledImage.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/OutOfCoreDistanceTransformation.h"
+#ifdef WITH_HDF5
+#include "hdf5.h"
+#include "DGtal/images/ImageFactoryFromHDF5.h"
+#endif
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class OutOfCoreDistanceTransformation.
+///////////////////////////////////////////////////////////////////////////////
+
+template < typename TDigitalSet >
+void randomObject( TDigitalSet & set, unsigned int nbSites )
+{
+  set.assignFromComplement( TDigitalSet( set.domain() ) );
+  typename TDigitalSet::Point extent = set.domain().upperBound() - set.domain().lowerBound();
+  for ( unsigned int i = 0; i < nbSites; ++i )
+    {
+      typename TDigitalSet::Point p = set.domain().lowerBound();
+      for ( DGtal::Dimension k = 0; k < TDigitalSet::Point::dimension; ++k )
+        p[ k ] += rand() % ( extent[ k ] + 1 );
+      set.erase( p );
+    }
+}
+
+template < typename TImage, typename TDistanceTransformation >
+bool sameDistances( const TImage & image, const TDistanceTransformation & dt )
+{
+  for ( auto const & p : dt.domain() )
+    if ( image( p ) != dt( p ) )
+      return false;
+  return true;
+}
+
+TEST_CASE( "Testing OutOfCoreDistanceTransformation" )
+{
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  typedef DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric> DT;
+  typedef ImageContainerBySTLVector<Z3i::Domain, double> Image;
+
+  srand( 0 );
+  const Z3i::Domain domain( Z3i::Point( -3, 2, 0 ), Z3i::Point( 28, 21, 23 ) );
+  Z3i::DigitalSet set( domain );
+  randomObject( set, 40 );
+
+  L2Metric l2;
+  const DT dt( domain, set, l2, ParallelPolicy::sequential() );
+
+  SECTION( "In memory output, several memory budgets" )
+    {
+      for ( std::size_t budget : { std::size_t( 1 ), std::size_t( 20000 ),
+                                   OutOfCoreDistanceTransformation<Z3i::Space, Z3i::DigitalSet, Image>::defaultMemoryBudget } )
+        {
+          Image image( domain );
+          OutOfCoreDistanceTransformation<Z3i::Space, Z3i::DigitalSet, Image> oocdt( domain, set, budget );
+          oocdt.compute( image );
+          CAPTURE( oocdt );
+          REQUIRE( oocdt.isValid() );
+          REQUIRE( sameDistances( image, dt ) );
+          REQUIRE( oocdt.statistics().nbTileFaultsRead == 0 );
+          if ( budget == 1 )
+            {
+              REQUIRE( oocdt.statistics().nbSlabs == 24 );
+              REQUIRE( oocdt.statistics().nbColumnBlocks == 32 * 20 );
+            }
+        }
+    }
+
+  SECTION( "Integer output" )
+    {
+      typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::int64_t> IntImage;
+      IntImage image( domain );
+      OutOfCoreDistanceTransformation<Z3i::Space, Z3i::DigitalSet, IntImage> oocdt( domain, set, 10000 );
+      oocdt.compute( image );
+      bool ok = true;
+      for ( auto const & p : domain )
+        ok = ok && image( p ) == static_cast< DGtal::int64_t >( dt( p ) );
+      REQUIRE( ok );
+    }
+
+  SECTION( "Tiled output with a bounded cache" )
+    {
+      typedef ImageFactoryFromImage<Image> Factory;
+      typedef Factory::OutputImage OutputImage;
+      typedef ImageCacheReadPolicyFIFO<OutputImage, Factory> ReadPolicy;
+      typedef ImageCacheWritePolicyWT<OutputImage, Factory> WritePolicy;
+      typedef TiledImage<Image, Factory, ReadPolicy, WritePolicy> Tiled;
+
+      Image storage( domain );
+      Factory factory( storage );
+      ReadPolicy readPolicy( factory, 16 );
+      WritePolicy writePolicy( factory );
+      Tiled tiled( factory, readPolicy, writePolicy, 4 );
+
+      // Tiles are 8x5x6: a slab is one layer of 16 tiles and a block
+      // of columns crosses 16 tiles, hence each tile is loaded once
+      // per phase.
+      const std::size_t budget = 32 * 20 * 6 * sizeof( DGtal::int64_t );
+      OutOfCoreDistanceTransformation<Z3i::Space, Z3i::DigitalSet, Tiled>
+        oocdt( domain, set, budget );
+      oocdt.compute( tiled );
+      CAPTURE( oocdt );
+      REQUIRE( sameDistances( storage, dt ) );
+      REQUIRE( sameDistances( tiled, dt ) );
+      REQUIRE( oocdt.statistics().nbTileFaultsRead > 0 );
+      REQUIRE( oocdt.statistics().nbTileFaultsRead <= 4 * 4 * 4 );
+      REQUIRE( oocdt.statistics().nbTileFaultsWrite <= 4 * 4 * 4 );
+      REQUIRE( oocdt.statistics().peakBufferBytes <= budget + 2 * 32 * sizeof( DGtal::int64_t ) );
+    }
+
+  SECTION( "Object without site" )
+    {
+      Z3i::DigitalSet full( domain );
+      full.assignFromComplement( Z3i::DigitalSet( domain ) );
+      Image image( domain );
+      OutOfCoreDistanceTransformation<Z3i::Space, Z3i::DigitalSet, Image> oocdt( domain, full );
+      oocdt.compute( image );
+      bool ok = true;
+      for ( auto const & p : domain )
+        ok = ok && image( p ) == std::numeric_limits<double>::max();
+      REQUIRE( ok );
+    }
+}
+
+TEST_CASE( "Testing OutOfCoreDistanceTransformation in 2D" )
+{
+  typedef ExactPredicateLpSeparableMetric<Z2i::Space, 2> L2Metric;
+  typedef DistanceTransformation<Z2i::Space, Z2i::DigitalSet, L2Metric> DT;
+  typedef ImageContainerBySTLVector<Z2i::Domain, double> Image;
+
+  srand( 1 );
+  const Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 63, 40 ) );
+  Z2i::DigitalSet set( domain );
+  randomObject( set, 10 );
+
+  L2Metric l2;
+  const DT dt( domain, set, l2, ParallelPolicy::sequential() );
+  Image image( domain );
+  OutOfCoreDistanceTransformation<Z2i::Space, Z2i::DigitalSet, Image> oocdt( domain, set, 1000 );
+  oocdt.compute( image );
+  REQUIRE( sameDistances( image, dt ) );
+  REQUIRE( oocdt.statistics().nbSlabs > 1 );
+  REQUIRE( oocdt.statistics().nbColumnBlocks > 1 );
+}
+
+#ifdef WITH_HDF5
+/**
+ * Creates an HDF5 file with a 3D dataset of doubles set to zero.
+ * @param filename the file name.
+ * @param dataset the dataset name.
+ * @param extent the extent of the dataset along x, y, z.
+ * @return true if the dataset is written.
+ */
+bool writeZeroHDF5( const std::string & filename, const std::string & dataset,
+                    const Z3i::Point & extent )
+{
+  const hsize_t dims[ 3 ] = { (hsize_t) extent[ 2 ], (hsize_t) extent[ 1 ], (hsize_t) extent[ 0 ] };
+  std::vector<double> data( dims[ 0 ] * dims[ 1 ] * dims[ 2 ], 0.0 );
+
+  hid_t file = H5Fcreate( filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT );
+  hid_t dataspace = H5Screate_simple( 3, dims, NULL );
+  hid_t datatype = H5Tcopy( H5T_NATIVE_DOUBLE );
+  H5Tset_order( datatype, H5T_ORDER_LE );
+  hid_t dset = H5Dcreate2( file, dataset.c_str(), datatype, dataspace,
+                           H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+  const herr_t status = H5Dwrite( dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL,
+                                  H5P_DEFAULT, data.data() );
+  H5Sclose( dataspace );
+  H5Tclose( datatype );
+  H5Dclose( dset );
+  H5Fclose( file );
+  return status >= 0;
+}
+
+TEST_CASE( "Testing OutOfCoreDistanceTransformation with an HDF5 output" )
+{
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  typedef DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric> DT;
+  typedef ImageContainerBySTLVector<Z3i::Domain, double> Image;
+  typedef ImageFactoryFromHDF5<Image> Factory;
+  typedef Factory::OutputImage OutputImage;
+  typedef ImageCacheReadPolicyFIFO<OutputImage, Factory> ReadPolicy;
+  typedef ImageCacheWritePolicyWT<OutputImage, Factory> WritePolicy;
+  typedef TiledImage<Image, Factory, ReadPolicy, WritePolicy> Tiled;
+
+  const std::string filename = "testOutOfCoreDistanceTransformation.h5";
+  const std::string dataset  = "distances";
+  const Z3i::Point extent( 32, 20, 24 );
+  REQUIRE( writeZeroHDF5( filename, dataset, extent ) );
+
+  srand( 2 );
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), extent - Z3i::Point::diagonal( 1 ) );
+  Z3i::DigitalSet set( domain );
+  randomObject( set, 40 );
+
+  L2Metric l2;
+  const DT dt( domain, set, l2, ParallelPolicy::sequential() );
+
+  {
+    Factory factory( filename, dataset );
+    REQUIRE( factory.domain().lowerBound() == domain.lowerBound() );
+    REQUIRE( factory.domain().upperBound() == domain.upperBound() );
+    ReadPolicy readPolicy( factory, 16 );
+    WritePolicy writePolicy( factory );
+    Tiled tiled( factory, readPolicy, writePolicy, 4 );
+
+    OutOfCoreDistanceTransformation<Z3i::Space, Z3i::DigitalSet, Tiled>
+      oocdt( domain, set, 32 * 20 * 6 * sizeof( DGtal::int64_t ) );
+    oocdt.compute( tiled );
+    CAPTURE( oocdt );
+    REQUIRE( sameDistances( tiled, dt ) );
+    REQUIRE( oocdt.statistics().nbTileFaultsRead > 0 );
+  }
+
+  // Distances read back from the file.
+  Factory factory( filename, dataset );
+  OutputImage * stored = factory.requestImage( domain );
+  REQUIRE( sameDistances( *stored, dt ) );
+  factory.detachImage( stored );
+}
+#endif
+
+/** @ingroup Tests **/
@@ -0,0 +1,137 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testVoronoiMap-benchmark.cpp
+ * @ingroup Tests
+ * @date 2026/10/17
+ *
+ * Benchmark of the line-by-line and blocked sweeps of VoronoiMap,
+ * DistanceTransformation and ReverseDistanceTransformation, and of
+ * their scaling with the number of threads.
+ *
+ * Usage: testVoronoiMap-benchmark [N] (the domain is [0,N]^3, default 128).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpPowerSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/ReverseDistanceTransformation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking the VoronoiMap sweeps.
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename Metric, typename Predicate>
+bool runVoronoi( const Z3i::Domain & domain, const Predicate & predicate,
+                 const std::string & name )
+{
+  typedef VoronoiMap<Z3i::Space, Predicate, Metric> Voro;
+  Metric metric;
+
+  trace.beginBlock( name + " line by line (block size 1)" );
+  Voro ref( domain, predicate, metric, ParallelPolicy::sequential(), 1 );
+  trace.endBlock();
+
+  bool same = true;
+  const unsigned int maxThreads = ParallelPolicy::threads().nbThreads();
+  for ( unsigned int nbThreads = 1; nbThreads <= maxThreads; nbThreads *= 2 )
+    {
+      trace.beginBlock( name + " blocked (block size "
+                        + std::to_string( Voro::defaultLineBlockSize ) + ", "
+                        + std::to_string( nbThreads ) + " threads)" );
+      Voro voro( domain, predicate, metric, ParallelPolicy::threads( nbThreads ) );
+      trace.endBlock();
+
+      same = same && std::equal( voro.constRange().begin(), voro.constRange().end(),
+                                 ref.constRange().begin() );
+    }
+  trace.info() << "Same Voronoi maps: " << same << std::endl;
+  return same;
+}
+
+bool runReverseDT( const Z3i::Domain & domain, const Z3i::DigitalSet & shape )
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::int64_t> WeightImage;
+  WeightImage weights( domain );
+  for ( auto const & p : shape )
+    weights.setValue( p, ( p[0] % 5 ) + 1 );
+
+  typedef ExactPredicateLpPowerSeparableMetric<Z3i::Space, 2> PowerMetric;
+  typedef ReverseDistanceTransformation<WeightImage, PowerMetric> RDT;
+  typedef PowerMap<WeightImage, PowerMetric> Power;
+  PowerMetric metric;
+
+  trace.beginBlock( "PowerMap line by line (block size 1)" );
+  Power ref( domain, weights, metric, ParallelPolicy::sequential(), 1 );
+  trace.endBlock();
+
+  trace.beginBlock( "ReverseDistanceTransformation blocked (all threads)" );
+  RDT rdt( domain, weights, metric, ParallelPolicy::threads() );
+  trace.endBlock();
+
+  Power power( domain, weights, metric );
+  const bool same = std::equal( power.constRange().begin(), power.constRange().end(),
+                                ref.constRange().begin() );
+  trace.info() << "Same power maps: " << same << std::endl;
+  return same;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking VoronoiMap sweeps" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int N = ( argc > 1 ) ? std::stoi( argv[ 1 ] ) : 128;
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( N ) );
+
+  // Sparse random sites.
+  Z3i::DigitalSet sites( domain );
+  for ( int i = 0; i < N * N; ++i )
+    sites.insert( Z3i::Point( rand() % ( N + 1 ), rand() % ( N + 1 ), rand() % ( N + 1 ) ) );
+  functors::NotPointPredicate<Z3i::DigitalSet> notSites( sites );
+
+  bool res = runVoronoi< ExactPredicateLpSeparableMetric<Z3i::Space, 2> >( domain, notSites, "L2 VoronoiMap" )
+    && runVoronoi< ExactPredicateLpSeparableMetric<Z3i::Space, 3> >( domain, notSites, "L3 VoronoiMap" )
+    && runReverseDT( domain, sites );
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
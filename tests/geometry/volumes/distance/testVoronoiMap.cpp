@@ -646,6 +646,52 @@ bool testSimpleRandom3D()
 }
 
 
+bool testLineBlocks3D()
+{
+  std::size_t const N = 24;
+
+  Z3i::Point a(0, 0, 0);
+  Z3i::Point b(N, N-5, N+3);
+  Z3i::Domain domain(a,b);
+
+  Z3i::DigitalSet sites(domain);
+  for(unsigned int i = 0 ; i < N; ++i)
+    sites.insert( Z3i::Point( rand() % (b[0]+1), rand() % (b[1]+1), rand() % (b[2]+1) ) );
+
+  typedef functors::NotPointPredicate<Z3i::DigitalSet> NegPredicate;
+  NegPredicate negSet( sites );
+
+  ExactPredicateLpSeparableMetric<Z3i::Space, 2> l2;
+  ExactPredicateLpSeparableMetric<Z3i::Space, 3> l3;
+  typedef VoronoiMap<Z3i::Space, NegPredicate, ExactPredicateLpSeparableMetric<Z3i::Space, 2> > Voro2;
+  typedef VoronoiMap<Z3i::Space, NegPredicate, ExactPredicateLpSeparableMetric<Z3i::Space, 3> > Voro3;
+
+  bool ok = true;
+  for ( std::size_t i = 0; i < 8; ++i )
+    {
+      auto const periodicity = getPeriodicityFromInteger<3>(i);
+      trace.beginBlock( "Line blocks 3D with periodicity " + formatPeriodicity(periodicity) );
+
+      // One line at a time is the reference.
+      Voro2 ref2( domain, negSet, l2, periodicity, ParallelPolicy::sequential(), 1 );
+      Voro3 ref3( domain, negSet, l3, periodicity, ParallelPolicy::sequential(), 1 );
+      for ( std::size_t blockSize : { std::size_t(2), std::size_t(7), Voro2::defaultLineBlockSize, std::size_t(100) } )
+        for ( unsigned int nbThreads : { 1u, 3u, 8u } )
+          {
+            const auto policy = ParallelPolicy::threads( nbThreads );
+            Voro2 voro2( domain, negSet, l2, periodicity, policy, blockSize );
+            Voro3 voro3( domain, negSet, l3, periodicity, policy, blockSize );
+            ok = ok && std::equal( voro2.constRange().begin(), voro2.constRange().end(), ref2.constRange().begin() )
+                    && std::equal( voro3.constRange().begin(), voro3.constRange().end(), ref3.constRange().begin() );
+          }
+      ok = ok && checkVoronoi( sites, ref2 );
+      trace.info() << "Same maps for all block sizes and threads: " << ok << std::endl;
+      trace.endBlock();
+    }
+
+  return ok;
+}
+
 
 bool testSimple4D()
 {
@@ -695,6 +741,7 @@ int main( int argc, char** argv )
     && testSimple3D()
     && testSimpleRandom3D()
     && testSimple4D()
+    && testLineBlocks3D()
     ; // && ... other tests
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
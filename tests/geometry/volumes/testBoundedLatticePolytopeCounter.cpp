@@ -121,5 +121,19 @@ SCENARIO( "BoundedLatticePolytope< Z3 > unit tests", "[lattice_polytope][3d]" )
         REQUIRE( nbInterior == nb1_int );
         REQUIRE( nbInterior == nb2_int );
       }
+    THEN( "Its lattice sets and lattice cells are the same as flat ones along any axis" )
+      {
+        typedef Counter::FlatLatticeSet FlatLatticeSet;
+        for ( Dimension k = 0; k < 3; k++ )
+          {
+            const auto L = C.getFlatLatticeSet( k );
+            const auto K = C.getFlatLatticeCells( k );
+            REQUIRE( L.isValid() );
+            REQUIRE( K.isValid() );
+            REQUIRE( int( L.size() ) == nbInside );
+            REQUIRE( L.equals( FlatLatticeSet( C.getLatticeSet( k ), k ) ) );
+            REQUIRE( K.equals( FlatLatticeSet( C.getLatticeCells( k ), k ) ) );
+          }
+      }
   }
 }
@@ -428,7 +428,39 @@ SCENARIO( "ConvexityHelper< 3 > unit tests",
       }
     }
   }
-} 
+  GIVEN( "Given the lattice points of a ball of radius 8 and of a flat rectangle" ) {
+    std::vector<Point> V, W;
+    for ( int x = -8; x <= 8; x++ )
+      for ( int y = -8; y <= 8; y++ ) {
+        for ( int z = -8; z <= 8; z++ )
+          if ( x*x + y*y + z*z <= 64 ) V.push_back( Point( x, y, z ) );
+        if ( y >= 0 ) W.push_back( Point( x, y, x + y ) );
+      }
+    WHEN( "Computing their lattice polytopes with and without culling interior points" ){
+      const auto P1 = Helper::computeLatticePolytope( V, false, true, false );
+      const auto P2 = Helper::computeLatticePolytope( V, false, true, true );
+      const auto Q1 = Helper::computeLatticePolytope( W, false, true, false );
+      const auto Q2 = Helper::computeLatticePolytope( W, false, true, true );
+      THEN( "The polytopes are the same and contain all the points" ) {
+        REQUIRE( P1.nbHalfSpaces() == P2.nbHalfSpaces() );
+        REQUIRE( P1.count() == (Helper::Integer) V.size() );
+        REQUIRE( P2.count() == (Helper::Integer) V.size() );
+        REQUIRE( Q1.nbHalfSpaces() == Q2.nbHalfSpaces() );
+        REQUIRE( Q1.count() == (Helper::Integer) W.size() );
+        REQUIRE( Q2.count() == (Helper::Integer) W.size() );
+      }
+    }
+    WHEN( "Computing the vertices of their convex hulls with and without culling interior points" ){
+      auto X1 = Helper::computeConvexHullVertices( V, false, false );
+      auto X2 = Helper::computeConvexHullVertices( V, false, true );
+      std::sort( X1.begin(), X1.end() );
+      std::sort( X2.begin(), X2.end() );
+      THEN( "The vertices are the same" ) {
+        REQUIRE( X1 == X2 );
+      }
+    }
+  }
+}
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,258 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalConvexity-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmarks fully convex envelopes and full convexity checks of
+ * DigitalConvexity on 3D shapes, with the three envelope algorithms
+ * (DIRECT, LATTICE_SET, FLAT_LATTICE_SET), and the star and skeleton
+ * operations of LatticeSetByIntervals and FlatLatticeSetByIntervals
+ * on large digital shapes.
+ *
+ * Usage: testDigitalConvexity-benchmark [radius [nb_trials [nb_threads]]]
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/kernel/LatticeSetByIntervals.h"
+#include "DGtal/kernel/FlatLatticeSetByIntervals.h"
+#include "DGtal/geometry/volumes/DigitalConvexity.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef KhalimskySpaceND< 3, int >     KSpace;
+typedef KSpace::Point                  Point;
+typedef KSpace::Space                  Space;
+typedef DigitalConvexity< KSpace >     DConvexity;
+typedef DConvexity::LatticeSet         LatticeSet;
+typedef DConvexity::FlatLatticeSet     FlatLatticeSet;
+typedef std::vector< Point >           PointRange;
+typedef std::function< bool( const Point&, double ) > Shape;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class DigitalConvexity.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return the sorted points of the box [-r,r]^3 within \a shape of radius \a r.
+PointRange digitize( const Shape& shape, int r )
+{
+  PointRange X;
+  for ( int x = -r; x <= r; x++ )
+    for ( int y = -r; y <= r; y++ )
+      for ( int z = -r; z <= r; z++ )
+        if ( shape( Point( x, y, z ), r ) ) X.push_back( Point( x, y, z ) );
+  return X;
+}
+
+/// @return the sorted points of \a n random points of \a X.
+PointRange sample( const PointRange& X, unsigned int n )
+{
+  PointRange Z;
+  for ( unsigned int i = 0; i < n; i++ ) Z.push_back( X[ rand() % X.size() ] );
+  std::sort( Z.begin(), Z.end() );
+  Z.erase( std::unique( Z.begin(), Z.end() ), Z.end() );
+  return Z;
+}
+
+/**
+ * Computes the fully convex envelopes of random subsets of a 3D
+ * shape with the three algorithms, checks they are equal, and checks
+ * their full convexity.
+ */
+bool benchmarkEnvelope( const std::string& name, const Shape& shape,
+                        int r, unsigned int nb_trials )
+{
+  trace.beginBlock( "Envelopes of random subsets of " + name );
+  const DConvexity dconv( Point::diagonal( -2*r-2 ), Point::diagonal( 2*r+2 ) );
+  const PointRange X = digitize( shape, r );
+  std::vector< PointRange > Zs;
+  for ( unsigned int i = 0; i < nb_trials; i++ )
+    Zs.push_back( sample( X, 3 + rand() % 8 ) );
+  trace.info() << "#shape=" << X.size() << " #trials=" << nb_trials << std::endl;
+  bool ok = true;
+  std::vector< std::vector< PointRange > > E( 3 );
+  const DConvexity::EnvelopeAlgorithm algos[ 3 ] =
+    { DConvexity::EnvelopeAlgorithm::DIRECT,
+      DConvexity::EnvelopeAlgorithm::LATTICE_SET,
+      DConvexity::EnvelopeAlgorithm::FLAT_LATTICE_SET };
+  const std::string names[ 3 ] = { "DIRECT          ", "LATTICE_SET     ", "FLAT_LATTICE_SET" };
+  Clock c;
+  for ( int a = 0; a < 3; a++ )
+    {
+      std::size_t nb = 0, depth = 0;
+      c.startClock();
+      for ( const auto& Z : Zs )
+        {
+          E[ a ].push_back( dconv.envelope( Z, algos[ a ] ) );
+          nb    += E[ a ].back().size();
+          depth += dconv.depthLastEnvelope();
+        }
+      const double t = c.stopClock();
+      trace.info() << "envelope " << names[ a ] << ": " << t << " ms"
+                   << " (#points=" << nb << ", #iterations=" << depth << ")" << std::endl;
+      ok = ok && E[ a ] == E[ 0 ];
+    }
+  std::size_t nb_cvx = 0;
+  c.startClock();
+  for ( const auto& Z : E[ 0 ] ) nb_cvx += dconv.isFullyConvex( Z ) ? 1 : 0;
+  const double t_cvx = c.stopClock();
+  std::size_t nb_fast = 0;
+  c.startClock();
+  for ( const auto& Z : E[ 0 ] ) nb_fast += dconv.isFullyConvexFast( Z ) ? 1 : 0;
+  const double t_fast = c.stopClock();
+  trace.info() << "isFullyConvex    : " << t_cvx  << " ms (" << nb_cvx  << " fully convex)" << std::endl;
+  trace.info() << "isFullyConvexFast: " << t_fast << " ms (" << nb_fast << " fully convex)" << std::endl;
+  ok = ok && nb_cvx == E[ 0 ].size() && nb_fast == E[ 0 ].size();
+  trace.emphase() << ( ok ? "Passed." : "Error." ) << std::endl;
+  trace.endBlock();
+  return ok;
+}
+
+/**
+ * Checks the full subconvexity of random segments and triangles
+ * with respect to the star of a 3D shape, represented as a lattice
+ * set or as a flat lattice set.
+ */
+bool benchmarkSubconvexity( const std::string& name, const Shape& shape,
+                            int r, unsigned int nb_queries )
+{
+  trace.beginBlock( "Subconvexity of segments and triangles in " + name );
+  const DConvexity dconv( Point::diagonal( -2*r-2 ), Point::diagonal( 2*r+2 ) );
+  const PointRange X = digitize( shape, r );
+  Clock c;
+  c.startClock();
+  const LatticeSet     L  = dconv.Star( X, 0 );
+  const double t_L = c.stopClock();
+  c.startClock();
+  const FlatLatticeSet FL = dconv.FlatStar( X, 0 );
+  const double t_FL = c.stopClock();
+  trace.info() << "Star(X) LatticeSet    : " << t_L  << " ms, #cells=" << L.size()  << std::endl;
+  trace.info() << "Star(X) FlatLatticeSet: " << t_FL << " ms, #cells=" << FL.size() << std::endl;
+  std::vector< Point > Q;
+  for ( unsigned int i = 0; i < 3 * nb_queries; i++ ) Q.push_back( X[ rand() % X.size() ] );
+  bool ok = FL.equals( FlatLatticeSet( L ) );
+  std::vector< bool > R_L( nb_queries ), R_FL( nb_queries );
+  c.startClock();
+  for ( unsigned int i = 0; i < nb_queries; i++ )
+    R_L[ i ] = dconv.isFullySubconvex( Q[ 3*i ], Q[ 3*i+1 ], L );
+  const double t_seg_L = c.stopClock();
+  c.startClock();
+  for ( unsigned int i = 0; i < nb_queries; i++ )
+    R_FL[ i ] = dconv.isFullySubconvex( Q[ 3*i ], Q[ 3*i+1 ], FL );
+  const double t_seg_FL = c.stopClock();
+  ok = ok && R_L == R_FL;
+  const auto nb_seg = std::count( R_L.cbegin(), R_L.cend(), true );
+  c.startClock();
+  for ( unsigned int i = 0; i < nb_queries; i++ )
+    R_L[ i ] = dconv.isFullySubconvex( Q[ 3*i ], Q[ 3*i+1 ], Q[ 3*i+2 ], L );
+  const double t_tri_L = c.stopClock();
+  c.startClock();
+  for ( unsigned int i = 0; i < nb_queries; i++ )
+    R_FL[ i ] = dconv.isFullySubconvex( Q[ 3*i ], Q[ 3*i+1 ], Q[ 3*i+2 ], FL );
+  const double t_tri_FL = c.stopClock();
+  ok = ok && R_L == R_FL;
+  const auto nb_tri = std::count( R_L.cbegin(), R_L.cend(), true );
+  trace.info() << nb_queries << " segments : LatticeSet " << t_seg_L << " ms, FlatLatticeSet "
+               << t_seg_FL << " ms (" << nb_seg << " tangent)" << std::endl;
+  trace.info() << nb_queries << " triangles: LatticeSet " << t_tri_L << " ms, FlatLatticeSet "
+               << t_tri_FL << " ms (" << nb_tri << " subconvex)" << std::endl;
+  trace.emphase() << ( ok ? "Passed." : "Error." ) << std::endl;
+  trace.endBlock();
+  return ok;
+}
+
+/**
+ * Computes Star(X), Skel(Star(X)) and the extrema of the latter for a
+ * large 3D shape X, with both lattice set representations.
+ */
+bool benchmarkTopology( const std::string& name, const Shape& shape,
+                        int r, unsigned int nb_threads )
+{
+  trace.beginBlock( "Star and skeleton of " + name );
+  const PointRange X = digitize( shape, r );
+  Clock c;
+  c.startClock();
+  const LatticeSet L( X.cbegin(), X.cend(), 0 );
+  const auto StarL = L.starOfPoints();
+  const auto SkelL = StarL.skeletonOfCells();
+  const auto ExtrL = SkelL.extremaOfCells();
+  const double t_L = c.stopClock();
+  trace.info() << "#points=" << X.size() << " #cells=" << StarL.size() << std::endl;
+  trace.info() << "LatticeSet                  : " << t_L << " ms" << std::endl;
+  bool ok = ExtrL == X;
+  for ( auto policy : { ParallelPolicy::sequential(), ParallelPolicy::threads( nb_threads ) } )
+    {
+      c.startClock();
+      const FlatLatticeSet F( X.cbegin(), X.cend(), 0 );
+      const auto StarF = F.starOfPoints( policy );
+      const auto SkelF = StarF.skeletonOfCells( policy );
+      const auto ExtrF = SkelF.extremaOfCells();
+      const double t_F = c.stopClock();
+      trace.info() << "FlatLatticeSet (" << policy.nbThreads() << " threads) : "
+                   << t_F << " ms" << std::endl;
+      ok = ok && ExtrF == ExtrL && StarF.equals( FlatLatticeSet( StarL ) );
+    }
+  trace.emphase() << ( ok ? "Passed." : "Error." ) << std::endl;
+  trace.endBlock();
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class DigitalConvexity" );
+  const int          r          = argc > 1 ? atoi( argv[ 1 ] ) : 12;
+  const unsigned int nb_trials  = argc > 2 ? atoi( argv[ 2 ] ) : 20;
+  const unsigned int nb_threads = argc > 3 ? atoi( argv[ 3 ] ) : 4;
+  const Shape ball = [] ( const Point& p, double R )
+  { return p[ 0 ]*p[ 0 ] + p[ 1 ]*p[ 1 ] + p[ 2 ]*p[ 2 ] <= R*R; };
+  const Shape ellipsoid = [] ( const Point& p, double R )
+  { return 4*p[ 0 ]*p[ 0 ] + p[ 1 ]*p[ 1 ] + 9*p[ 2 ]*p[ 2 ] <= R*R; };
+  const Shape torus = [] ( const Point& p, double R )
+  {
+    const double d = sqrt( double( p[ 0 ]*p[ 0 ] + p[ 1 ]*p[ 1 ] ) ) - 0.6*R;
+    return d*d + p[ 2 ]*p[ 2 ] <= 0.16*R*R;
+  };
+  bool res = true;
+  res = benchmarkEnvelope( "ball", ball, r, nb_trials ) && res;
+  res = benchmarkEnvelope( "ellipsoid", ellipsoid, r, nb_trials ) && res;
+  res = benchmarkEnvelope( "torus", torus, r, nb_trials ) && res;
+  res = benchmarkSubconvexity( "torus", torus, r, 50 * nb_trials ) && res;
+  res = benchmarkTopology( "ball", ball, 8 * r, nb_threads ) && res;
+  res = benchmarkTopology( "torus", torus, 8 * r, nb_threads ) && res;
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
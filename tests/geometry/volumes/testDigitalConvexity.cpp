@@ -679,11 +679,15 @@ SCENARIO( "DigitalConvexity< Z3 > sub-convexity of polyhedra", "[full_subconvexi
   auto  P = dconv.makePolytope( X, true );
   auto CG = dconv.makeCellCover( P, 0, 3 );
   auto  L = dconv.StarCvxH( X, 0 );
+  auto FL = dconv.FlatStarCvxH( X, 0 );
   std::vector< Point > Y;
   P.getPoints( Y );
   REQUIRE( CG.nbCells() == L.size() );
+  REQUIRE( FL.equals( DConvexity::FlatLatticeSet( L ) ) );
+  REQUIRE( dconv.isFullySubconvex( P, FL ) );
   unsigned int nb    = 0;
   unsigned int nb_ok = 0;
+  unsigned int nb_ok_flat = 0;
   unsigned int nb_tgt= 0;
   for ( int i = 0; i < 100; i++ )
     {
@@ -692,11 +696,16 @@ SCENARIO( "DigitalConvexity< Z3 > sub-convexity of polyhedra", "[full_subconvexi
       //      Point b( rand() % 20 - 10, rand() % 20 - 10, rand() % 20 - 10 );
       bool tangent_ab_old = dconv.isFullySubconvex( a, b, CG );
       bool tangent_ab_new = dconv.isFullySubconvex( a, b, L );
+      bool tangent_ab_flt = dconv.isFullySubconvex( a, b, FL );
+      bool tangent_Z_flt  = dconv.isFullySubconvex( std::vector< Point >{ a, b }, FL );
       nb_tgt += tangent_ab_new ? 1 : 0;
       nb_ok  += ( tangent_ab_old == tangent_ab_new ) ? 1 : 0;
+      nb_ok_flat += ( tangent_ab_new == tangent_ab_flt
+                      && tangent_ab_new == tangent_Z_flt ) ? 1 : 0;
       nb     += 1;
     }
   REQUIRE( nb == nb_ok );
+  REQUIRE( nb == nb_ok_flat );
   REQUIRE( 0  <  nb_tgt );
   REQUIRE( nb_tgt < 100 );
 }
@@ -773,6 +782,27 @@ SCENARIO( "DigitalConvexity< Z3 > envelope", "[envelope][3d]" )
       }
     }
   }
+  WHEN( "Computing the envelope Z of a digital set X with FlatLatticeSet algorithm" ) {
+    THEN( "Z is the same as with other algorithms and is fully convex" ){
+      for ( int k = 0; k < 5; k++ )
+        {
+          int n = 3 + ( rand() % 7 );
+          std::set< Point > S;
+          for ( int i = 0; i < n; i++ )
+            S.insert( Point( rand() % 10, rand() % 10, rand() % 10 ) );
+          std::vector< Point > X( S.cbegin(), S.cend() );
+          auto Z  = dconv.envelope( X, DConvexity::EnvelopeAlgorithm::FLAT_LATTICE_SET );
+          auto Z1 = dconv.envelope( X, DConvexity::EnvelopeAlgorithm::DIRECT );
+          auto Z2 = dconv.envelope( X, DConvexity::EnvelopeAlgorithm::LATTICE_SET );
+          CAPTURE( dconv.depthLastEnvelope() );
+          REQUIRE( Z == Z1 );
+          REQUIRE( Z == Z2 );
+          REQUIRE( dconv.isFullyConvex( Z ) );
+          REQUIRE( dconv.isFullyConvexFast( Z ) );
+          REQUIRE( dconv.isFullySubconvex( X, dconv.FlatStar( Z ) ) );
+        }
+    }
+  }
 }
 
 SCENARIO( "DigitalConvexity< Z2 > envelope", "[envelope][2d]" )
@@ -901,6 +931,7 @@ SCENARIO( "DigitalConvexity< Z3 > full subconvexity of triangles", "[subconvexit
     unsigned int nb_fulldim = 0;
     unsigned int nb_ok_tri1 = 0;
     unsigned int nb_ok_tri2 = 0;
+    unsigned int nb_ok_tri3 = 0;
     for ( unsigned int l = 0; l < nb; ++l )
       {
         const Point a { (rand() % 10 - 5), (rand() % 10 - 5), (rand() % 10 - 5) };
@@ -914,9 +945,11 @@ SCENARIO( "DigitalConvexity< Z3 > full subconvexity of triangles", "[subconvexit
         auto simplex = dconv.makeSimplex( pts.cbegin(), pts.cend() );
         auto cover   = dconv.makeCellCover( simplex, 0, 3 );
 	auto ls      = dconv.StarCvxH( pts );
+        auto fls     = dconv.FlatStarCvxH( pts, ls.axis() );
         {
           unsigned int nb_subconvex1 = 0;
 	  unsigned int nb_subconvex2 = 0;
+          unsigned int nb_subconvex3 = 0;
           unsigned int nb_total      = 0;
           for ( unsigned int i = 0; i < 4; i++ )
             for ( unsigned int j = i+1; j < 4; j++ )
@@ -925,8 +958,10 @@ SCENARIO( "DigitalConvexity< Z3 > full subconvexity of triangles", "[subconvexit
                   auto tri1 = dconv.makeSimplex({ pts[ i ], pts[ j ], pts[ k ] });
                   bool ok1  = dconv.isFullySubconvex( tri1, cover );
                   bool ok2  = dconv.isFullySubconvex( pts[ i ], pts[ j ], pts[ k ], ls );
+                  bool ok3  = dconv.isFullySubconvex( pts[ i ], pts[ j ], pts[ k ], fls );
                   nb_subconvex1 += ok1 ? 1 : 0;
                   nb_subconvex2 += ok2 ? 1 : 0;		  
+                  nb_subconvex3 += ok3 ? 1 : 0;
                   nb_total      += 1;
                   if ( ! ok1 ) {
                     trace.info() << "****** TRIANGLE NOT SUBCONVEX ****" << std::endl; 
@@ -946,6 +981,7 @@ SCENARIO( "DigitalConvexity< Z3 > full subconvexity of triangles", "[subconvexit
                 }
           nb_ok_tri1 += ( nb_subconvex1 == nb_total ) ? 1 : 0;
           nb_ok_tri2 += ( nb_subconvex2 == nb_total ) ? 1 : 0;	  
+          nb_ok_tri3 += ( nb_subconvex3 == nb_total ) ? 1 : 0;
         }
       }
     THEN( "All triangles of a tetrahedron should be subconvex to it." ) {
@@ -954,6 +990,9 @@ SCENARIO( "DigitalConvexity< Z3 > full subconvexity of triangles", "[subconvexit
     THEN( "All 3D triangles of a tetrahedron should be subconvex to it." ) {
       REQUIRE( nb_ok_tri2 == nb_fulldim );
     }
+    THEN( "All 3D triangles of a tetrahedron should be subconvex to its flat lattice set." ) {
+      REQUIRE( nb_ok_tri3 == nb_fulldim );
+    }
   }
 
 }
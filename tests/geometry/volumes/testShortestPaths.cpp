@@ -132,3 +132,120 @@ SCENARIO( "TangencyComputer::ShortestPaths 3D tests", "[shortest_paths][3d][tang
     }
 }  
 
+
+SCENARIO( "TangencyComputer cotangency graph, batched and A* shortest paths", "[shortest_paths][3d][tangency][parallel]" )
+{
+  typedef Z3i::Space          Space;
+  typedef Z3i::KSpace         KSpace;
+  typedef Shortcuts< KSpace > SH3;
+  typedef Space::Point        Point;
+  typedef std::size_t         Index;
+
+  // Make digital sphere
+  const double h = 0.25;
+  auto   params  = SH3::defaultParameters();
+  params( "polynomial", "sphere1" )( "gridstep",  h );
+  params( "minAABB", -2)( "maxAABB", 2)( "offset", 1.0 )( "closed", 1 );
+  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto K            = SH3::getKSpace( params );
+  auto binary_image = SH3::makeBinaryImage(digitized_shape,
+                                           SH3::Domain(K.lowerBound(),K.upperBound()),
+                                           params );
+  auto surface = SH3::makeDigitalSurface( binary_image, K, params );
+  std::vector< Point >    lattice_points;
+  auto pointels = SH3::getPointelRange( surface );
+  for ( auto p : pointels ) lattice_points.push_back( K.uCoords( p ) );
+  const Index nb = lattice_points.size();
+  Index   lowest = 0;
+  Index   uppest = 0;
+  for ( Index i = 1; i < nb; i++ )
+    {
+      if ( lattice_points[ i ] < lattice_points[ lowest ] ) lowest = i;
+      if ( lattice_points[ uppest ] < lattice_points[ i ] ) uppest = i;
+    }
+  TangencyComputer< KSpace > TC( K );
+  TC.init( lattice_points.cbegin(), lattice_points.cend() );
+  std::vector< Index > sources;
+  for ( Index i = 0; i < nb; i += 37 ) sources.push_back( i );
+  const auto D_ref = TC.shortestDistances( sources, sqrt( 3.0 ),
+                                           ParallelPolicy::sequential() );
+
+  WHEN( "The cotangency graph is computed sequentially or in parallel" )
+    {
+      TangencyComputer< KSpace > TC_par( TC );
+      TC.computeCotangencyGraph( ParallelPolicy::sequential() );
+      TC_par.computeCotangencyGraph( ParallelPolicy::threads( 3 ) );
+      const auto& G = TC.cotangencyGraph();
+      THEN( "Both graphs are the same and list the cotangent points of each point" )
+        {
+          REQUIRE( TC.hasCotangencyGraph() );
+          REQUIRE( G.offsets.size() == nb + 1 );
+          REQUIRE( G.offsets.back() == G.neighbors.size() );
+          REQUIRE( G.offsets    == TC_par.cotangencyGraph().offsets );
+          REQUIRE( G.neighbors  == TC_par.cotangencyGraph().neighbors );
+          Index nb_ok = 0;
+          for ( Index i = 0; i < nb; i += 11 )
+            {
+              auto N1 = TC.getCotangentPoints( TC.point( i ) );
+              std::vector< Index > N2( G.neighbors.cbegin() + G.offsets[ i ],
+                                       G.neighbors.cbegin() + G.offsets[ i + 1 ] );
+              std::sort( N1.begin(), N1.end() );
+              std::sort( N2.begin(), N2.end() );
+              nb_ok += ( N1 == N2 ) ? 1 : 0;
+            }
+          REQUIRE( nb_ok == ( nb + 10 ) / 11 );
+        }
+      THEN( "Batched distances use the graph, give the same distances, and do not depend on the number of threads" )
+        {
+          const auto D_seq = TC.shortestDistances( sources, sqrt( 3.0 ),
+                                                   ParallelPolicy::sequential() );
+          const auto D_par = TC.shortestDistances( sources, sqrt( 3.0 ),
+                                                   ParallelPolicy::threads( 3 ) );
+          REQUIRE( D_seq == D_par );
+          REQUIRE( D_seq.size() == sources.size() );
+          double max_error = 0.0;
+          for ( Index k = 0; k < sources.size(); k++ )
+            for ( Index i = 0; i < nb; i++ )
+              max_error = std::max( max_error, std::fabs( D_seq[ k ][ i ] - D_ref[ k ][ i ] ) );
+          REQUIRE( max_error < 1e-10 );
+        }
+      THEN( "The bidirectional A* path is a shortest path between its extremities" )
+        {
+          auto SP = TC.makeShortestPaths();
+          SP.init( lowest );
+          while ( ! SP.finished() ) SP.expand();
+          auto P  = TC.shortestPathAStar( lowest, uppest );
+          auto P2 = TC_par.shortestPathAStar( uppest, lowest );
+          REQUIRE( P.size() >= 2 );
+          REQUIRE( P.front() == lowest );
+          REQUIRE( P.back()  == uppest );
+          REQUIRE( P2.front() == uppest );
+          REQUIRE( P2.back()  == lowest );
+          Index nb_cotangent = 0;
+          for ( Index i = 1; i < P.size(); i++ )
+            nb_cotangent += TC.arePointsCotangent( TC.point( P[ i-1 ] ), TC.point( P[ i ] ) )
+              ? 1 : 0;
+          REQUIRE( nb_cotangent == P.size() - 1 );
+          REQUIRE( TC.length( P )  == Approx( SP.distance( uppest ) ) );
+          REQUIRE( TC.length( P2 ) == Approx( SP.distance( uppest ) ) );
+          auto P3 = TC.shortestPathAStar( lowest, lowest );
+          REQUIRE( P3.size() == 1 );
+        }
+    }
+  WHEN( "No cotangency graph is computed" )
+    {
+      THEN( "The bidirectional A* path is not longer than the bidirectional path" )
+        {
+          auto P0 = TC.shortestPath( lowest, uppest );
+          auto P  = TC.shortestPathAStar( lowest, uppest );
+          REQUIRE( P.front() == lowest );
+          REQUIRE( P.back()  == uppest );
+          auto SP = TC.makeShortestPaths();
+          SP.init( lowest );
+          while ( ! SP.finished() ) SP.expand();
+          REQUIRE( TC.length( P ) <= TC.length( P0 ) + 1e-10 );
+          REQUIRE( TC.length( P ) == Approx( SP.distance( uppest ) ) );
+        }
+    }
+}
@@ -0,0 +1,170 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testTangencyComputer-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmarks geodesic distances and shortest paths computed by
+ * TangencyComputer on the boundary of a digitized sphere: one
+ * ShortestPaths object per source (as with makeShortestPaths),
+ * batched sources using the cotangency graph, and point-to-point
+ * shortest paths.
+ *
+ * Usage: testTangencyComputer-benchmark [gridstep [nb_sources [nb_threads]]]
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/geometry/volumes/TangencyComputer.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Z3i::KSpace                  KSpace;
+typedef Shortcuts< KSpace >          SH3;
+typedef Z3i::Point                   Point;
+typedef TangencyComputer< KSpace >   TgcyComputer;
+typedef TgcyComputer::Index          Index;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class TangencyComputer.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Computes distances from \a nb_sources sources and a few shortest
+ * paths on the pointels of a unit sphere digitized at gridstep \a h.
+ */
+bool benchmarkShortestPaths( double h, Index nb_sources, unsigned int nb_threads )
+{
+  trace.beginBlock( "Shortest paths on a sphere at gridstep " + std::to_string( h ) );
+  bool ok = true;
+  auto params = SH3::defaultParameters();
+  params( "polynomial", "sphere1" )( "gridstep",  h );
+  params( "minAABB", -2 )( "maxAABB", 2 )( "offset", 1.0 )( "closed", 1 );
+  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto K            = SH3::getKSpace( params );
+  auto binary_image = SH3::makeBinaryImage( digitized_shape,
+                                            SH3::Domain( K.lowerBound(), K.upperBound() ),
+                                            params );
+  auto surface  = SH3::makeDigitalSurface( binary_image, K, params );
+  std::vector< Point > X;
+  for ( auto p : SH3::getPointelRange( surface ) ) X.push_back( K.uCoords( p ) );
+  TgcyComputer TC( K );
+  TC.init( X.cbegin(), X.cend() );
+  const Index n = X.size();
+  std::vector< Index > sources;
+  for ( Index k = 0; k < nb_sources; k++ ) sources.push_back( ( k * n ) / nb_sources );
+  trace.info() << "#points=" << n << " #sources=" << sources.size() << std::endl;
+
+  Clock c;
+  c.startClock();
+  std::vector< std::vector< double > > D_ref;
+  for ( auto s : sources )
+    {
+      auto SP = TC.makeShortestPaths();
+      SP.init( s );
+      while ( ! SP.finished() ) SP.expand();
+      D_ref.push_back( SP.distances() );
+    }
+  const double t_ref = c.stopClock();
+  trace.info() << "one ShortestPaths per source: " << t_ref << " ms" << std::endl;
+
+  c.startClock();
+  TC.computeCotangencyGraph( ParallelPolicy::threads( nb_threads ) );
+  const double t_graph = c.stopClock();
+  trace.info() << "cotangency graph (" << nb_threads << " threads): " << t_graph << " ms"
+               << ", #arcs=" << TC.cotangencyGraph().neighbors.size() << std::endl;
+  for ( auto policy : { ParallelPolicy::sequential(), ParallelPolicy::threads( nb_threads ) } )
+    {
+      c.startClock();
+      const auto D = TC.shortestDistances( sources, sqrt( 3.0 ), policy );
+      const double t = c.stopClock();
+      // The graph contains all cotangent points, hence distances may
+      // only be shorter than those pruned with 'secure'.
+      double max_longer = 0.0, max_shorter = 0.0;
+      for ( Index k = 0; k < D.size(); k++ )
+        for ( Index i = 0; i < n; i++ )
+          {
+            max_longer  = std::max( max_longer,  D[ k ][ i ] - D_ref[ k ][ i ] );
+            max_shorter = std::max( max_shorter, D_ref[ k ][ i ] - D[ k ][ i ] );
+          }
+      trace.info() << "batched distances with graph (" << policy.nbThreads()
+                   << " threads): " << t << " ms, with graph: " << ( t + t_graph )
+                   << " ms, max shorter=" << max_shorter
+                   << " max longer=" << max_longer << std::endl;
+      ok = ok && max_longer < 1e-10;
+    }
+
+  TgcyComputer TC_nograph( K );
+  TC_nograph.init( X.cbegin(), X.cend() );
+  double l_bidir = 0.0, l_astar = 0.0, l_astar_graph = 0.0, l_exact = 0.0;
+  double t_bidir = 0.0, t_astar = 0.0, t_astar_graph = 0.0;
+  for ( Index k = 0; k < sources.size(); k++ )
+    {
+      const Index s = sources[ k ];
+      const Index t = sources[ ( k + sources.size() / 2 ) % sources.size() ];
+      c.startClock();
+      const auto P0 = TC_nograph.shortestPath( s, t );
+      t_bidir += c.stopClock();
+      c.startClock();
+      const auto P1 = TC_nograph.shortestPathAStar( s, t );
+      t_astar += c.stopClock();
+      c.startClock();
+      const auto P2 = TC.shortestPathAStar( s, t );
+      t_astar_graph += c.stopClock();
+      l_bidir       += TC.length( P0 );
+      l_astar       += TC.length( P1 );
+      l_astar_graph += TC.length( P2 );
+      l_exact       += D_ref[ k ][ t ];
+    }
+  trace.info() << "point-to-point x " << sources.size() << std::endl;
+  trace.info() << "  shortestPath:               " << t_bidir << " ms, total length=" << l_bidir << std::endl;
+  trace.info() << "  shortestPathAStar:          " << t_astar << " ms, total length=" << l_astar << std::endl;
+  trace.info() << "  shortestPathAStar w. graph: " << t_astar_graph << " ms, total length=" << l_astar_graph << std::endl;
+  trace.info() << "  ShortestPaths total length=" << l_exact << std::endl;
+  ok = ok && l_astar_graph <= l_exact * ( 1.0 + 1e-10 );
+  trace.endBlock();
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class TangencyComputer" );
+  const double       h          = argc > 1 ? atof( argv[ 1 ] ) : 0.1;
+  const Index        nb_sources = argc > 2 ? atoi( argv[ 2 ] ) : 16;
+  const unsigned int nb_threads = argc > 3 ? atoi( argv[ 3 ] ) : 4;
+  bool res = benchmarkShortestPaths( h, nb_sources, nb_threads );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
@@ -83,5 +83,41 @@ SCENARIO( "Shortcuts< K3 > pointel ordering", "[shortcuts][pointel]" )
   }
 }
 
+SCENARIO( "Shortcuts< K3 > parallel extraction of all surface components", "[shortcuts][components]" )
+{
+  typedef KhalimskySpaceND<3>                       KSpace;
+  typedef Shortcuts< KSpace >                       SH3;
+
+  auto params          = SH3::defaultParameters();
+  params( "polynomial", "goursat" )( "gridstep", 0.25 )( "surfaceComponents", "All" );
+  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage      ( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  // Adds a small cube in a corner of the domain, far from the shape.
+  for ( auto const & p : SH3::Domain( SH3::Point::diagonal( 40 ), SH3::Point::diagonal( 42 ) ) )
+    binary_image->setValue( p, true );
+
+  GIVEN( "The light digital surfaces of all components, extracted with one and three threads" ) {
+    SH3::SurfelRange reps, preps;
+    auto surfaces  = SH3::makeLightDigitalSurfaces( reps, binary_image, K, params );
+    auto psurfaces = SH3::makeLightDigitalSurfaces( preps, binary_image, K, params( "threads", 3 ) );
+    THEN( "They have the same components and representative surfels" ) {
+      REQUIRE( surfaces.size() > 1 );
+      REQUIRE( reps == preps );
+      REQUIRE( surfaces.size() == psurfaces.size() );
+      for ( std::size_t i = 0; i < surfaces.size(); ++i )
+        REQUIRE( surfaces[ i ]->size() == psurfaces[ i ]->size() );
+    }
+    THEN( "The indexed digital surfaces built from them are the same" ) {
+      auto idx_surface  = SH3::makeIdxDigitalSurface( surfaces, params( "threads", 1 ) );
+      auto pidx_surface = SH3::makeIdxDigitalSurface( binary_image, K, params( "threads", 3 ) );
+      REQUIRE( idx_surface->nbVertices() == pidx_surface->nbVertices() );
+      REQUIRE( idx_surface->nbEdges() == pidx_surface->nbEdges() );
+      REQUIRE( idx_surface->nbFaces() == pidx_surface->nbFaces() );
+    }
+  }
+}
+
 //                                                                           //
 ///////////////////////////////////////////////////////////////////////////////
@@ -36,6 +36,7 @@
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/ImageContainerBySparseBricks.h"
 
 #include "DGtal/helpers/StdDefs.h"
 #include <map>
@@ -50,6 +51,7 @@ using namespace DGtal;
 typedef DGtal::ImageContainerBySTLVector< Z2i::Domain, DGtal::int32_t> ImageVector2;
 typedef DGtal::ImageContainerBySTLMap< Z2i::Domain, DGtal::int32_t> ImageMap2;
 typedef DGtal::experimental::ImageContainerByHashTree< Z2i::Domain, DGtal::int32_t> ImageHash2;
+typedef DGtal::ImageContainerBySparseBricks< Z2i::Domain, DGtal::int32_t> ImageBricks2;
 
 template<typename Q>
 static void BM_Constructor(benchmark::State& state)
@@ -66,6 +68,7 @@ static void BM_Constructor(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_Constructor, ImageVector2)->Range(1<<3 , 1 << 10);
 BENCHMARK_TEMPLATE(BM_Constructor, ImageMap2)->Range(1<<3 , 1 << 16);
 BENCHMARK_TEMPLATE(BM_Constructor, ImageHash2)->Range(1<<3 , 1 << 16);
+BENCHMARK_TEMPLATE(BM_Constructor, ImageBricks2)->Range(1<<3 , 1 << 16);
 
 template<typename Point>
 std::set<Point> ConstructRandomSet(unsigned int size, unsigned int maxWidth) {
@@ -109,6 +112,7 @@ static void BM_SetValue(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_SetValue, ImageVector2)->Range(1<<3 , 1 << 10);
 BENCHMARK_TEMPLATE(BM_SetValue, ImageMap2)->Range(1<<3 , 1 << 16);
 BENCHMARK_TEMPLATE(BM_SetValue, ImageHash2)->Range(1<<3 , 1 << 10);
+BENCHMARK_TEMPLATE(BM_SetValue, ImageBricks2)->Range(1<<3 , 1 << 16);
 
 template<typename Q>
 static void BM_RangeScan(benchmark::State& state)
@@ -135,6 +139,7 @@ static void BM_RangeScan(benchmark::State& state)
 }
 BENCHMARK_TEMPLATE(BM_RangeScan, ImageVector2)->Range(1<<3 , 1 << 10);
 BENCHMARK_TEMPLATE(BM_RangeScan, ImageMap2)->Range(1<<3 , 1 << 10);
+BENCHMARK_TEMPLATE(BM_RangeScan, ImageBricks2)->Range(1<<3 , 1 << 10);
 
 template<typename Q>
 static void BM_DomainScan(benchmark::State& state)
@@ -162,6 +167,122 @@ static void BM_DomainScan(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_DomainScan, ImageVector2)->Range(1<<3 , 1 << 10);
 BENCHMARK_TEMPLATE(BM_DomainScan, ImageMap2)->Range(1<<3 , 1 << 10);
 
+/////// Sparse 3D volumes
+
+typedef DGtal::ImageContainerBySTLVector< Z3i::Domain, bool> ImageVector3;
+typedef DGtal::ImageContainerBySparseBricks< Z3i::Domain, bool> ImageBricks3;
+
+/// Digital sphere of radius r centered in a cube of side 4r+1.
+static Z3i::DigitalSet ConstructSphere( int r )
+{
+  const Z3i::Point c = Z3i::Point::diagonal( 2 * r );
+  Z3i::Domain dom( c - Z3i::Point::diagonal( r + 1 ), c + Z3i::Point::diagonal( r + 1 ) );
+  Z3i::DigitalSet s( dom );
+  for ( auto const & p : dom )
+    {
+      const auto n = ( p - c ).squaredNorm();
+      if ( n <= (unsigned int)( r * r ) && n > (unsigned int)( ( r - 1 ) * ( r - 1 ) ) )
+        s.insertNew( p );
+    }
+  return s;
+}
+
+template<typename Q>
+static void BM_SparseFromDigitalSet(benchmark::State& state)
+{
+  const int r = state.range(0);
+  const Z3i::DigitalSet sphere = ConstructSphere( r );
+  Z3i::Domain dom( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( 4 * r ) );
+  std::size_t memory = 0;
+  while (state.KeepRunning())
+    {
+      Q image( dom );
+      for ( auto const & p : sphere )
+        image.setValue( p, true );
+      memory = dom.size() * sizeof( bool );
+      benchmark::DoNotOptimize( image( sphere.domain().lowerBound() ) );
+    }
+  state.SetItemsProcessed( state.iterations() * sphere.size() );
+  state.SetLabel( std::to_string( memory / 1024 ) + " KiB" );
+}
+
+template<>
+void BM_SparseFromDigitalSet<ImageBricks3>(benchmark::State& state)
+{
+  const int r = state.range(0);
+  const Z3i::DigitalSet sphere = ConstructSphere( r );
+  Z3i::Domain dom( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( 4 * r ) );
+  std::size_t memory = 0;
+  while (state.KeepRunning())
+    {
+      ImageBricks3 image( dom );
+      image.setValues( sphere.begin(), sphere.end(), true );
+      memory = image.memoryUsage();
+      benchmark::DoNotOptimize( image( sphere.domain().lowerBound() ) );
+    }
+  state.SetItemsProcessed( state.iterations() * sphere.size() );
+  state.SetLabel( std::to_string( memory / 1024 ) + " KiB" );
+}
+BENCHMARK_TEMPLATE(BM_SparseFromDigitalSet, ImageVector3)->RangeMultiplier(2)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_SparseFromDigitalSet, ImageBricks3)->RangeMultiplier(2)->Range(1<<4 , 1 << 9);
+
+static void BM_SparseIterate(benchmark::State& state)
+{
+  const int r = state.range(0);
+  const Z3i::DigitalSet sphere = ConstructSphere( r );
+  ImageBricks3 image( Z3i::Domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( 4 * r ) ) );
+  image.setValues( sphere.begin(), sphere.end(), true );
+  int64_t sum = 0;
+  while (state.KeepRunning())
+    for ( auto const & p : image )
+      benchmark::DoNotOptimize( sum += p[ 0 ] );
+  state.SetItemsProcessed( state.iterations() * image.size() );
+}
+BENCHMARK(BM_SparseIterate)->RangeMultiplier(2)->Range(1<<4 , 1 << 9);
+
+/// Counts the 6-neighbors of each voxel of a digital sphere.
+template<typename Q>
+static void BM_NeighborAccess(benchmark::State& state)
+{
+  const int r = state.range(0);
+  const Z3i::DigitalSet sphere = ConstructSphere( r );
+  Q image( Z3i::Domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( 4 * r ) ) );
+  for ( auto const & p : sphere )
+    image.setValue( p, true );
+  const Z3i::Point n[ 6 ] = { Z3i::Point( 1, 0, 0 ), Z3i::Point( -1, 0, 0 ),
+                              Z3i::Point( 0, 1, 0 ), Z3i::Point( 0, -1, 0 ),
+                              Z3i::Point( 0, 0, 1 ), Z3i::Point( 0, 0, -1 ) };
+  int64_t nb = 0;
+  while (state.KeepRunning())
+    for ( auto const & p : sphere )
+      for ( unsigned int i = 0; i < 6; ++i )
+        benchmark::DoNotOptimize( nb += image( p + n[ i ] ) ? 1 : 0 );
+  state.SetItemsProcessed( state.iterations() * sphere.size() * 6 );
+}
+
+template<>
+void BM_NeighborAccess<ImageBricks3>(benchmark::State& state)
+{
+  const int r = state.range(0);
+  const Z3i::DigitalSet sphere = ConstructSphere( r );
+  ImageBricks3 image( Z3i::Domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( 4 * r ) ) );
+  image.setValues( sphere.begin(), sphere.end(), true );
+  const Z3i::Point n[ 6 ] = { Z3i::Point( 1, 0, 0 ), Z3i::Point( -1, 0, 0 ),
+                              Z3i::Point( 0, 1, 0 ), Z3i::Point( 0, -1, 0 ),
+                              Z3i::Point( 0, 0, 1 ), Z3i::Point( 0, 0, -1 ) };
+  int64_t nb = 0;
+  while (state.KeepRunning())
+    {
+      ImageBricks3::ConstAccessor acc( image );
+      for ( auto const & p : image )
+        for ( unsigned int i = 0; i < 6; ++i )
+          benchmark::DoNotOptimize( nb += acc( p + n[ i ] ) ? 1 : 0 );
+    }
+  state.SetItemsProcessed( state.iterations() * sphere.size() * 6 );
+}
+BENCHMARK_TEMPLATE(BM_NeighborAccess, ImageVector3)->RangeMultiplier(2)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_NeighborAccess, ImageBricks3)->RangeMultiplier(2)->Range(1<<4 , 1 << 7);
+
 
 
 
@@ -0,0 +1,218 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class ImageContainerBySparseBricks.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/sets/DigitalSetInserter.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySparseBricks.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerBySparseBricks.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Fills a sparse image and a dense reference image with the same
+ * random values, then checks values, active voxels and iteration
+ * order against the dense image.
+ */
+template < typename SparseImage >
+void checkAgainstDenseImage( const typename SparseImage::Domain & domain, int percent )
+{
+  typedef typename SparseImage::Domain Domain;
+  typedef typename SparseImage::Point Point;
+  typedef ImageContainerBySTLVector<Domain, int> DenseImage;
+
+  SparseImage sparse( domain );
+  DenseImage dense( domain );
+  std::vector<Point> cluster;
+  // A few clusters of voxels, plus isolated voxels.
+  for ( auto const & p : domain )
+    {
+      const int r = rand() % 1000;
+      if ( ( r < 10 * percent ) && ( ( p[ 0 ] / 3 + p[ Domain::dimension - 1 ] ) % 4 == 0 ) )
+        cluster.push_back( p );
+      else if ( r < percent )
+        {
+          const int v = 1 + rand() % 7;
+          sparse.setValue( p, v );
+          dense.setValue( p, v );
+        }
+    }
+  sparse.setValues( cluster.begin(), cluster.end(), 9 );
+  for ( auto const & p : cluster ) dense.setValue( p, 9 );
+  // Some voxels are set back to the background value.
+  for ( auto const & p : domain )
+    if ( dense( p ) != 0 && rand() % 5 == 0 )
+      {
+        sparse.setValue( p, 0 );
+        dense.setValue( p, 0 );
+      }
+
+  std::vector<Point> expected;
+  for ( auto const & p : domain )
+    if ( dense( p ) != 0 ) expected.push_back( p );
+  const std::vector<Point> visited( sparse.begin(), sparse.end() );
+  CAPTURE( domain );
+  REQUIRE( sparse.isValid() );
+  REQUIRE( sparse.size() == expected.size() );
+  REQUIRE( visited == expected );
+
+  bool sameValues = true;
+  typename SparseImage::ConstAccessor acc( sparse );
+  for ( auto const & p : domain )
+    sameValues = sameValues && ( sparse( p ) == dense( p ) ) && ( acc( p ) == dense( p ) )
+      && ( sparse.isActive( p ) == ( dense( p ) != 0 ) );
+  REQUIRE( sameValues );
+
+  // find() gives iterators continuing in the order of the domain.
+  if ( expected.size() > 2 )
+    {
+      const std::size_t k = expected.size() / 2;
+      auto it = sparse.find( expected[ k ] );
+      REQUIRE( it != sparse.end() );
+      REQUIRE( std::vector<Point>( it, sparse.end() )
+               == std::vector<Point>( expected.begin() + k, expected.end() ) );
+    }
+}
+
+TEST_CASE( "Testing ImageContainerBySparseBricks" )
+{
+  typedef ImageContainerBySparseBricks<Z3i::Domain, int> Image3;
+  typedef ImageContainerBySparseBricks<Z3i::Domain, bool> Set3;
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< Image3 > ));
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< Set3 > ));
+  BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet< Set3 > ));
+  srand( 0 );
+
+  SECTION( "Same values and order as a dense image in 2D, 3D and 4D" )
+    {
+      typedef SpaceND<4> Space4;
+      typedef HyperRectDomain<Space4> Domain4;
+      checkAgainstDenseImage< ImageContainerBySparseBricks<Z2i::Domain, int> >
+        ( Z2i::Domain( Z2i::Point( -5, -7 ), Z2i::Point( 60, 41 ) ), 30 );
+      checkAgainstDenseImage< ImageContainerBySparseBricks<Z2i::Domain, int, 2, 1> >
+        ( Z2i::Domain( Z2i::Point( -5, -7 ), Z2i::Point( 60, 41 ) ), 5 );
+      checkAgainstDenseImage< Image3 >
+        ( Z3i::Domain( Z3i::Point( -9, 3, -20 ), Z3i::Point( 40, 31, 27 ) ), 3 );
+      checkAgainstDenseImage< ImageContainerBySparseBricks<Z3i::Domain, int, 1, 1> >
+        ( Z3i::Domain( Z3i::Point( -9, 3, -20 ), Z3i::Point( 20, 18, 7 ) ), 10 );
+      checkAgainstDenseImage< ImageContainerBySparseBricks<Domain4, int, 2, 1> >
+        ( Domain4( Space4::Point::diagonal( -3 ), Space4::Point::diagonal( 9 ) ), 4 );
+    }
+
+  SECTION( "Digital set services" )
+    {
+      Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 20, 20, 20 ) );
+      Set3 set( domain );
+      REQUIRE( set.empty() );
+      set.insert( Z3i::Point( 3, 4, 5 ) );
+      set.insert( Z3i::Point( 17, 2, 19 ) );
+      set.insertNew( Z3i::Point( 9, 20, 0 ) );
+      set.insert( Z3i::Point( 3, 4, 5 ) );
+      REQUIRE( set.size() == 3 );
+      REQUIRE( set( Z3i::Point( 17, 2, 19 ) ) );
+      REQUIRE( ! set( Z3i::Point( 17, 3, 19 ) ) );
+      Z3i::Point lower, upper;
+      set.computeBoundingBox( lower, upper );
+      REQUIRE( lower == Z3i::Point( 3, 2, 0 ) );
+      REQUIRE( upper == Z3i::Point( 17, 20, 19 ) );
+
+      REQUIRE( set.erase( Z3i::Point( 3, 4, 5 ) ) == 1 );
+      REQUIRE( set.erase( Z3i::Point( 3, 4, 5 ) ) == 0 );
+      set.erase( set.find( Z3i::Point( 9, 20, 0 ) ) );
+      REQUIRE( set.size() == 1 );
+      REQUIRE( *set.begin() == Z3i::Point( 17, 2, 19 ) );
+
+      Set3 complement( domain );
+      complement.assignFromComplement( set );
+      REQUIRE( complement.size() == domain.size() - 1 );
+      REQUIRE( ! complement( Z3i::Point( 17, 2, 19 ) ) );
+      REQUIRE( complement.isValid() );
+      Set3 other( domain );
+      DigitalSetInserter<Set3> inserter( other );
+      set.computeComplement( inserter );
+      REQUIRE( other.size() == complement.size() );
+
+      complement += set;
+      REQUIRE( complement.size() == domain.size() );
+      complement.erase( complement.begin(), complement.end() );
+      REQUIRE( complement.empty() );
+      REQUIRE( complement.isValid() );
+      REQUIRE( complement.nbBricks() > 0 );
+      complement.prune();
+      REQUIRE( complement.nbBricks() == 0 );
+      REQUIRE( complement.begin() == complement.end() );
+    }
+
+  SECTION( "Bulk creation from a digital set and pruning" )
+    {
+      Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( 2047 ) );
+      Z3i::Domain ballDomain( Z3i::Point::diagonal( 1000 ), Z3i::Point::diagonal( 1040 ) );
+      Z3i::DigitalSet ball( ballDomain );
+      for ( auto const & p : ballDomain )
+        if ( ( p - Z3i::Point::diagonal( 1020 ) ).squaredNorm() <= 400 )
+          ball.insertNew( p );
+      Image3 image( domain );
+      image.setValues( ball.begin(), ball.end(), 3 );
+      REQUIRE( image.size() == ball.size() );
+      REQUIRE( image.isValid() );
+      // A 2048^3 domain with a ball of radius 20 needs a few hundred bricks.
+      REQUIRE( image.nbBricks() < 400 );
+      REQUIRE( image.memoryUsage() < 2 * 1024 * 1024 );
+      std::size_t nb = 0;
+      for ( auto const & p : image )
+        nb += ( ball( p ) && image( p ) == 3 ) ? 1 : 0;
+      REQUIRE( nb == ball.size() );
+
+      // Only keep one octant, then release empty bricks.
+      for ( auto const & p : ball )
+        if ( p[ 0 ] < 1020 || p[ 1 ] < 1020 || p[ 2 ] < 1020 )
+          image.setValue( p, 0 );
+      const auto nbBricks = image.nbBricks();
+      image.prune();
+      REQUIRE( image.nbBricks() < nbBricks );
+      REQUIRE( image.isValid() );
+      REQUIRE( image( Z3i::Point::diagonal( 1025 ) ) == 3 );
+      REQUIRE( image( Z3i::Point::diagonal( 1015 ) ) == 0 );
+      REQUIRE( std::distance( image.begin(), image.end() ) == (std::ptrdiff_t) image.size() );
+    }
+}
+
+/** @ingroup Tests **/
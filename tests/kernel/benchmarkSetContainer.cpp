@@ -37,6 +37,7 @@
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
+#include "DGtal/kernel/sets/DigitalSetByBitArray.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
 
 #include "DGtal/kernel/PointHashFunctions.h"
@@ -54,10 +55,12 @@ using namespace DGtal;
 typedef DGtal::DigitalSetBySTLSet< Z2i::Domain> FromSet;
 typedef DGtal::DigitalSetBySTLVector< Z2i::Domain> FromVector;
 typedef DGtal::DigitalSetByAssociativeContainer< Z2i::Domain, std::unordered_set<Z2i::Point> > FromUnordered;
+typedef DGtal::DigitalSetByBitArray< Z2i::Domain> FromBitArray;
 
 typedef DGtal::DigitalSetBySTLSet< Z3i::Domain> FromSet3;
 typedef DGtal::DigitalSetBySTLVector< Z3i::Domain> FromVector3;
 typedef DGtal::DigitalSetByAssociativeContainer< Z3i::Domain, std::unordered_set<Z3i::Point> > FromUnordered3;
+typedef DGtal::DigitalSetByBitArray< Z3i::Domain> FromBitArray3;
 
 template<typename Q>
 static void BM_Constructor(benchmark::State& state)
@@ -74,9 +77,11 @@ static void BM_Constructor(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_Constructor, FromVector)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromSet)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromUnordered)->Range(1<<3 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_Constructor, FromBitArray)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromVector3)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromSet3)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromUnordered3)->Range(1<<3 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_Constructor, FromBitArray3)->Range(1<<3 , 1 << 8);
 
 
 template<typename Q>
@@ -97,6 +102,7 @@ static void BM_insert(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_insert, FromVector);
 BENCHMARK_TEMPLATE(BM_insert, FromSet);
 BENCHMARK_TEMPLATE(BM_insert, FromUnordered);
+BENCHMARK_TEMPLATE(BM_insert, FromBitArray);
 BENCHMARK_TEMPLATE(BM_insert, FromVector3);
 BENCHMARK_TEMPLATE(BM_insert, FromSet3);
 BENCHMARK_TEMPLATE(BM_insert, FromUnordered3);
@@ -124,10 +130,82 @@ static void BM_iterate(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_iterate, FromVector)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromSet)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromUnordered)->Range(1<<3 , 1 << 10);;
+BENCHMARK_TEMPLATE(BM_iterate, FromBitArray)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromVector3)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromSet3)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromUnordered3)->Range(1<<3 , 1 << 10);;
 
+// The bit array is not benchmarked above in 3D since the domain
+// [0,2048]^3 would require 1GB of bits. Dense sets are benchmarked
+// below in the domain [0,N]^3.
+
+template<typename Q>
+static void fillDense(Q& myset, unsigned int percent)
+{
+  for(auto const& p : myset.domain())
+    if ( (unsigned int)(rand() % 100) < percent )
+      myset.insertNew( p );
+}
+
+template<typename Q>
+static void BM_denseIterate(benchmark::State& state)
+{
+  typename Q::Domain dom( Q::Point::diagonal(0),
+                          Q::Point::diagonal((typename Q::Domain::Space::Integer)state.range(0)));
+  Q myset( dom );
+  fillDense( myset, 50 );
+  while (state.KeepRunning())
+    {
+      for(typename Q::ConstIterator it= myset.begin(), itend=myset.end(); it != itend;
+          ++it)
+        benchmark::DoNotOptimize(*it);
+    }
+}
+BENCHMARK_TEMPLATE(BM_denseIterate, FromVector3)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_denseIterate, FromSet3)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_denseIterate, FromUnordered3)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_denseIterate, FromBitArray3)->Range(1<<4 , 1 << 7);
+
+template<typename Q>
+static void BM_denseUnion(benchmark::State& state)
+{
+  typename Q::Domain dom( Q::Point::diagonal(0),
+                          Q::Point::diagonal((typename Q::Domain::Space::Integer)state.range(0)));
+  Q setA( dom ), setB( dom );
+  fillDense( setA, 50 );
+  fillDense( setB, 50 );
+  while (state.KeepRunning())
+    {
+      state.PauseTiming();
+      Q result( setA );
+      state.ResumeTiming();
+      result += setB;
+      benchmark::DoNotOptimize( result.size() );
+    }
+}
+BENCHMARK_TEMPLATE(BM_denseUnion, FromVector3)->Range(1<<4 , 1 << 6);
+BENCHMARK_TEMPLATE(BM_denseUnion, FromSet3)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_denseUnion, FromUnordered3)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_denseUnion, FromBitArray3)->Range(1<<4 , 1 << 7);
+
+template<typename Q>
+static void BM_denseBelonging(benchmark::State& state)
+{
+  typename Q::Domain dom( Q::Point::diagonal(0),
+                          Q::Point::diagonal((typename Q::Domain::Space::Integer)state.range(0)));
+  Q myset( dom );
+  fillDense( myset, 50 );
+  while (state.KeepRunning())
+    {
+      unsigned int nb = 0;
+      for(auto const& p : dom)
+        nb += myset( p ) ? 1 : 0;
+      benchmark::DoNotOptimize( nb );
+    }
+}
+BENCHMARK_TEMPLATE(BM_denseBelonging, FromSet3)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_denseBelonging, FromUnordered3)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_denseBelonging, FromBitArray3)->Range(1<<4 , 1 << 7);
 
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
@@ -52,6 +52,7 @@
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
+#include "DGtal/kernel/sets/DigitalSetByBitArray.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/kernel/sets/DigitalSetDomain.h"
@@ -367,6 +368,93 @@ bool testDigitalSetDomain()
   return nbok == nb;
 }
 
+bool testDigitalSetByBitArrayOperations()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef Z3i::Domain Domain;
+  typedef Z3i::Point Point;
+  typedef DigitalSetByBitArray<Domain> BitSet;
+  typedef std::set<Point> RefSet;
+  BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet< BitSet > ));
+
+  trace.beginBlock ( "Word-parallel operations of DigitalSetByBitArray ..." );
+  // 13*7*5 points, which is not a multiple of 64.
+  Domain domain( Point( -3, 2, -1 ), Point( 9, 8, 3 ) );
+  BitSet A( domain ), B( domain );
+  RefSet refA, refB;
+  srand( 0 );
+  for ( auto const & p : domain )
+    {
+      if ( rand() % 3 == 0 ) { A.insert( p ); refA.insert( p ); }
+      if ( rand() % 2 == 0 ) { B.insert( p ); refB.insert( p ); }
+    }
+  INBLOCK_TEST( A.isValid() && B.isValid() );
+  INBLOCK_TEST( A.size() == refA.size() && A.count() == refA.size() );
+  INBLOCK_TEST( RefSet( A.begin(), A.end() ) == refA );
+  INBLOCK_TEST( ( boost::is_same< DigitalSetSelector< Domain, WHOLE_DS + HIGH_BEL_DS >::Type,
+                                  BitSet >::value ) );
+
+  RefSet refI, refU, refD, refS;
+  std::set_intersection( refA.begin(), refA.end(), refB.begin(), refB.end(),
+                         std::inserter( refI, refI.begin() ) );
+  std::set_union( refA.begin(), refA.end(), refB.begin(), refB.end(),
+                  std::inserter( refU, refU.begin() ) );
+  std::set_difference( refA.begin(), refA.end(), refB.begin(), refB.end(),
+                       std::inserter( refD, refD.begin() ) );
+  std::set_symmetric_difference( refA.begin(), refA.end(), refB.begin(), refB.end(),
+                                 std::inserter( refS, refS.begin() ) );
+  INBLOCK_TEST( A.countIntersection( B ) == refI.size() );
+  BitSet I( A ); I.assignIntersection( B );
+  BitSet U( A ); U += B;
+  BitSet D( A ); D.assignDifference( B );
+  BitSet S( A ); S.assignSymmetricDifference( B );
+  INBLOCK_TEST( I.size() == refI.size() && RefSet( I.begin(), I.end() ) == refI );
+  INBLOCK_TEST( U.size() == refU.size() && RefSet( U.begin(), U.end() ) == refU );
+  INBLOCK_TEST( D.size() == refD.size() && RefSet( D.begin(), D.end() ) == refD );
+  INBLOCK_TEST( S.size() == refS.size() && RefSet( S.begin(), S.end() ) == refS );
+  INBLOCK_TEST( I.isValid() && U.isValid() && D.isValid() && S.isValid() );
+
+  // Complement and bounding box.
+  BitSet C( domain );
+  C.assignFromComplement( A );
+  INBLOCK_TEST( C.isValid() && C.size() + A.size() == domain.size()
+                && C.countIntersection( A ) == 0 );
+  std::vector<Point> complement;
+  std::back_insert_iterator< std::vector<Point> > ito( complement );
+  A.computeComplement( ito );
+  INBLOCK_TEST( RefSet( complement.begin(), complement.end() ) == RefSet( C.begin(), C.end() ) );
+  Point lower, upper;
+  BitSet E( domain );
+  E.insert( Point( 0, 7, 0 ) ); E.insert( Point( 5, 3, 2 ) ); E.insert( Point( -2, 4, 3 ) );
+  E.computeBoundingBox( lower, upper );
+  INBLOCK_TEST( lower == Point( -2, 3, 0 ) && upper == Point( 5, 7, 3 ) );
+
+  // Operations between sets of different domains.
+  BitSet F( Domain( Point( 0, 0, 0 ), Point( 4, 4, 4 ) ) );
+  for ( auto const & p : F.domain() ) F.insert( p );
+  BitSet G( A ); G.assignIntersection( F );
+  BitSet H( A ); H += F;
+  std::size_t nbG = 0, nbH = 0;
+  for ( auto const & p : domain )
+    {
+      nbG += ( refA.count( p ) && F( p ) ) ? 1 : 0;
+      nbH += ( refA.count( p ) || F( p ) ) ? 1 : 0;
+    }
+  INBLOCK_TEST( G.size() == nbG && H.size() == nbH && G.isValid() && H.isValid() );
+
+  // Erasure while iterating.
+  for ( BitSet::Iterator it = U.begin(), itE = U.end(); it != itE; ++it )
+    if ( ! B( *it ) ) U.erase( it );
+  INBLOCK_TEST( U.isValid() && U.size() == refB.size() );
+  U.erase( U.begin(), U.end() );
+  INBLOCK_TEST( U.empty() && U.isValid() );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 bool testDigitalSetConcept()
 {
   BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet<Z2i::DigitalSet> ));
@@ -428,6 +516,11 @@ int main()
   ( DigitalSetByAssociativeContainer<Domain, ContainerU>(domain), DigitalSetByAssociativeContainer<Domain, ContainerU>(domain) );
   trace.endBlock();
 
+  trace.beginBlock( "DigitalSetByBitArray" );
+  bool okBitArray = testDigitalSet< DigitalSetByBitArray<Domain> >
+  ( DigitalSetByBitArray<Domain>(domain), DigitalSetByBitArray<Domain>(domain) );
+  trace.endBlock();
+
   bool okSelectorSmall = testDigitalSetSelector
       < Domain, SMALL_DS + LOW_VAR_DS + LOW_ITER_DS + LOW_BEL_DS >
       ( domain, "Small set" );
@@ -440,6 +533,12 @@ int main()
       < Domain, MEDIUM_DS + LOW_VAR_DS + LOW_ITER_DS + HIGH_BEL_DS >
       ( domain, "Medium set + High belonging test" );
 
+  bool okSelectorWhole = testDigitalSetSelector
+      < Domain, WHOLE_DS + LOW_VAR_DS + HIGH_ITER_DS + HIGH_BEL_DS >
+      ( domain, "Whole set + High belonging test" );
+
+  bool okBitArrayOperations = testDigitalSetByBitArrayOperations();
+
   bool okDigitalSetDomain = testDigitalSetDomain();
 
   bool okDigitalSetDraw = testDigitalSetDraw();
@@ -449,7 +548,8 @@ int main()
   bool res = okVector && okSet && okMap
       && okSelectorSmall && okSelectorBig && okSelectorMediumHBel
       && okDigitalSetDomain && okDigitalSetDraw && okDigitalSetDrawSnippet
-     && okUnorderedSet && okAssoctestSet;
+     && okUnorderedSet && okAssoctestSet && okBitArray
+     && okSelectorWhole && okBitArrayOperations;
   trace.endBlock();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   return res ? 0 : 1;
@@ -0,0 +1,223 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFlatLatticeSetByIntervals.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class FlatLatticeSetByIntervals.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/LatticeSetByIntervals.h"
+#include "DGtal/kernel/FlatLatticeSetByIntervals.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class FlatLatticeSetByIntervals.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "FlatLatticeSetByIntervals< Z3 > unit tests", "[flat_lattice_set]" )
+{
+  typedef DGtal::Z3i::Space   Space;
+  typedef Space::Point Point;
+  typedef LatticeSetByIntervals< Space >     LatticeSet;
+  typedef FlatLatticeSetByIntervals< Space > FlatLatticeSet;
+
+  std::vector< Point > X;
+  for ( unsigned int i = 0; i < 2000; i++ )
+    X.push_back( Point( rand() % 20, rand() % 20, rand() % 20 ) );
+  THEN( "The flat lattice set contains the same points as the lattice set" ) {
+    for ( Dimension a = 0; a < 3; a++ )
+      {
+        LatticeSet     L( X.cbegin(), X.cend(), a );
+        FlatLatticeSet F( X.cbegin(), X.cend(), a );
+        auto vec_L = L.toPointRange();
+        auto vec_F = F.toPointRange();
+        REQUIRE( F.isValid() );
+        REQUIRE( F.axis() == a );
+        REQUIRE( F.size() == L.size() );
+        REQUIRE( vec_F == vec_L );
+        for ( const auto& p : X ) REQUIRE( F.count( p ) == 1 );
+        REQUIRE( F.count( Point( 20, 20, 20 ) ) == 0 );
+        REQUIRE( F.count( Point( -1, 3, 3 ) ) == 0 );
+      }
+  }
+  THEN( "Conversions to and from lattice sets are inverse" ) {
+    for ( Dimension a = 0; a < 3; a++ )
+      {
+        LatticeSet     L( X.cbegin(), X.cend(), a );
+        FlatLatticeSet F( X.cbegin(), X.cend(), a );
+        FlatLatticeSet G( L );
+        REQUIRE( G.isValid() );
+        REQUIRE( G.equals( F ) );
+        REQUIRE( F.toLatticeSet().equals( L ) );
+      }
+  }
+  THEN( "Moves keep the data and swap empties" ) {
+    FlatLatticeSet F( X.cbegin(), X.cend(), 2 );
+    FlatLatticeSet G( F );
+    const Point* rows = &G.row( 0 );
+    FlatLatticeSet H( std::move( G ) );
+    REQUIRE( &H.row( 0 ) == rows );
+    REQUIRE( H.equals( F ) );
+    FlatLatticeSet E( 2 );
+    E.swap( H );
+    REQUIRE( H.empty() );
+    REQUIRE( E.equals( F ) );
+  }
+}
+
+SCENARIO( "FlatLatticeSetByIntervals< Z3 > set operations tests", "[flat_lattice_set]" )
+{
+  typedef DGtal::Z3i::Space   Space;
+  typedef Space::Point Point;
+  typedef LatticeSetByIntervals< Space >     LatticeSet;
+  typedef FlatLatticeSetByIntervals< Space > FlatLatticeSet;
+
+  std::vector< Point > X, Y;
+  for ( unsigned int i = 0; i < 3000; i++ )
+    {
+      X.push_back( Point( rand() % 15, rand() % 15, rand() % 15 ) );
+      Y.push_back( Point( rand() % 15, rand() % 15, rand() % 15 ) + Point( 5, 0, 0 ) );
+    }
+  const LatticeSet     LX( X.cbegin(), X.cend(), 1 ), LY( Y.cbegin(), Y.cend(), 1 );
+  const FlatLatticeSet FX( X.cbegin(), X.cend(), 1 ), FY( Y.cbegin(), Y.cend(), 1 );
+  THEN( "Union, intersection and difference are the same as for lattice sets" ) {
+    const auto U = FX.set_union( FY );
+    const auto I = FX.set_intersection( FY );
+    const auto D = FX.set_difference( FY );
+    REQUIRE( U.isValid() );
+    REQUIRE( I.isValid() );
+    REQUIRE( D.isValid() );
+    REQUIRE( U.equals( FlatLatticeSet( LX.set_union( LY ) ) ) );
+    REQUIRE( I.equals( FlatLatticeSet( LX.set_intersection( LY ) ) ) );
+    REQUIRE( D.equals( FlatLatticeSet( LX.set_difference( LY ) ) ) );
+    REQUIRE( U.size() + I.size() == FX.size() + FY.size() );
+  }
+  THEN( "Inclusions are correct" ) {
+    const auto U = FX.set_union( FY );
+    const auto I = FX.set_intersection( FY );
+    REQUIRE( U.includes( FX ) );
+    REQUIRE( U.includes( FY ) );
+    REQUIRE( FX.includes( I ) );
+    REQUIRE( FY.includes( I ) );
+    REQUIRE( ! FX.includes( FY ) );
+    REQUIRE( ! I.includes( FX ) );
+  }
+  THEN( "In-place add and subtract are consistent" ) {
+    FlatLatticeSet Z( FX );
+    Z.add( FY );
+    REQUIRE( Z.equals( FX.set_union( FY ) ) );
+    Z.subtract( FY );
+    REQUIRE( Z.equals( FX.set_difference( FY ) ) );
+    Z.subtract( FX );
+    REQUIRE( Z.empty() );
+  }
+}
+
+SCENARIO( "FlatLatticeSetByIntervals< Z3 > topology operations tests", "[flat_lattice_set][3d]" )
+{
+  typedef DGtal::Z3i::Space   Space;
+  typedef Space::Point Point;
+  typedef LatticeSetByIntervals< Space >     LatticeSet;
+  typedef FlatLatticeSetByIntervals< Space > FlatLatticeSet;
+
+  std::vector< Point > X, C;
+  for ( unsigned int i = 0; i < 300; i++ )
+    X.push_back( Point( rand() % 10, rand() % 10, rand() % 10 ) );
+  for ( unsigned int i = 0; i < 1000; i++ )
+    C.push_back( Point( rand() % 20, rand() % 20, rand() % 20 ) );
+  const auto threads = ParallelPolicy::threads( 3 );
+  THEN( "Stars, skeletons and extrema are the same as for lattice sets" ) {
+    for ( Dimension a = 0; a < 3; a++ )
+      {
+        const LatticeSet     LX( X.cbegin(), X.cend(), a ), LC( C.cbegin(), C.cend(), a );
+        const FlatLatticeSet FX( X.cbegin(), X.cend(), a ), FC( C.cbegin(), C.cend(), a );
+        const auto StarX = FX.starOfPoints();
+        const auto StarC = FC.starOfCells();
+        const auto SkelC = FC.skeletonOfCells();
+        REQUIRE( StarX.isValid() );
+        REQUIRE( StarC.isValid() );
+        REQUIRE( SkelC.isValid() );
+        REQUIRE( StarX.toLatticeSet().equals( LX.starOfPoints() ) );
+        REQUIRE( StarC.toLatticeSet().equals( LC.starOfCells() ) );
+        REQUIRE( SkelC.toLatticeSet().equals( LC.skeletonOfCells() ) );
+        REQUIRE( FC.extremaOfCells() == LC.extremaOfCells() );
+        REQUIRE( StarX.extremaOfCells() == LX.starOfPoints().extremaOfCells() );
+        REQUIRE( StarC.extremaOfCells() == LC.starOfCells().extremaOfCells() );
+      }
+  }
+  THEN( "Skel(Star(X)) = X, Star(C) = Star(Skel(Star(C))) and Skel(C) subset C subset Star(C)" ) {
+    for ( Dimension a = 0; a < 3; a++ )
+      {
+        const FlatLatticeSet FX( X.cbegin(), X.cend(), a ), FC( C.cbegin(), C.cend(), a );
+        const auto StarX = FX.starOfPoints();
+        const auto StarC = FC.starOfCells();
+        REQUIRE( StarX.skeletonOfCells().size() == FX.size() );
+        REQUIRE( StarC.equals( StarC.skeletonOfCells().starOfCells() ) );
+        REQUIRE( StarC.includes( FC ) );
+        REQUIRE( FC.includes( FC.skeletonOfCells() ) );
+      }
+  }
+  THEN( "Row-parallel computations give the same results" ) {
+    for ( Dimension a = 0; a < 3; a++ )
+      {
+        const FlatLatticeSet FX( X.cbegin(), X.cend(), a ), FC( C.cbegin(), C.cend(), a );
+        REQUIRE( FX.starOfPoints( threads ).equals( FX.starOfPoints() ) );
+        REQUIRE( FC.starOfCells( threads ).equals( FC.starOfCells() ) );
+        REQUIRE( FC.skeletonOfCells( threads ).equals( FC.skeletonOfCells() ) );
+      }
+  }
+}
+
+SCENARIO( "FlatLatticeSetByIntervals< Z2 > topology operations tests", "[flat_lattice_set][2d]" )
+{
+  typedef DGtal::Z2i::Space   Space;
+  typedef Space::Point Point;
+  typedef LatticeSetByIntervals< Space >     LatticeSet;
+  typedef FlatLatticeSetByIntervals< Space > FlatLatticeSet;
+
+  std::vector< Point > C;
+  for ( unsigned int i = 0; i < 200; i++ )
+    C.push_back( Point( rand() % 30, rand() % 30 ) );
+  const LatticeSet     LC( C.cbegin(), C.cend(), 1 );
+  const FlatLatticeSet FC( C.cbegin(), C.cend(), 1 );
+  THEN( "Star, skeleton and extrema of cells are the same as for lattice sets" ) {
+    REQUIRE( FC.starOfCells().toLatticeSet().equals( LC.starOfCells() ) );
+    REQUIRE( FC.skeletonOfCells().toLatticeSet().equals( LC.skeletonOfCells() ) );
+    REQUIRE( FC.starOfCells( ParallelPolicy::threads( 2 ) ).skeletonOfCells()
+             .toLatticeSet().equals( LC.starOfCells().skeletonOfCells() ) );
+    REQUIRE( FC.extremaOfCells() == LC.extremaOfCells() );
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -26,8 +26,10 @@
  */
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <random>
 #include "ConfigTest.h"
 #include "DGtalCatch.h"
+#include "DGtal/base/ParallelPolicy.h"
 #include "DGtal/shapes/MeshVoxelizer.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
@@ -229,3 +231,146 @@ TEST_CASE("Basic voxelization test", "[voxelization]")
     REQUIRE( outputSet.size() == 4162 );
   }
 }
+
+TEST_CASE("Parallel and solid voxelization test", "[voxelization][solid]")
+{
+  using MeshVoxelizer6 = MeshVoxelizer< DigitalSet, 6>;
+  using MeshVoxelizer26 = MeshVoxelizer< DigitalSet, 26>;
+
+  Mesh<Z3i::RealPoint> box;
+  MeshReader<Z3i::RealPoint>::importOFFFile(testPath +"/samples/box.off" , box);
+  Z3i::Domain domain( Point().diagonal(-30), Point().diagonal(30));
+  // The box, scaled by 10, is |x|+|y| <= 16.32993, |z| <= 11.54701.
+  auto inBox = [] ( const Point& p, double e )
+    {
+      return std::abs( p[0] ) + std::abs( p[1] ) <= 16.32993 + e
+        && std::abs( p[2] ) <= 11.54701 + e;
+    };
+  // Digital sets are unordered: compares their contents.
+  auto sameSet = [] ( const DigitalSet& X, const DigitalSet& Y )
+    {
+      if ( X.size() != Y.size() ) return false;
+      for ( auto p : X )
+        if ( ! Y( p ) ) return false;
+      return true;
+    };
+
+  // ---------------------------------------------------------
+  SECTION("Voxelization does not depend on the number of threads")
+  {
+    MeshVoxelizer6 voxelizer6;
+    MeshVoxelizer26 voxelizer26;
+    DigitalSet seq6( domain ), par6( domain ), seq26( domain ), par26( domain );
+    voxelizer6.voxelize( seq6, box, 10.0, ParallelPolicy::sequential() );
+    voxelizer6.voxelize( par6, box, 10.0, ParallelPolicy::threads( 3 ) );
+    voxelizer26.voxelize( seq26, box, 10.0, ParallelPolicy::sequential() );
+    voxelizer26.voxelize( par26, box, 10.0, ParallelPolicy::threads( 3 ) );
+    REQUIRE( seq6.size() == 2562 );
+    REQUIRE( seq26.size() == 4162 );
+    REQUIRE( sameSet( seq6, par6 ) );
+    REQUIRE( sameSet( seq26, par26 ) );
+  }
+
+  // ---------------------------------------------------------
+  SECTION("6-sep solid voxelization of a OFF cube mesh")
+  {
+    MeshVoxelizer6 voxelizer;
+    DigitalSet surface( domain ), solid( domain ), solid_par( domain );
+    voxelizer.voxelize( surface, box, 10.0 );
+    voxelizer.voxelizeSolid( solid, box, 10.0, ParallelPolicy::sequential() );
+    voxelizer.voxelizeSolid( solid_par, box, 10.0, ParallelPolicy::threads( 3 ) );
+    std::size_t nb_interior = 0, nb_missing = 0, nb_extra = 0;
+    for ( auto p : domain )
+    {
+      const bool interior = inBox( p, -1e-6 );
+      nb_interior += interior ? 1 : 0;
+      nb_missing  += ( interior || surface( p ) ) && ! solid( p ) ? 1 : 0;
+      nb_extra    += solid( p ) && ! inBox( p, 1e-6 ) && ! surface( p ) ? 1 : 0;
+    }
+    CAPTURE( solid.size() );
+    REQUIRE( nb_interior > 0 );
+    REQUIRE( nb_missing == 0 );
+    REQUIRE( nb_extra == 0 );
+    REQUIRE( sameSet( solid, solid_par ) );
+  }
+
+  // ---------------------------------------------------------
+  SECTION("Solid voxelization of a cube whose rays go through edges and vertices")
+  {
+    // Cube [-5,5]^3 made of 12 triangles, all vertices and diagonals
+    // are on voxel centers.
+    Mesh<Z3i::RealPoint> cube;
+    for ( int i = 0; i < 8; i++ )
+      cube.addVertex( Z3i::RealPoint( i & 1 ? 5 : -5, i & 2 ? 5 : -5, i & 4 ? 5 : -5 ) );
+    const int quads[ 6 ][ 4 ] = { { 0, 2, 3, 1 }, { 4, 5, 7, 6 }, { 0, 1, 5, 4 },
+                                  { 2, 6, 7, 3 }, { 0, 4, 6, 2 }, { 1, 3, 7, 5 } };
+    for ( auto q : quads )
+    {
+      cube.addTriangularFace( q[0], q[1], q[2] );
+      cube.addTriangularFace( q[0], q[2], q[3] );
+    }
+    MeshVoxelizer26 voxelizer;
+    DigitalSet solid( domain );
+    voxelizer.voxelizeSolid( solid, cube, 1.0, ParallelPolicy::threads( 2 ) );
+    DigitalSet surface( domain );
+    voxelizer.voxelize( surface, cube );
+    std::size_t nb_missing = 0, nb_extra = 0;
+    for ( auto p : domain )
+    {
+      const bool inCube = p.sup( Point::diagonal( -5 ) ) == p && p.inf( Point::diagonal( 5 ) ) == p;
+      nb_missing += inCube && ! solid( p ) ? 1 : 0;
+      nb_extra   += ! inCube && solid( p ) && ! surface( p ) ? 1 : 0;
+    }
+    REQUIRE( nb_missing == 0 );
+    REQUIRE( nb_extra == 0 );
+  }
+
+  // ---------------------------------------------------------
+  SECTION("Solid voxelization of prisms with non-integer vertices whose edges go through voxel centers")
+  {
+    // Prisms over quadrilaterals P0 P1 P2 P3 with non-integer vertices,
+    // whose diagonal P0 P2 lies on the line 3x = 2y, which goes through
+    // voxel centers. The top face is split along P0 P2, the bottom
+    // face along P1 P3, and vertical faces are parallel to the rays.
+    std::mt19937 gen( 0 );
+    std::uniform_real_distribution< double > offset( 0.01, 0.99 );
+    const Domain inner( Point::diagonal( -20 ), Point::diagonal( 20 ) );
+    const int quads[ 6 ][ 4 ] = { { 1, 0, 3, 2 }, { 4, 5, 6, 7 }, { 0, 1, 5, 4 },
+                                  { 1, 2, 6, 5 }, { 2, 3, 7, 6 }, { 3, 0, 4, 7 } };
+    std::size_t nb_missing = 0, nb_extra = 0;
+    for ( int trial = 0; trial < 20; trial++ )
+    {
+      const double s0 = -3. - offset( gen ), s2 = 3. + offset( gen );
+      const double r1 = 2. + offset( gen ), r3 = 2. + offset( gen );
+      const double c = -8. - offset( gen ), d = 8. + offset( gen );
+      const double P[ 4 ][ 2 ] = { { 2. * s0, 3. * s0 }, { 3. * r1, -2. * r1 },
+                                   { 2. * s2, 3. * s2 }, { -3. * r3, 2. * r3 } };
+      Mesh<Z3i::RealPoint> prism;
+      for ( int i = 0; i < 8; i++ )
+        prism.addVertex( Z3i::RealPoint( P[ i % 4 ][ 0 ], P[ i % 4 ][ 1 ], i < 4 ? c : d ) );
+      for ( auto q : quads )
+      {
+        prism.addTriangularFace( q[0], q[1], q[2] );
+        prism.addTriangularFace( q[0], q[2], q[3] );
+      }
+      MeshVoxelizer26 voxelizer;
+      DigitalSet solid( domain ), surface( domain );
+      voxelizer.voxelizeSolid( solid, prism, 1.0, ParallelPolicy::sequential() );
+      voxelizer.voxelize( surface, prism );
+      for ( auto p : inner )
+      {
+        bool inPrism = p[2] >= c && p[2] <= d;
+        for ( int i = 0; i < 4 && inPrism; i++ )
+        {
+          const double* A = P[ i ];
+          const double* B = P[ ( i + 1 ) % 4 ];
+          inPrism = ( B[0] - A[0] ) * ( p[1] - A[1] ) - ( B[1] - A[1] ) * ( p[0] - A[0] ) > 0.;
+        }
+        nb_missing += inPrism && ! solid( p ) ? 1 : 0;
+        nb_extra   += ! inPrism && solid( p ) && ! surface( p ) ? 1 : 0;
+      }
+    }
+    REQUIRE( nb_missing == 0 );
+    REQUIRE( nb_extra == 0 );
+  }
+}
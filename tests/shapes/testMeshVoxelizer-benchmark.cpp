@@ -0,0 +1,120 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMeshVoxelizer-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmarks the surface and solid voxelizations of a triangulated
+ * torus by MeshVoxelizer, compared to the insertion of triangles one
+ * by one into the output set.
+ *
+ * Usage: testMeshVoxelizer-benchmark [resolution [threads]]
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/base/ParallelPolicy.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/DigitalSetByBitArray.h"
+#include "DGtal/shapes/Mesh.h"
+#include "DGtal/shapes/SurfaceMeshHelper.h"
+#include "DGtal/shapes/MeshVoxelizer.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Z3i::RealPoint                                 RealPoint;
+typedef DigitalSetByBitArray< Z3i::Domain >            BitSet;
+typedef MeshVoxelizer< BitSet, 6 >                     Voxelizer;
+typedef SurfaceMeshHelper< RealPoint, RealPoint >      SMH;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class MeshVoxelizer.
+///////////////////////////////////////////////////////////////////////////////
+
+bool benchmarkMeshVoxelizer( int resolution, unsigned int nb_threads )
+{
+  // A torus of outer radius 1 with small triangles, scaled to the resolution.
+  const auto torus = SMH::makeTorus( 0.7, 0.3, RealPoint::zero, 400, 200, 0,
+                                     SMH::NormalsType::NO_NORMALS );
+  Mesh< RealPoint > mesh;
+  for ( const auto& x : torus.positions() ) mesh.addVertex( x );
+  for ( const auto& f : torus.allIncidentVertices() )
+    mesh.addFace( Mesh< RealPoint >::MeshFace( f.cbegin(), f.cend() ) );
+  const double scale = 0.5 * ( resolution - 2 );
+  const Z3i::Domain domain( Z3i::Point::diagonal( -resolution / 2 ),
+                            Z3i::Point::diagonal( resolution / 2 - 1 ) );
+  trace.beginBlock( "Voxelization of " + std::to_string( mesh.nbFaces() )
+                    + " triangles in " + std::to_string( resolution ) + "^3" );
+  Voxelizer voxelizer;
+  Clock c;
+  c.startClock();
+  BitSet one_by_one( domain );
+  for ( Mesh< RealPoint >::Size i = 0; i < mesh.nbFaces(); ++i )
+    {
+      const auto& f = mesh.getFace( i );
+      for ( std::size_t j = 0; j + 2 < f.size(); ++j )
+        voxelizer.voxelize( one_by_one, mesh.getVertex( f[ 0 ] ), mesh.getVertex( f[ j+1 ] ),
+                            mesh.getVertex( f[ j+2 ] ), scale );
+    }
+  trace.info() << "triangles one by one: " << c.stopClock() << " ms"
+               << ", #voxels=" << one_by_one.size() << std::endl;
+  bool ok = true;
+  for ( auto policy : { ParallelPolicy::sequential(), ParallelPolicy::threads( nb_threads ) } )
+    {
+      BitSet surface( domain ), solid( domain );
+      c.startClock();
+      voxelizer.voxelize( surface, mesh, scale, policy );
+      trace.info() << "surface, " << policy.nbThreads() << " thread(s): "
+                   << c.stopClock() << " ms" << std::endl;
+      c.startClock();
+      voxelizer.voxelizeSolid( solid, mesh, scale, policy );
+      trace.info() << "solid, " << policy.nbThreads() << " thread(s): "
+                   << c.stopClock() << " ms, #voxels=" << solid.size() << std::endl;
+      ok = ok && surface.size() == one_by_one.size()
+        && surface.countIntersection( one_by_one ) == one_by_one.size()
+        && solid.countIntersection( surface ) == surface.size();
+    }
+  trace.endBlock();
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class MeshVoxelizer" );
+  std::vector< int > resolutions = { 128, 512 };
+  if ( argc > 1 ) resolutions = { atoi( argv[ 1 ] ) };
+  const unsigned int t = argc > 2 ? atoi( argv[ 2 ] ) : 0;
+  bool res = true;
+  for ( auto r : resolutions )
+    res = benchmarkMeshVoxelizer( r, t ) && res;
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
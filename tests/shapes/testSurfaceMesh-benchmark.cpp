@@ -0,0 +1,132 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfaceMesh-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmarks the construction of a SurfaceMesh (from faces and from
+ * an OBJ stream), the look-up of its edges and the extraction of its
+ * boundary.
+ *
+ * Usage: testSurfaceMesh-benchmark [m [n]]
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <sstream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/shapes/SurfaceMesh.h"
+#include "DGtal/shapes/SurfaceMeshHelper.h"
+#include "DGtal/io/readers/SurfaceMeshReader.h"
+#include "DGtal/io/writers/SurfaceMeshWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef PointVector<3,double>                      RealPoint;
+typedef PointVector<3,double>                      RealVector;
+typedef SurfaceMesh< RealPoint, RealVector >       PolygonMesh;
+typedef SurfaceMeshHelper< RealPoint, RealVector > PolygonMeshHelper;
+typedef SurfaceMeshReader< RealPoint, RealVector > PolygonMeshReader;
+typedef SurfaceMeshWriter< RealPoint, RealVector > PolygonMeshWriter;
+typedef PolygonMeshHelper::NormalsType             NormalsType;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class SurfaceMesh.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Builds a torus with m latitudes and n longitudes from its faces and
+ * from an OBJ stream, looks up all its edges, and extracts the
+ * boundary of a lantern of the same size.
+ */
+bool benchmarkSurfaceMesh( std::size_t m, std::size_t n )
+{
+  trace.beginBlock( "SurfaceMesh of " + std::to_string( m ) + "x"
+                    + std::to_string( n ) + " quads" );
+  bool ok = true;
+  const auto torus = PolygonMeshHelper::makeTorus( 3.0, 1.0, RealPoint::zero, m, n, 0,
+                                                   NormalsType::NO_NORMALS );
+  Clock c;
+  c.startClock();
+  PolygonMesh mesh( torus.positions().cbegin(), torus.positions().cend(),
+                    torus.allIncidentVertices().cbegin(),
+                    torus.allIncidentVertices().cend() );
+  trace.info() << "build: " << c.stopClock() << " ms"
+               << ", #V=" << mesh.nbVertices() << " #E=" << mesh.nbEdges()
+               << " #F=" << mesh.nbFaces() << std::endl;
+  ok = ok && mesh.Euler() == 0;
+
+  std::stringstream obj;
+  PolygonMeshWriter::writeOBJ( obj, torus );
+  c.startClock();
+  PolygonMesh loaded;
+  ok = PolygonMeshReader::readOBJ( obj, loaded ) && ok;
+  trace.info() << "load OBJ: " << c.stopClock() << " ms" << std::endl;
+  ok = ok && loaded.nbEdges() == mesh.nbEdges();
+
+  c.startClock();
+  std::size_t nb_found = 0;
+  for ( PolygonMesh::Face f = 0; f < mesh.nbFaces(); ++f )
+    {
+      const auto& vtcs = mesh.incidentVertices( f );
+      for ( std::size_t i = 0; i < vtcs.size(); ++i )
+        nb_found += mesh.makeEdge( vtcs[ i ], vtcs[ ( i + 1 ) % vtcs.size() ] )
+          < mesh.nbEdges() ? 1 : 0;
+    }
+  trace.info() << "makeEdge x " << nb_found << ": " << c.stopClock() << " ms" << std::endl;
+  ok = ok && nb_found == 2 * mesh.nbEdges();
+
+  const auto lantern = PolygonMeshHelper::makeLantern( 3.0, 3.0, RealPoint::zero, m, n,
+                                                       NormalsType::NO_NORMALS );
+  c.startClock();
+  const auto bdry_edges = lantern.computeManifoldBoundaryEdges();
+  const bool manifold   = lantern.isBoundariesManifold();
+  const auto chains     = lantern.computeManifoldBoundaryChains();
+  trace.info() << "boundary: " << c.stopClock() << " ms"
+               << ", #edges=" << bdry_edges.size()
+               << " #chains=" << chains.size() << std::endl;
+  ok = ok && manifold && chains.size() == 2 && bdry_edges.size() == 2 * m;
+  trace.endBlock();
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class SurfaceMesh" );
+  std::vector< std::size_t > sizes = { 100, 1000 };
+  if ( argc > 1 ) sizes = { (std::size_t) atoi( argv[ 1 ] ) };
+  const std::size_t n = argc > 2 ? atoi( argv[ 2 ] ) : 0;
+  bool res = true;
+  for ( auto m : sizes )
+    res = benchmarkSurfaceMesh( m, n > 0 ? n : m ) && res;
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
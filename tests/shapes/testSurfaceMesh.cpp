@@ -31,6 +31,8 @@
 #include <iostream>
 #include <sstream>
 #include <algorithm>
+#include <map>
+#include <set>
 #include "DGtal/base/Common.h"
 #include "ConfigTest.h"
 #include "DGtalCatch.h"
@@ -40,6 +42,7 @@
 #include "DGtal/graph/BreadthFirstVisitor.h"
 #include "DGtal/shapes/SurfaceMesh.h"
 #include "DGtal/shapes/SurfaceMeshHelper.h"
+#include "DGtal/shapes/SurfaceMeshSpatialIndex.h"
 #include "DGtal/io/readers/SurfaceMeshReader.h"
 #include "DGtal/io/writers/SurfaceMeshWriter.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -513,4 +516,234 @@ SCENARIO( "SurfaceMesh< RealPoint3 > restore lantern with flips tests", "[surfme
     }
   }
 }
-  
+
+SCENARIO( "SurfaceMesh< RealPoint3 > adjacency tests", "[surfmesh][adjacency]" )
+{
+  typedef PointVector<3,double>                      RealPoint;
+  typedef PointVector<3,double>                      RealVector;
+  typedef SurfaceMesh< RealPoint, RealVector >       PolygonMesh;
+  typedef PolygonMesh::Vertices                      Vertices;
+  typedef PolygonMesh::Faces                         Faces;
+  typedef PolygonMesh::Edge                          Edge;
+  typedef PolygonMesh::VertexPair                    VertexPair;
+  typedef SurfaceMeshHelper< RealPoint, RealVector > PolygonMeshHelper;
+  typedef PolygonMeshHelper::NormalsType             NormalsType;
+  // A soup of random polygons, with non manifold and duplicated edges.
+  srand( 0 );
+  const std::size_t nbv = 40;
+  std::vector< RealPoint > positions( nbv );
+  std::vector< Vertices  > faces( 150 );
+  for ( auto& face : faces )
+    {
+      const std::size_t n = 3 + rand() % 3;
+      while ( face.size() < n )
+        {
+          const std::size_t v = rand() % nbv;
+          if ( std::find( face.cbegin(), face.cend(), v ) == face.cend() )
+            face.push_back( v );
+        }
+    }
+  PolygonMesh soup( positions.cbegin(), positions.cend(), faces.cbegin(), faces.cend() );
+  // Reference adjacencies, computed with ordered sets and maps.
+  std::map< VertexPair, Faces > ref_left, ref_right;
+  std::vector< std::set< std::size_t > > ref_neighbors( nbv );
+  for ( std::size_t f = 0; f < faces.size(); ++f )
+    for ( std::size_t i = 0; i < faces[ f ].size(); ++i )
+      {
+        const auto a = faces[ f ][ i ];
+        const auto b = faces[ f ][ ( i + 1 ) % faces[ f ].size() ];
+        if ( a < b ) ref_left [ std::make_pair( a, b ) ].push_back( f );
+        else         ref_right[ std::make_pair( b, a ) ].push_back( f );
+        ref_neighbors[ a ].insert( b );
+        ref_neighbors[ b ].insert( a );
+      }
+  std::set< VertexPair > ref_edges;
+  for ( const auto& e : ref_left  ) ref_edges.insert( e.first );
+  for ( const auto& e : ref_right ) ref_edges.insert( e.first );
+  WHEN( "Computing edges of a polygon soup" ) {
+    THEN( "Edges are sorted vertex pairs with the faces on their left and right" ) {
+      REQUIRE( soup.nbEdges() == ref_edges.size() );
+      REQUIRE( std::equal( ref_edges.cbegin(), ref_edges.cend(),
+                           soup.allEdgeVertices().cbegin() ) );
+      std::size_t nb_bad = 0;
+      for ( Edge e = 0; e < soup.nbEdges(); ++e )
+        {
+          const auto ij = soup.edgeVertices( e );
+          Faces faces_e = ref_right[ ij ];
+          faces_e.insert( faces_e.end(), ref_left[ ij ].cbegin(), ref_left[ ij ].cend() );
+          nb_bad += ( soup.edgeLeftFaces ( e ) != ref_left [ ij ] ) ? 1 : 0;
+          nb_bad += ( soup.edgeRightFaces( e ) != ref_right[ ij ] ) ? 1 : 0;
+          nb_bad += ( soup.edgeFaces     ( e ) != faces_e         ) ? 1 : 0;
+          nb_bad += ( soup.makeEdge( ij.first, ij.second ) != e  ) ? 1 : 0;
+          nb_bad += ( soup.makeEdge( ij.second, ij.first ) != e  ) ? 1 : 0;
+        }
+      REQUIRE( nb_bad == 0 );
+      std::size_t nb_missing = 0;
+      for ( std::size_t i = 0; i < nbv; ++i )
+        for ( std::size_t j = 0; j < nbv; ++j )
+          if ( ! ref_neighbors[ i ].count( j ) )
+            nb_missing += ( soup.makeEdge( i, j ) == soup.nbEdges() ) ? 1 : 0;
+      REQUIRE( nb_missing + 2 * soup.nbEdges() == nbv * nbv );
+    }
+    THEN( "Neighbor vertices and faces are sorted and as expected" ) {
+      std::size_t nb_bad = 0;
+      for ( std::size_t v = 0; v < nbv; ++v )
+        nb_bad += ( soup.neighborVertices( v )
+                    != Vertices( ref_neighbors[ v ].cbegin(), ref_neighbors[ v ].cend() ) )
+          ? 1 : 0;
+      for ( std::size_t f = 0; f < faces.size(); ++f )
+        {
+          Vertices sf = faces[ f ];
+          std::sort( sf.begin(), sf.end() );
+          Faces ref_nf;
+          for ( std::size_t g = 0; g < faces.size(); ++g )
+            {
+              Vertices sg = faces[ g ];
+              std::sort( sg.begin(), sg.end() );
+              Vertices common;
+              std::set_intersection( sf.cbegin(), sf.cend(), sg.cbegin(), sg.cend(),
+                                     std::back_inserter( common ) );
+              if ( g != f && common.size() == 2 ) ref_nf.push_back( g );
+            }
+          nb_bad += ( soup.neighborFaces( f ) != ref_nf ) ? 1 : 0;
+        }
+      REQUIRE( nb_bad == 0 );
+    }
+  }
+  WHEN( "Flipping edges of a lantern" ) {
+    auto meshLantern = PolygonMeshHelper::makeLantern( 3.0, 3.0, RealPoint::zero,
+                                                       10, 10, NormalsType::NO_NORMALS );
+    std::size_t nb_flipped = 0;
+    std::size_t nb_old     = 0;
+    for ( Edge e = 0; e < meshLantern.nbEdges(); e += 3 )
+      if ( meshLantern.isFlippable( e ) )
+        {
+          const auto ij = meshLantern.edgeVertices( e );
+          meshLantern.flip( e, false );
+          nb_old += ( meshLantern.makeEdge( ij.first, ij.second )
+                      != meshLantern.nbEdges() ) ? 1 : 0;
+          nb_flipped++;
+        }
+    THEN( "Former edges are no longer found, and every edge is found" ) {
+      REQUIRE( nb_flipped > 50 );
+      REQUIRE( nb_old == 0 );
+      std::size_t nb_bad = 0;
+      for ( Edge e = 0; e < meshLantern.nbEdges(); ++e )
+        {
+          const auto ij = meshLantern.edgeVertices( e );
+          nb_bad += ( meshLantern.makeEdge( ij.second, ij.first ) != e ) ? 1 : 0;
+        }
+      REQUIRE( nb_bad == 0 );
+    }
+    THEN( "Boundary chains are unchanged" ) {
+      auto chains = meshLantern.computeManifoldBoundaryChains();
+      REQUIRE( meshLantern.isBoundariesManifold() );
+      REQUIRE( chains.size() == 2 );
+      REQUIRE( chains[ 0 ].size() + chains[ 1 ].size() == 20 );
+    }
+  }
+  WHEN( "Flipping a few edges of a lantern twice" ) {
+    auto meshLantern = PolygonMeshHelper::makeLantern( 3.0, 3.0, RealPoint::zero,
+                                                       10, 10, NormalsType::NO_NORMALS );
+    const auto edges = meshLantern.allEdgeVertices();
+    std::vector< Edge > flipped;
+    for ( Edge e = 0; e < meshLantern.nbEdges() && flipped.size() < 10; e += 7 )
+      if ( meshLantern.isFlippable( e ) )
+        {
+          meshLantern.flip( e, false );
+          meshLantern.flip( e, false );
+          flipped.push_back( e );
+        }
+    THEN( "Edges have their former vertices and are found" ) {
+      REQUIRE( flipped.size() == 10 );
+      std::size_t nb_bad = 0;
+      for ( Edge e = 0; e < meshLantern.nbEdges(); ++e )
+        {
+          const auto ij = meshLantern.edgeVertices( e );
+          nb_bad += ( ij != edges[ e ] ) ? 1 : 0;
+          nb_bad += ( meshLantern.makeEdge( ij.first, ij.second ) != e ) ? 1 : 0;
+        }
+      REQUIRE( nb_bad == 0 );
+    }
+  }
+}
+
+SCENARIO( "SurfaceMesh< RealPoint3 > ball queries tests", "[surfmesh][ball]" )
+{
+  typedef PointVector<3,double>                      RealPoint;
+  typedef PointVector<3,double>                      RealVector;
+  typedef SurfaceMesh< RealPoint, RealVector >       PolygonMesh;
+  typedef PolygonMesh::Vertices                      Vertices;
+  typedef PolygonMesh::Face                          Face;
+  typedef PolygonMesh::WeightedEdges                 WeightedEdges;
+  typedef PolygonMesh::WeightedFaces                 WeightedFaces;
+  typedef SurfaceMeshSpatialIndex< RealPoint, RealVector > SpatialIndex;
+  // Two parallel grids of 10x10 quads at distance 0.5.
+  std::vector< RealPoint > positions;
+  std::vector< Vertices  > faces;
+  for ( int z = 0; z < 2; ++z )
+    {
+      const std::size_t first = positions.size();
+      for ( int y = 0; y <= 10; ++y )
+        for ( int x = 0; x <= 10; ++x )
+          positions.push_back( RealPoint( 0.2 * x, 0.2 * y, 0.5 * z ) );
+      for ( std::size_t y = 0; y < 10; ++y )
+        for ( std::size_t x = 0; x < 10; ++x )
+          {
+            const std::size_t v = first + 11 * y + x;
+            faces.push_back( { v, v + 1, v + 12, v + 11 } );
+          }
+    }
+  PolygonMesh sheets( positions.cbegin(), positions.cend(), faces.cbegin(), faces.cend() );
+  const SpatialIndex index( sheets );
+  PolygonMesh::BallQueryBuffers buffers;
+  Vertices      vertices;
+  WeightedEdges edges;
+  WeightedFaces wfaces;
+  WHEN( "Traversing the mesh from a face with buffers" ) {
+    THEN( "Cells are the same as without buffers" ) {
+      std::size_t nb_bad = 0;
+      for ( double r : { 0.0, 0.3, 0.7 } )
+        for ( Face f = 0; f < sheets.nbFaces(); f += 7 )
+          {
+            const auto p = sheets.faceCentroid( f );
+            sheets.computeFacesInclusionsInBall( r, f, p, buffers, wfaces );
+            nb_bad += ( wfaces != sheets.computeFacesInclusionsInBall( r, f, p ) ) ? 1 : 0;
+            sheets.computeCellsInclusionsInBall( r, f, p, buffers, vertices, edges, wfaces );
+            nb_bad += ( std::make_tuple( vertices, edges, wfaces )
+                        != sheets.computeCellsInclusionsInBall( r, f, p ) ) ? 1 : 0;
+          }
+      REQUIRE( nb_bad == 0 );
+    }
+  }
+  WHEN( "Querying the spatial index" ) {
+    THEN( "Balls within one sheet have the same faces as with a traversal" ) {
+      REQUIRE( index.isValid() );
+      REQUIRE( index.nbCells() > 1 );
+      std::size_t nb_bad = 0;
+      for ( Face f = 0; f < sheets.nbFaces(); f += 3 )
+        {
+          const auto p = sheets.faceCentroid( f );
+          auto expected = sheets.computeFacesInclusionsInBall( 0.3, f, p );
+          std::sort( expected.begin(), expected.end() );
+          index.computeFacesInclusionsInBall( 0.3, p, buffers, wfaces );
+          std::sort( wfaces.begin(), wfaces.end() );
+          nb_bad += ( wfaces != expected ) ? 1 : 0;
+        }
+      REQUIRE( nb_bad == 0 );
+    }
+    THEN( "Balls intersecting both sheets have the faces of both sheets" ) {
+      const Face f = 55;
+      const auto p = sheets.faceCentroid( f );
+      const auto traversed = sheets.computeFacesInclusionsInBall( 0.7, f, p );
+      index.computeCellsInclusionsInBall( 0.7, p, buffers, vertices, edges, wfaces );
+      std::size_t nb_other_sheet = 0;
+      for ( const auto& wf : wfaces ) nb_other_sheet += wf.first >= 100 ? 1 : 0;
+      REQUIRE( nb_other_sheet > 0 );
+      REQUIRE( wfaces.size() == traversed.size() + nb_other_sheet );
+      REQUIRE( std::is_sorted( vertices.cbegin(), vertices.cend() ) );
+      REQUIRE( vertices.back() >= 121 );
+    }
+  }
+}
+
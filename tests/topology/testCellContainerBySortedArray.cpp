@@ -0,0 +1,173 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class CellContainerBySortedArray.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <map>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/CellContainerBySortedArray.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef KhalimskySpaceND<3>                                  KSpace;
+typedef KSpace::Point                                        Point;
+typedef KSpace::Cell                                         Cell;
+typedef CellContainerBySortedArray<Cell, CubicalCellData>    Container;
+typedef std::map<Cell, CubicalCellData>                      Map;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class CellContainerBySortedArray.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return 'true' if both containers have the same cells with the same data.
+bool sameContent( const Container & container, const Map & map )
+{
+  if ( container.size() != map.size() ) return false;
+  for ( auto const & v : map )
+    {
+      auto it = container.find( v.first );
+      if ( it == container.end() || it->second.data != v.second.data ) return false;
+    }
+  std::size_t n = 0;
+  for ( auto it = container.begin(), itE = container.end(); it != itE; ++it )
+    {
+      auto itMap = map.find( it->first );
+      if ( itMap == map.end() || itMap->second.data != it->second.data ) return false;
+      ++n;
+    }
+  return n == map.size();
+}
+
+TEST_CASE( "Testing CellContainerBySortedArray" )
+{
+  srand( 0 );
+  KSpace K;
+  K.init( Point( 0,0,0 ), Point( 30,30,30 ), true );
+  auto randomCell = [&K] ()
+    { return K.uCell( Point( rand() % 61, rand() % 61, rand() % 61 ) ); };
+
+  SECTION( "Random insertions, assignments and erasures behave as with std::map" )
+    {
+      Container container;
+      Map map;
+      std::size_t nbDiff = 0;
+      for ( int i = 0; i < 20000; ++i )
+        {
+          const Cell c = randomCell();
+          const int op = rand() % 4;
+          if ( op == 0 )
+            nbDiff += ( container.insert( std::make_pair( c, CubicalCellData( i ) ) ).second
+                        != map.insert( std::make_pair( c, CubicalCellData( i ) ) ).second ) ? 1 : 0;
+          else if ( op == 1 )
+            {
+              container[ c ].data = i;
+              map[ c ].data = i;
+            }
+          else
+            nbDiff += ( container.erase( c ) != map.erase( c ) ) ? 1 : 0;
+        }
+      REQUIRE( nbDiff == 0 );
+      REQUIRE( container.isValid() );
+      REQUIRE( sameContent( container, map ) );
+      container.flush();
+      REQUIRE( container.nbPending() == 0 );
+      REQUIRE( container.isValid() );
+      REQUIRE( sameContent( container, map ) );
+    }
+
+  SECTION( "Range insertions keep existing data, insertCells replaces it" )
+    {
+      Container container;
+      Map map;
+      std::vector< std::pair<Cell, CubicalCellData> > values;
+      std::vector<Cell> cells;
+      for ( int i = 0; i < 5000; ++i )
+        {
+          values.push_back( std::make_pair( randomCell(), CubicalCellData( i ) ) );
+          cells.push_back( randomCell() );
+        }
+      container.insert( values.begin(), values.begin() + 2500 );
+      map.insert( values.begin(), values.begin() + 2500 );
+      REQUIRE( container.nbPending() == 0 );
+      for ( int i = 0; i < 1000; ++i )
+        {
+          const Cell c = randomCell();
+          container.erase( c );
+          map.erase( c );
+        }
+      container.insert( values.begin() + 2500, values.end() );
+      map.insert( values.begin() + 2500, values.end() );
+      REQUIRE( sameContent( container, map ) );
+      container.insertCells( cells.begin(), cells.end(), CubicalCellData( 7 ) );
+      for ( auto const & c : cells ) map[ c ] = CubicalCellData( 7 );
+      REQUIRE( container.isValid() );
+      REQUIRE( sameContent( container, map ) );
+      // Cells are visited in increasing order.
+      auto itMap = map.begin();
+      bool sorted = true;
+      for ( auto it = container.begin(), itE = container.end(); it != itE; ++it, ++itMap )
+        sorted = sorted && ( it->first == itMap->first );
+      REQUIRE( sorted );
+    }
+
+  SECTION( "Iterators are stable by erasure and data modification" )
+    {
+      std::vector<Cell> cells;
+      for ( int i = 0; i < 1000; ++i ) cells.push_back( randomCell() );
+      Container container;
+      container.insertCells( cells.begin(), cells.end() );
+      std::vector<Container::iterator> its;
+      for ( auto it = container.begin(), itE = container.end(); it != itE; ++it )
+        its.push_back( it );
+      for ( std::size_t i = 0; i < its.size(); i += 2 ) container.erase( its[ i ] );
+      for ( std::size_t i = 1; i < its.size(); i += 2 )
+        container[ its[ i ]->first ].data = 3;
+      std::size_t nbBad = 0;
+      for ( std::size_t i = 1; i < its.size(); i += 2 )
+        nbBad += ( its[ i ]->second.data == 3 && container.find( its[ i ]->first ) == its[ i ] )
+          ? 0 : 1;
+      REQUIRE( nbBad == 0 );
+      REQUIRE( container.size() == its.size() / 2 );
+      // Erasing while iterating.
+      for ( auto it = container.begin(), itE = container.end(); it != itE; )
+        {
+          auto itMem = it;
+          ++it;
+          container.erase( itMem );
+        }
+      REQUIRE( container.empty() );
+      REQUIRE( container.begin() == container.end() );
+    }
+}
+
+/** @ingroup Tests **/
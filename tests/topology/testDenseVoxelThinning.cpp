@@ -0,0 +1,345 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class DenseVoxelThinning.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <functional>
+#include <set>
+#include <unordered_map>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/Object.h"
+#include "DGtal/topology/VoxelComplex.h"
+#include "DGtal/topology/VoxelComplexFunctions.h"
+#include "DGtal/topology/NeighborhoodConfigurations.h"
+#include "DGtal/topology/tables/NeighborhoodTables.h"
+#include "DGtal/topology/DenseVoxelThinning.h"
+#include "DGtal/topology/VoxelComplexThinning.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef DenseVoxelThinning<Domain>   Thinning;
+typedef std::unordered_map<Point, NeighborhoodConfiguration> PointToMask;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DenseVoxelThinning.
+///////////////////////////////////////////////////////////////////////////////
+
+/// A ball with a tunnel, and a few random voxels around.
+DigitalSet makeShape( const Domain & domain, int radius )
+{
+  DigitalSet set( domain );
+  const Point c = ( domain.lowerBound() + domain.upperBound() ) / 2;
+  for ( auto const & p : domain )
+    {
+      const Point q = p - c;
+      const bool inBall   = q.squaredNorm() <= radius * radius;
+      const bool inTunnel = q[ 0 ] * q[ 0 ] + q[ 1 ] * q[ 1 ] <= radius * radius / 9;
+      if ( ( inBall && ! inTunnel ) || rand() % 50 == 0 ) set.insertNew( p );
+    }
+  return set;
+}
+
+/// Configuration of a point in a std::set, as in functions::skelWithTable.
+NeighborhoodConfiguration configuration( const std::set<Point> & voxels,
+                                         const PointToMask & pointToMask,
+                                         const Point & p )
+{
+  NeighborhoodConfiguration conf = 0;
+  for ( auto const & m : pointToMask )
+    if ( voxels.count( p + m.first ) ) conf |= m.second;
+  return conf;
+}
+
+/**
+ * Straightforward sequential version of the directional thinning of
+ * DenseVoxelThinning on a std::set of points, with configurations
+ * computed as in functions::skelWithTable.
+ */
+std::set<Point> referenceThinning( const DigitalSet & input,
+                                   const boost::dynamic_bitset<> & simple,
+                                   const std::function<bool( NeighborhoodConfiguration )> & skel )
+{
+  const PointToMask pointToMask = *functions::mapZeroPointNeighborhoodToConfigurationMask<Point>();
+  const Point directions[ 6 ] = { Point( 0, -1, 0 ), Point( 0, 1, 0 ), Point( 1, 0, 0 ),
+                                  Point( -1, 0, 0 ), Point( 0, 0, 1 ), Point( 0, 0, -1 ) };
+  // Points sorted by z, y, x.
+  auto zyxLess = [] ( const Point & a, const Point & b )
+    { return std::make_tuple( a[ 2 ], a[ 1 ], a[ 0 ] ) < std::make_tuple( b[ 2 ], b[ 1 ], b[ 0 ] ); };
+  std::set<Point> voxels( input.begin(), input.end() );
+  std::set<Point> anchors;
+  bool stable = false;
+  while ( ! stable )
+    {
+      stable = true;
+      for ( auto const & dir : directions )
+        {
+          std::vector<Point> candidates;
+          std::vector<Point> sorted( voxels.begin(), voxels.end() );
+          std::sort( sorted.begin(), sorted.end(), zyxLess );
+          for ( auto const & p : sorted )
+            {
+              if ( anchors.count( p ) || voxels.count( p + dir ) ) continue;
+              const auto conf = configuration( voxels, pointToMask, p );
+              if ( skel( conf ) ) anchors.insert( p );
+              else if ( simple[ conf ] ) candidates.push_back( p );
+            }
+          // Parity classes (z,y,x), then z, y, x order.
+          const Point lo = input.domain().lowerBound();
+          for ( int c = 0; c < 8; ++c )
+            for ( auto const & p : candidates )
+              {
+                const Point q = p - lo + Point::diagonal( 1 );
+                if ( ( q[ 0 ] & 1 ) != ( c & 1 ) || ( q[ 1 ] & 1 ) != ( ( c >> 1 ) & 1 )
+                     || ( q[ 2 ] & 1 ) != ( ( c >> 2 ) & 1 ) ) continue;
+                if ( simple[ configuration( voxels, pointToMask, p ) ] )
+                  {
+                    voxels.erase( p );
+                    stable = false;
+                  }
+              }
+        }
+    }
+  return voxels;
+}
+
+/// Euler characteristic of the (closed) cubical complex of a set of voxels.
+Integer eulerCharacteristic( const DigitalSet & set )
+{
+  KSpace ks;
+  ks.init( set.domain().lowerBound(), set.domain().upperBound(), true );
+  VoxelComplex<KSpace> vc( ks );
+  vc.construct( set );
+  return vc.euler();
+}
+
+/// Number of 26-connected components of a set of voxels.
+std::size_t nbComponents( const DigitalSet & set )
+{
+  typedef Object<DT26_6, DigitalSet> ObjectType;
+  ObjectType object( dt26_6, set );
+  std::vector<ObjectType> components;
+  std::back_insert_iterator< std::vector<ObjectType> > it( components );
+  return object.writeComponents( it );
+}
+
+/// Voxels of a VoxelComplex as a digital set.
+template <typename TComplex>
+DigitalSet voxels( const TComplex & vc, const Domain & domain )
+{
+  DigitalSet set( domain );
+  for ( auto it = vc.begin( 3 ), itE = vc.end( 3 ); it != itE; ++it )
+    set.insert( vc.space().uCoords( it->first ) );
+  return set;
+}
+
+TEST_CASE( "Testing DenseVoxelThinning" )
+{
+  srand( 0 );
+  auto simple = functions::loadTable( simplicity::tableSimple26_6 );
+  const Domain domain( Point( -3, 1, -7 ), Point( 14, 16, 8 ) );
+  const DigitalSet shape = makeShape( domain, 7 );
+
+  SECTION( "Configurations are the ones of VoxelComplex" )
+    {
+      typedef VoxelComplex<KSpace> Complex;
+      KSpace ks;
+      ks.init( domain.lowerBound(), domain.upperBound(), true );
+      Complex vc( ks );
+      vc.construct( shape );
+      const PointToMask pointToMask = *functions::mapZeroPointNeighborhoodToConfigurationMask<Point>();
+      Thinning thinning( domain );
+      thinning.construct( shape );
+      REQUIRE( thinning.isValid() );
+      REQUIRE( thinning.size() == shape.size() );
+      std::size_t nbDiff = 0;
+      for ( auto const & p : domain )
+        {
+          nbDiff += ( thinning( p ) != shape( p ) ) ? 1 : 0;
+          nbDiff += ( thinning.configuration( p )
+                      != functions::getSpelNeighborhoodConfigurationOccupancy( vc, p, pointToMask ) )
+            ? 1 : 0;
+        }
+      REQUIRE( nbDiff == 0 );
+    }
+
+  SECTION( "Same skeletons as the sequential reference, whatever the number of threads" )
+    {
+      auto isthmus = functions::loadTable( isthmusicity::tableIsthmus );
+      for ( int type = 0; type < 3; ++type )
+        {
+          CAPTURE( type );
+          // Ultimate, end and isthmus skeletons.
+          const std::function<bool( NeighborhoodConfiguration )> skel =
+            [type, &isthmus] ( NeighborhoodConfiguration conf )
+            {
+              return ( type == 1 && Bits::nbSetBits( conf ) == 1 )
+                || ( type == 2 && (*isthmus)[ conf ] );
+            };
+          const std::set<Point> expected = referenceThinning( shape, *simple, skel );
+          for ( unsigned int nbThreads : { 1u, 3u } )
+            {
+              Thinning thinning( domain );
+              thinning.construct( shape );
+              thinning.setSimplicityTable( simple );
+              if ( type == 1 ) thinning.setSkelType( Thinning::SKEL_END );
+              if ( type == 2 ) thinning.setSkelTable( isthmus );
+              const auto n = thinning.thin( nbThreads == 1
+                                            ? ParallelPolicy::sequential()
+                                            : ParallelPolicy::threads( nbThreads ) );
+              DigitalSet result( domain );
+              thinning.dumpVoxels( result );
+              REQUIRE( n == expected.size() );
+              REQUIRE( std::set<Point>( result.begin(), result.end() ) == expected );
+              std::size_t removed = 0;
+              for ( auto r : thinning.removedPerPass() ) removed += r;
+              REQUIRE( removed + n == shape.size() );
+              REQUIRE( thinning.removedPerPass().back() == 0 );
+            }
+        }
+    }
+
+  SECTION( "Same topology as functions::thinningVoxelComplex with skelWithTable" )
+    {
+      // Both schemes remove only simple voxels, but not in the same
+      // order (see DenseVoxelThinning): skeletons have the same
+      // topology, not the same voxels.
+      typedef VoxelComplex<KSpace> Complex;
+      KSpace ks;
+      ks.init( domain.lowerBound(), domain.upperBound(), true );
+      const std::string tables = simplicity::tableSimple26_6.substr
+        ( 0, simplicity::tableSimple26_6.find_last_of( '/' ) );
+      const Integer euler = eulerCharacteristic( shape );
+      const std::size_t nbCC = nbComponents( shape );
+      for ( std::string type : { "ultimate", "end", "isthmus" } )
+        {
+          CAPTURE( type );
+          Complex vc( ks );
+          vc.construct( shape, simple );
+          const DigitalSet asymmetric
+            = voxels( functions::thinningVoxelComplex( vc, type, "first", tables ), domain );
+          const DigitalSet dense
+            = voxels( functions::denseThinningVoxelComplex( vc, type, tables ), domain );
+          REQUIRE( eulerCharacteristic( asymmetric ) == euler );
+          REQUIRE( eulerCharacteristic( dense ) == euler );
+          REQUIRE( nbComponents( asymmetric ) == nbCC );
+          REQUIRE( nbComponents( dense ) == nbCC );
+          if ( type == "ultimate" )
+            {
+              // Ultimate skeletons have no simple voxel, hence they are
+              // left unchanged by the other scheme.
+              Complex vc_dense( ks );
+              vc_dense.construct( dense, simple );
+              REQUIRE( voxels( functions::thinningVoxelComplex( vc_dense, type, "first", tables ),
+                               domain ).size() == dense.size() );
+              Thinning thinning( domain );
+              thinning.construct( asymmetric );
+              thinning.setSimplicityTable( simple );
+              REQUIRE( thinning.thin() == asymmetric.size() );
+            }
+        }
+
+      // A set without simple voxel (a closed curve and isolated
+      // voxels) is a fixed point of both schemes.
+      Thinning thinning( domain );
+      thinning.construct( shape );
+      thinning.setSimplicityTable( simple );
+      thinning.thin();
+      DigitalSet curve( domain );
+      thinning.dumpVoxels( curve );
+      Complex vc( ks );
+      vc.construct( curve, simple );
+      const DigitalSet asymmetric
+        = voxels( functions::thinningVoxelComplex( vc, "ultimate", "first", tables ), domain );
+      const DigitalSet dense
+        = voxels( functions::denseThinningVoxelComplex( vc, "ultimate", tables ), domain );
+      REQUIRE( std::set<Point>( asymmetric.begin(), asymmetric.end() )
+               == std::set<Point>( curve.begin(), curve.end() ) );
+      REQUIRE( std::set<Point>( dense.begin(), dense.end() )
+               == std::set<Point>( curve.begin(), curve.end() ) );
+    }
+
+  SECTION( "Ultimate skeletons preserve topology" )
+    {
+      DigitalSet ball( domain );
+      DigitalSet ring( domain );
+      const Point c( 5, 8, 0 );
+      for ( auto const & p : domain )
+        {
+          const Point q = p - c;
+          if ( q.squaredNorm() <= 36 ) ball.insertNew( p );
+          const double r = std::sqrt( (double) ( q[ 0 ] * q[ 0 ] + q[ 1 ] * q[ 1 ] ) );
+          if ( std::abs( r - 5.0 ) <= 1.5 && std::abs( q[ 2 ] ) <= 1 ) ring.insertNew( p );
+        }
+      Thinning tball( domain );
+      tball.construct( ball );
+      tball.setSimplicityTable( simple );
+      REQUIRE( tball.thin( ParallelPolicy::threads( 2 ) ) == 1 );
+
+      Thinning tring( domain );
+      tring.construct( ring );
+      tring.setSimplicityTable( simple );
+      REQUIRE( tring.thin() > 4 );
+      // A closed curve: no voxel is simple, each one has two neighbors.
+      DigitalSet curve( domain );
+      tring.dumpVoxels( curve );
+      std::size_t nbBad = 0;
+      for ( auto const & p : curve )
+        nbBad += ( tring.isSimple( p )
+                   || Bits::nbSetBits( tring.configuration( p ) ) != 2 ) ? 1 : 0;
+      REQUIRE( nbBad == 0 );
+    }
+
+  SECTION( "Thinning a VoxelComplex with the dense engine" )
+    {
+      typedef VoxelComplex<KSpace> Complex;
+      KSpace ks;
+      ks.init( domain.lowerBound(), domain.upperBound(), true );
+      Complex vc( ks );
+      vc.construct( shape, simple );
+      const std::string tables = simplicity::tableSimple26_6.substr
+        ( 0, simplicity::tableSimple26_6.find_last_of( '/' ) );
+      auto vc_new = functions::denseThinningVoxelComplex( vc, "isthmus", tables,
+                                                          ParallelPolicy::threads( 2 ) );
+      Thinning thinning( domain );
+      thinning.construct( shape );
+      thinning.setSimplicityTable( simple );
+      thinning.setSkelTable( functions::loadTable( isthmusicity::tableIsthmus ) );
+      REQUIRE( vc_new.nbCells( 3 ) == thinning.thin() );
+      std::size_t nbMissing = 0;
+      for ( auto it = vc_new.begin( 3 ), itE = vc_new.end( 3 ); it != itE; ++it )
+        nbMissing += thinning( ks.uCoords( it->first ) ) ? 0 : 1;
+      REQUIRE( nbMissing == 0 );
+    }
+}
+
+/** @ingroup Tests **/
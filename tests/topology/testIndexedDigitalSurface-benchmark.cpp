@@ -0,0 +1,182 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testIndexedDigitalSurface-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmarks the construction of IndexedDigitalSurface along the
+ * Shortcuts "Vol" pipeline, and compares SCellIndexTable with a
+ * std::map for numbering surfels.
+ *
+ * Usage: testIndexedDigitalSurface-benchmark [vol-file [thresholdMin [thresholdMax]]]
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+#include "ConfigTest.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/topology/SCellIndexTable.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Shortcuts<Z3i::KSpace> SH3;
+typedef Z3i::KSpace::SCell     SCell;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class IndexedDigitalSurface.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return the peak resident set size of the process in KiB (0 if unknown).
+long peakMemoryKiB()
+{
+#if defined(__unix__) || defined(__APPLE__)
+  struct rusage usage;
+  getrusage( RUSAGE_SELF, &usage );
+#if defined(__APPLE__)
+  return usage.ru_maxrss / 1024;
+#else
+  return usage.ru_maxrss;
+#endif
+#else
+  return 0;
+#endif
+}
+
+/**
+ * Numbers the given surfels with a std::map and with a SCellIndexTable,
+ * and compares build and lookup times. Lookups are done in random
+ * order, like when traversing the surface.
+ */
+bool compareIndexing( const Z3i::KSpace & K, const std::vector<SCell> & surfels )
+{
+  std::vector<SCell> queries( surfels );
+  std::shuffle( queries.begin(), queries.end(), std::mt19937( 17 ) );
+  Clock c;
+  c.startClock();
+  std::map<SCell, std::size_t> map;
+  for ( std::size_t i = 0; i < surfels.size(); ++i )
+    map[ surfels[ i ] ] = i;
+  const double tMapBuild = c.stopClock();
+  c.startClock();
+  std::size_t sumMap = 0;
+  for ( auto const & s : queries ) sumMap += map.find( s )->second;
+  const double tMapLookup = c.stopClock();
+
+  c.startClock();
+  SCellIndexTable<Z3i::KSpace> table;
+  table.build( K, surfels.begin(), surfels.end() );
+  const double tTableBuild = c.stopClock();
+  c.startClock();
+  std::size_t sumTable = 0;
+  for ( auto const & s : queries ) sumTable += table( s );
+  const double tTableLookup = c.stopClock();
+
+  const std::size_t mapBytes = map.size()
+    * ( sizeof( std::pair<const SCell, std::size_t> ) + 4 * sizeof( void* ) );
+  trace.info() << "std::map        : build " << tMapBuild << " ms"
+               << ", lookup " << tMapLookup << " ms"
+               << ", ~" << mapBytes / 1024 << " KiB" << std::endl;
+  trace.info() << "SCellIndexTable : build " << tTableBuild << " ms"
+               << ", lookup " << tTableLookup << " ms"
+               << ", " << table.memoryUsage() / 1024 << " KiB"
+               << ( table.isPacked() ? " (packed)" : " (sorted array)" ) << std::endl;
+  return sumMap == sumTable;
+}
+
+/**
+ * Runs the "Vol" pipeline on a binary image: extracts all the surfels,
+ * builds the indexed digital surface, then compares the indexing
+ * structures on its surfels.
+ */
+bool benchmarkPipeline( const std::string & name,
+                        CountedPtr<SH3::BinaryImage> bimage,
+                        Parameters params )
+{
+  trace.beginBlock( "Indexed digital surface of " + name );
+  params( "surfaceComponents", "All" );
+  Clock c;
+  c.startClock();
+  auto K       = SH3::getKSpace( bimage, params );
+  auto surface = SH3::makeIdxDigitalSurface( bimage, K, params );
+  const double t = c.stopClock();
+  trace.info() << "makeIdxDigitalSurface: " << t << " ms"
+               << ", nbVertices=" << surface->nbVertices()
+               << ", nbArcs=" << surface->nbArcs()
+               << ", nbFaces=" << surface->nbFaces() << std::endl;
+  const auto & flat = surface->flatAdjacency();
+  trace.info() << "flat adjacency: " << flat.vertexNeighbors.size() << " neighbors, "
+               << flat.faceVertices.size() << " face vertices" << std::endl;
+  std::vector<SCell> cells;
+  cells.reserve( surface->nbVertices() );
+  for ( auto v : surface->allVertices() ) cells.push_back( surface->surfel( v ) );
+  const bool ok = compareIndexing( K, cells );
+  trace.info() << "peak memory: " << peakMemoryKiB() << " KiB" << std::endl;
+  trace.endBlock();
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class IndexedDigitalSurface" );
+  auto params = SH3::defaultParameters();
+  bool res = true;
+
+  std::vector<std::string> vols = { testPath + "samples/cat10.vol",
+                                    testPath + "samples/lobsterCroped.vol" };
+  if ( argc > 1 ) vols = { std::string( argv[ 1 ] ) };
+  if ( argc > 2 ) params( "thresholdMin", atoi( argv[ 2 ] ) );
+  if ( argc > 3 ) params( "thresholdMax", atoi( argv[ 3 ] ) );
+  for ( auto const & vol : vols )
+    {
+      auto bimage = SH3::makeBinaryImage( vol, params );
+      res = benchmarkPipeline( vol, bimage, params ) && res;
+    }
+
+  if ( argc <= 1 )
+    for ( double h : { 0.25, 0.125 } )
+      {
+        params( "polynomial", "goursat" )( "gridstep", h );
+        auto shape  = SH3::makeImplicitShape3D( params );
+        auto dshape = SH3::makeDigitizedImplicitShape3D( shape, params );
+        auto bimage = SH3::makeBinaryImage( dshape, params );
+        res = benchmarkPipeline( "goursat h=" + std::to_string( h ), bimage, params ) && res;
+      }
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
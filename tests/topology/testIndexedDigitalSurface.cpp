@@ -93,6 +93,41 @@ SCENARIO( "IndexedDigitalSurface< DigitalSetBoundary > build tests", "[idxdsurf]
       REQUIRE( K.sOpp( dsurf.linel( 112 ) ) == dsurf.linel( dsurf.opposite( 112 ) ) );
       REQUIRE( K.sOpp( dsurf.linel( 200 ) ) == dsurf.linel( dsurf.opposite( 200 ) ) );
     }
+    THEN( "Surfels, linels and pointels are mapped back to their indices" ) {
+      unsigned int nb_ok = 0;
+      for ( DigSurface::Vertex v = 0; v < dsurf.nbVertices(); ++v )
+        nb_ok += dsurf.getVertex( dsurf.surfel( v ) ) == v ? 1 : 0;
+      for ( DigSurface::Arc a = 0; a < dsurf.nbArcs(); ++a )
+        nb_ok += dsurf.getArc( dsurf.linel( a ) ) == a ? 1 : 0;
+      for ( DigSurface::Face f = 0; f < dsurf.nbFaces(); ++f )
+        nb_ok += dsurf.getFace( dsurf.pointel( f ) ) == f ? 1 : 0;
+      REQUIRE( nb_ok == dsurf.nbVertices() + dsurf.nbArcs() + dsurf.nbFaces() );
+      REQUIRE( dsurf.getVertex( K.sCell( Point( 0, 0, 0 ) ) ) == DigSurface::Vertex( DigSurface::INVALID_FACE ) );
+    }
+    THEN( "The flat adjacency is the same as the one of the half-edge structure" ) {
+      const auto & adj = dsurf.flatAdjacency();
+      REQUIRE( adj.vertexOffsets.size() == dsurf.nbVertices() + 1 );
+      REQUIRE( adj.faceOffsets.size() == dsurf.nbFaces() + 1 );
+      REQUIRE( adj.vertexNeighbors.size() == dsurf.nbArcs() );
+      unsigned int nb_ok = 0;
+      for ( DigSurface::Vertex v = 0; v < dsurf.nbVertices(); ++v )
+        {
+          std::vector<DigSurface::Vertex> neighbors;
+          auto it = std::back_inserter( neighbors );
+          dsurf.writeNeighbors( it, v );
+          nb_ok += std::equal( neighbors.begin(), neighbors.end(),
+                               adj.vertexNeighbors.begin() + adj.vertexOffsets[ v ],
+                               adj.vertexNeighbors.begin() + adj.vertexOffsets[ v + 1 ] ) ? 1 : 0;
+        }
+      for ( DigSurface::Face f = 0; f < dsurf.nbFaces(); ++f )
+        {
+          const auto vertices = dsurf.verticesAroundFace( f );
+          nb_ok += std::equal( vertices.begin(), vertices.end(),
+                               adj.faceVertices.begin() + adj.faceOffsets[ f ],
+                               adj.faceVertices.begin() + adj.faceOffsets[ f + 1 ] ) ? 1 : 0;
+        }
+      REQUIRE( nb_ok == dsurf.nbVertices() + dsurf.nbFaces() );
+    }
     THEN( "Breadth-first visiting the digital surface from vertex 0 goes to a distance 13." ) {
       BreadthFirstVisitor< DigSurface > visitor( dsurf, 0 );
       std::vector<int> vertices;
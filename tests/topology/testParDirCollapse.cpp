@@ -36,6 +36,7 @@
 // Cellular grid
 #include "DGtal/topology/CubicalComplex.h"
 #include "DGtal/topology/ParDirCollapse.h"
+#include "DGtal/topology/CellContainerBySortedArray.h"
 // Shape construction
 #include "DGtal/shapes/GaussDigitizer.h"
 #include "DGtal/shapes/Shapes.h"
@@ -105,4 +106,39 @@ TEST_CASE( "Testing ParDirCollapse" )
     }
 }
 
+TEST_CASE( "Testing ParDirCollapse with CellContainerBySortedArray" )
+{
+  typedef map<Cell, CubicalCellData>                        Map;
+  typedef CellContainerBySortedArray<Cell, CubicalCellData> Container;
+  typedef CubicalComplex< KSpace, Map >                     CCMap;
+  typedef CubicalComplex< KSpace, Container >               CC;
+  KSpace K;
+  CC complex ( K );
+  CCMap complexMap ( K );
+  ParDirCollapse < CC > thinning ( K );
+  ParDirCollapse < CCMap > thinningMap ( K );
+
+  SECTION("Same result as with std::map")
+    {
+      getComplex< CC, KSpace > ( complex, K );
+      getComplex< CCMap, KSpace > ( complexMap, K );
+      int eulerBefore = complex.euler();
+      REQUIRE( (eulerBefore == complexMap.euler()) );
+      thinning.attach ( &complex );
+      thinningMap.attach ( &complexMap );
+      REQUIRE( ( thinning.eval ( 2 ) == thinningMap.eval ( 2 ) ) );
+      REQUIRE( (eulerBefore == complex.euler()) );
+      REQUIRE( (complex.size() == complexMap.size()) );
+    }
+
+  SECTION("Testing ParDirCollapse::collapseSurface")
+    {
+      getComplex< CC, KSpace > ( complex, K );
+      int eulerBefore = complex.euler();
+      thinning.attach ( &complex );
+      thinning.collapseSurface ();
+      REQUIRE( (eulerBefore == complex.euler()) );
+    }
+}
+
 /** @ingroup Tests **/
@@ -0,0 +1,125 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class SCellIndexTable.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <map>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/SCellIndexTable.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SCellIndexTable.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Fills a table with random cells (with duplicates) and checks it
+/// against a std::map.
+template <typename KSpace>
+void checkAgainstMap( const KSpace & K, std::size_t n, bool packed )
+{
+  typedef typename KSpace::SCell   SCell;
+  typedef typename KSpace::Point   Point;
+  typedef typename KSpace::Integer Integer;
+  typedef SCellIndexTable<KSpace>  Table;
+  const Point lo = K.uKCoords( K.lowerCell() );
+  const Point up = K.uKCoords( K.upperCell() );
+  auto randomCell = [&] ()
+    {
+      Point p;
+      for ( Dimension k = 0; k < KSpace::dimension; ++k )
+        p[ k ] = ( rand() % 4 == 0 ) ? ( rand() % 2 ? lo[ k ] : up[ k ] )
+          : lo[ k ] + Integer( rand() % std::min< Integer >( 1000, up[ k ] - lo[ k ] + 1 ) );
+      return K.sCell( p, rand() % 2 == 0 );
+    };
+  std::vector<SCell> cells;
+  std::map<SCell, std::size_t> reference;
+  for ( std::size_t i = 0; i < n; ++i )
+    {
+      cells.push_back( ( i > 10 && rand() % 10 == 0 ) ? cells[ rand() % i ] : randomCell() );
+      reference[ cells.back() ] = i;
+    }
+  Table table;
+  table.build( K, cells.begin(), cells.end() );
+  REQUIRE( table.isValid() );
+  REQUIRE( table.isPacked() == packed );
+  REQUIRE( table.size() == reference.size() );
+  std::size_t nb_ok = 0;
+  for ( auto const & c : cells )
+    nb_ok += ( table( c ) == reference[ c ] ) ? 1 : 0;
+  REQUIRE( nb_ok == cells.size() );
+  std::size_t nb_absent = 0, nb_invalid = 0;
+  for ( std::size_t i = 0; i < n; ++i )
+    {
+      const SCell c = randomCell();
+      if ( reference.count( c ) ) continue;
+      ++nb_absent;
+      nb_invalid += ( table( c ) == Table::INVALID_INDEX ) ? 1 : 0;
+    }
+  REQUIRE( nb_invalid == nb_absent );
+}
+
+TEST_CASE( "Testing SCellIndexTable" )
+{
+  srand( 0 );
+  SECTION( "Packed keys with a perfect hash function" )
+    {
+      Z3i::KSpace K;
+      K.init( Z3i::Point( -500, -20, 3 ), Z3i::Point( 700, 900, 1200 ), true );
+      checkAgainstMap( K, 20000, true );
+      Z2i::KSpace K2;
+      K2.init( Z2i::Point( -5, -5 ), Z2i::Point( 5, 5 ), true );
+      checkAgainstMap( K2, 50, true );
+    }
+  SECTION( "Sorted array fallback for too large coordinates" )
+    {
+      typedef KhalimskySpaceND< 3, DGtal::int64_t > KSpace;
+      KSpace K;
+      K.init( KSpace::Point::diagonal( -( DGtal::int64_t( 1 ) << 40 ) ),
+              KSpace::Point::diagonal( DGtal::int64_t( 1 ) << 40 ), true );
+      checkAgainstMap( K, 5000, false );
+    }
+  SECTION( "Empty table" )
+    {
+      Z3i::KSpace K;
+      K.init( Z3i::Point( 0, 0, 0 ), Z3i::Point( 10, 10, 10 ), true );
+      std::vector<Z3i::SCell> cells;
+      SCellIndexTable<Z3i::KSpace> table;
+      table.build( K, cells.begin(), cells.end() );
+      REQUIRE( table.empty() );
+      REQUIRE( table( K.sCell( Z3i::Point( 1, 1, 1 ) ) ) == table.INVALID_INDEX );
+    }
+}
+
+/** @ingroup Tests **/
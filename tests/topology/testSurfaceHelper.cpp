@@ -316,6 +316,65 @@ bool testFindABel()
 }
 
 
+/**
+* Checks that the parallel versions of Surfaces::sMakeBoundary and
+* Surfaces::extractAllConnectedSCell give the same surfels and
+* components as the sequential ones, whatever the number of threads.
+*/
+template <typename KSpace>
+bool testParallelBoundaryExtraction()
+{
+  typedef typename KSpace::Space     Space;
+  typedef typename KSpace::Point     Point;
+  typedef typename KSpace::SCell     SCell;
+  typedef HyperRectDomain<Space>     Domain;
+  typedef DigitalSetBySTLSet<Domain> DigitalSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing parallel boundary extraction in dimension "
+                     + std::to_string( KSpace::dimension ) );
+  const Point p1 = Point::diagonal( -12 );
+  const Point p2 = Point::diagonal( 13 );
+  KSpace K; K.init( p1, p2, true );
+  Domain domain( p1, p2 );
+  // A hollow ball (two boundaries), a small ball, and two voxels
+  // touching only by a vertex (connected only for one adjacency).
+  DigitalSet aSet( domain );
+  Shapes<Domain>::addNorm2Ball( aSet, Point::zero, 7 );
+  Shapes<Domain>::removeNorm2Ball( aSet, Point::zero, 3 );
+  Shapes<Domain>::addNorm2Ball( aSet, Point::diagonal( 9 ), 2 );
+  aSet.insert( Point::diagonal( -10 ) );
+  aSet.insert( Point::diagonal( -9 ) );
+
+  std::set<SCell> bdry;
+  Surfaces<KSpace>::sMakeBoundary( bdry, K, aSet, p1, p2 );
+  for ( unsigned int threads : { 1, 2, 3, 7 } )
+    {
+      const ParallelPolicy policy = ParallelPolicy::threads( threads );
+      std::vector<SCell> pbdry;
+      Surfaces<KSpace>::sMakeBoundary( pbdry, K, aSet, p1, p2, policy );
+      ++nb; nbok += std::equal( bdry.begin(), bdry.end(), pbdry.begin(), pbdry.end() ) ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << threads << " threads, " << pbdry.size() << " surfels (should be "
+                   << bdry.size() << ")" << std::endl;
+      for ( bool interior : { true, false } )
+        for ( bool orient : { false, true } )
+          {
+            SurfelAdjacency<KSpace::dimension> SAdj( interior );
+            std::vector< std::vector<SCell> > components, pcomponents;
+            Surfaces<KSpace>::extractAllConnectedSCell( components, K, SAdj, aSet, orient );
+            Surfaces<KSpace>::extractAllConnectedSCell( pcomponents, K, SAdj, aSet, orient, policy );
+            ++nb; nbok += components == pcomponents ? 1 : 0;
+            trace.info() << "(" << nbok << "/" << nb << ") "
+                         << pcomponents.size() << " components (should be "
+                         << components.size() << ")" << std::endl;
+          }
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -328,7 +387,9 @@ int main( int argc, char** argv )
   trace.info() << endl;
 
   bool res = testComputeInterior()
-    && testFindABel< KhalimskySpaceND<3,int> >()  && test3dSurfaceHelper();
+    && testFindABel< KhalimskySpaceND<3,int> >()  && test3dSurfaceHelper()
+    && testParallelBoundaryExtraction< KhalimskySpaceND<2,int> >()
+    && testParallelBoundaryExtraction< KhalimskySpaceND<3,int> >();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
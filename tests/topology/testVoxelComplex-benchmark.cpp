@@ -0,0 +1,126 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testVoxelComplex-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmarks the computation of critical cliques of a VoxelComplex
+ * with an increasing number of threads.
+ *
+ * Usage: testVoxelComplex-benchmark [radius [maxThreads]]
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/base/ParallelPolicy.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/VoxelComplex.h"
+#include "DGtal/topology/tables/NeighborhoodTables.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef VoxelComplex<KSpace> Complex;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class VoxelComplex.
+///////////////////////////////////////////////////////////////////////////////
+
+/// A ball of the given radius with a tunnel and random holes.
+DigitalSet makeShape( const Domain & domain, int radius )
+{
+  srand( 0 );
+  DigitalSet set( domain );
+  for ( auto const & p : domain )
+    {
+      const bool inBall   = p.squaredNorm() <= radius * radius;
+      const bool inTunnel = p[ 0 ] * p[ 0 ] + p[ 1 ] * p[ 1 ] <= radius * radius / 9;
+      if ( inBall && ! inTunnel && rand() % 20 != 0 ) set.insertNew( p );
+    }
+  return set;
+}
+
+/**
+ * Computes the critical cliques of a complex with 1 to maxThreads
+ * threads, checks that the results do not change, and displays the
+ * speedups.
+ */
+bool benchmarkCriticalCliques( int radius, unsigned int maxThreads )
+{
+  trace.beginBlock( "Critical cliques of a ball of radius " + std::to_string( radius ) );
+  const Domain domain( Point::diagonal( -radius - 2 ), Point::diagonal( radius + 2 ) );
+  KSpace ks;
+  ks.init( domain.lowerBound(), domain.upperBound(), true );
+  Complex vc( ks );
+  vc.construct( makeShape( domain, radius ),
+                functions::loadTable( simplicity::tableSimple26_6 ) );
+  trace.info() << "nbCells: " << vc.nbCells( 0 ) << " " << vc.nbCells( 1 ) << " "
+               << vc.nbCells( 2 ) << " " << vc.nbCells( 3 ) << std::endl;
+
+  bool ok = true;
+  double tSequential = 0.0;
+  std::vector<std::size_t> sizes;
+  for ( unsigned int n = 1; n <= maxThreads; ++n )
+    {
+      const auto policy = n == 1 ? ParallelPolicy::sequential() : ParallelPolicy::threads( n );
+      Clock c;
+      c.startClock();
+      const auto criticals = vc.criticalCliques( vc, policy );
+      const double t = c.stopClock();
+      if ( n == 1 ) tSequential = t;
+      std::vector<std::size_t> nbs;
+      for ( auto const & cliques : criticals ) nbs.push_back( cliques.size() );
+      if ( n == 1 ) sizes = nbs;
+      ok = ok && ( nbs == sizes );
+      trace.info() << "threads=" << n << " : " << t << " ms"
+                   << ", speedup " << tSequential / t
+                   << ", critical cliques " << nbs[ 0 ] << " " << nbs[ 1 ] << " "
+                   << nbs[ 2 ] << " " << nbs[ 3 ] << std::endl;
+    }
+  trace.endBlock();
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class VoxelComplex" );
+  const unsigned int hardware = std::max( 1u, std::thread::hardware_concurrency() );
+  const unsigned int maxThreads = argc > 2 ? atoi( argv[ 2 ] ) : hardware;
+  std::vector<int> radii = { 8, 16 };
+  if ( argc > 1 ) radii = { atoi( argv[ 1 ] ) };
+  bool res = true;
+  for ( int radius : radii )
+    res = benchmarkCriticalCliques( radius, maxThreads ) && res;
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
@@ -441,6 +441,28 @@ TEST_CASE_METHOD(Fixture_complex_diamond, "Get All Critical Cliques of diamond",
     }
 }
 
+TEST_CASE_METHOD(Fixture_complex_diamond, "Critical cliques with threads",
+                 "[critical][clique][parallel]") {
+    auto &vc = complex_fixture;
+    SECTION(" Same cliques in the same order whatever the number of threads ") {
+        const auto sequential = vc.criticalCliques(vc, ParallelPolicy::sequential());
+        for (unsigned int nb_threads : {2u, 3u, 8u}) {
+            const auto parallel = vc.criticalCliques(vc, ParallelPolicy::threads(nb_threads));
+            for (Dimension d = 0; d != 4; ++d) {
+                REQUIRE(parallel[d].size() == sequential[d].size());
+                bool same = true;
+                for (std::size_t i = 0; i != parallel[d].size(); ++i)
+                    same = same && (parallel[d][i] == sequential[d][i]);
+                CHECK(same);
+            }
+        }
+        vc.setParallelPolicy(ParallelPolicy::threads(4));
+        FixtureComplex copy(vc);
+        CHECK(copy.parallelPolicy().nbThreads() == 4);
+        CHECK(copy.criticalCliques()[2].size() == sequential[2].size());
+    }
+}
+
 
 ///////////////////////////////////////////////////////////////////////////
 // Fixture for complex fig 4 of Asymmetric parallel 3D thinning scheme